@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""
+Sweep every font on a connected LovyanGFX Font Display over serial and write
+a contact sheet image.
+
+Requires pyserial and Pillow:
+    pip install pyserial pillow
+
+Usage:
+    python scripts/contact_sheet.py --port /dev/ttyACM0 --out contact_sheet.png
+    python scripts/contact_sheet.py --port COM5 --text "Sphinx of black quartz" --columns 8
+"""
+
+import argparse
+import struct
+import sys
+
+RUN_FLAG = 0x80
+
+
+def rle565_decode(data, pixel_count):
+    """Decode one rle565 row into a list of big-endian RGB565 values"""
+    pixels = []
+    i = 0
+    while len(pixels) < pixel_count:
+        header = data[i]
+        i += 1
+        count = (header & 0x7F) + 1
+        if header & RUN_FLAG:
+            pixels.extend([(data[i] << 8) | data[i + 1]] * count)
+            i += 2
+        else:
+            for _ in range(count):
+                pixels.append((data[i] << 8) | data[i + 1])
+                i += 2
+    if len(pixels) != pixel_count or i != len(data):
+        raise ValueError("malformed rle565 row")
+    return pixels
+
+
+def rgb565_to_rgb(value):
+    r = (value >> 11) & 0x1F
+    g = (value >> 5) & 0x3F
+    b = value & 0x1F
+    return ((r * 255 + 15) // 31, (g * 255 + 31) // 63, (b * 255 + 15) // 31)
+
+
+class Device:
+    """Command protocol client, see src/serialcommands.hpp
+
+    link is a pyserial port, or anything with its write(), read(n) and
+    readline() that returns b"" on a timeout.
+    """
+
+    def __init__(self, link):
+        self.link = link
+
+    @classmethod
+    def open(cls, port, baud, timeout):
+        import serial
+
+        link = serial.Serial(port, baud, timeout=timeout)
+        link.reset_input_buffer()
+        return cls(link)
+
+    def read_line(self):
+        line = self.link.readline()
+        if not line:
+            raise TimeoutError("no reply from device")
+        return line.decode("utf-8", errors="replace").rstrip("\r\n")
+
+    def command(self, text):
+        """Send a command and return (status line, payload lines)"""
+        self.link.write((text + "\n").encode("utf-8"))
+        payload = []
+        while True:
+            line = self.read_line()
+            if line.startswith("OK") or line.startswith("ERR"):
+                if line.startswith("ERR"):
+                    raise RuntimeError(f"{text}: {line}")
+                return line, payload
+            payload.append(line)
+
+    def list_fonts(self):
+        _, lines = self.command("LIST")
+        fonts = []
+        for line in lines:
+            if not line.startswith("FONT "):
+                continue  # Debug output from the main loop
+            _, font_id, size, names = line.split(" ", 3)
+            family, name = names.split("|", 1)
+            fonts.append((int(font_id), int(size), family, name))
+        return fonts
+
+    def read_frame(self):
+        """Return (width, height, rows of RGB565 values) of the frame on screen"""
+        self.link.write(b"SHOT\n")
+        header = self.read_line()
+        while not header.startswith("SHOT ") and not header.startswith("ERR"):
+            header = self.read_line()
+        if header.startswith("ERR"):
+            raise RuntimeError(header)
+
+        _, width, height = header.split()
+        width, height = int(width), int(height)
+        rows = []
+        for _ in range(height):
+            (length,) = struct.unpack("<H", self.link.read(2))
+            rows.append(rle565_decode(self.link.read(length), width))
+
+        status = self.read_line()
+        if not status.startswith("OK"):
+            raise RuntimeError(f"SHOT: {status}")
+        return width, height, rows
+
+    def screenshot(self):
+        from PIL import Image
+
+        width, height, rows = self.read_frame()
+        image = Image.new("RGB", (width, height))
+        for y, row in enumerate(rows):
+            for x, value in enumerate(row):
+                image.putpixel((x, y), rgb565_to_rgb(value))
+        return image
+
+
+def make_sheet(device, columns, scale, log=print):
+    """Render every listed font and tile the screenshots, labelled, into one image"""
+    from PIL import Image, ImageDraw
+
+    fonts = device.list_fonts()
+    if not fonts:
+        raise RuntimeError("device reported no fonts")
+
+    thumbs = []
+    for font_id, size, family, name in fonts:
+        device.command(f"FONT {font_id}")
+        status, _ = device.command("RENDER")
+        shot = device.screenshot()
+        thumb = shot.resize((int(shot.width * scale), int(shot.height * scale)))
+        thumbs.append((thumb, f"{font_id}: {name}"))
+        log(f"{font_id:3d} {family} / {name} ({status})")
+
+    label_height = 14
+    cell_w = thumbs[0][0].width
+    cell_h = thumbs[0][0].height + label_height
+    rows = (len(thumbs) + columns - 1) // columns
+    sheet = Image.new("RGB", (cell_w * columns, cell_h * rows), "black")
+    draw = ImageDraw.Draw(sheet)
+    for i, (thumb, label) in enumerate(thumbs):
+        x = (i % columns) * cell_w
+        y = (i // columns) * cell_h
+        sheet.paste(thumb, (x, y))
+        draw.text((x + 2, y + thumb.height + 1), label, fill="white")
+    return sheet, len(thumbs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", required=True, help="serial port of the device")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--timeout", type=float, default=5.0, help="seconds to wait for a reply")
+    parser.add_argument("--text", help="sample text to render (default: current text)")
+    parser.add_argument("--columns", type=int, default=6)
+    parser.add_argument("--scale", type=float, default=0.5, help="thumbnail scale factor")
+    parser.add_argument("--out", default="contact_sheet.png")
+    args = parser.parse_args()
+
+    device = Device.open(args.port, args.baud, args.timeout)
+    if args.text:
+        device.command("TEXT " + args.text)
+
+    try:
+        sheet, count = make_sheet(device, args.columns, args.scale)
+    except RuntimeError as error:
+        sys.exit(str(error))
+    sheet.save(args.out)
+    print(f"Wrote {args.out} ({count} fonts)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""
+Attribute flash bytes in a firmware linker map to the fonts of the font
+manifest.
+
+Every font in font_manifest.json is referenced as &fonts::<Name>; the font
+object and its glyph/bitmap tables carry that name in their (mangled) symbol,
+so each input section of the map whose name contains it is charged to the
+font. Sections are matched to the longest font name they contain, so
+FreeSansBold9pt7b does not also count towards FreeSans9pt7b. Data that does
+not carry the font name (e.g. the tables of the built-in Font2..Font8) is
+reported as unattributed rather than guessed.
+
+Build first so the map exists:
+    pio run -e m5stack-stamps3-en
+
+Usage:
+    python scripts/font_flash_report.py
+    python scripts/font_flash_report.py --map .pio/build/m5stack-stamps3-full/firmware.map --fonts
+
+scripts/gen_font_catalog.py --report --map <map> uses the same attribution
+to give the glyph data of each build profile.
+"""
+
+import argparse
+import re
+import sys
+from collections import OrderedDict
+
+import gen_font_catalog
+
+DEFAULT_MAP = ".pio/build/m5stack-stamps3-en/firmware.map"
+DEFAULT_CATALOG = "font_manifest.json"
+
+# Input section with address and size on the same line, or on the next one
+SECTION_LINE = re.compile(r"^ (\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*))?$")
+ADDRESS_LINE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+OUTPUT_SECTION = re.compile(r"^(\.\S+)")
+
+# ESP32 output sections mapped from flash (IRAM/DRAM copies are not counted)
+FLASH_OUTPUT_SECTIONS = (".flash.",)
+
+
+def read_catalog(path):
+    """Return an ordered {font symbol: (family, name)} of the lgfx fonts in the manifest"""
+    catalog = OrderedDict()
+    for font in gen_font_catalog.expand_fonts(gen_font_catalog.load_manifest(path)):
+        if font["symbol"].startswith("fonts::"):
+            catalog[font["symbol"][len("fonts::"):]] = (font["family"], font["name"])
+    return catalog
+
+
+def read_sections(path):
+    """Yield (output section, input section, size) for every linked input section in the map"""
+    with open(path, encoding="utf-8", errors="replace") as mapfile:
+        lines = iter(mapfile.read().splitlines())
+
+    # Sections listed before this header were discarded by --gc-sections
+    for line in lines:
+        if line.startswith("Linker script and memory map"):
+            break
+
+    output = ""
+    pending = None
+    for line in lines:
+        if pending is not None:
+            match = ADDRESS_LINE.match(line)
+            if match and int(match.group(1), 16) != 0:
+                yield output, pending, int(match.group(2), 16)
+            pending = None
+            continue
+
+        match = OUTPUT_SECTION.match(line)
+        if match:
+            output = match.group(1)
+            continue
+
+        match = SECTION_LINE.match(line)
+        if not match:
+            continue
+        if match.group(2) is None:
+            pending = match.group(1)  # Long name, address and size follow
+        elif int(match.group(2), 16) != 0:
+            yield output, match.group(1), int(match.group(3), 16)
+
+
+def build_matcher(symbols):
+    """Return a function mapping a section name to the longest font symbol in it"""
+    ordered = sorted(symbols, key=len, reverse=True)
+    # Not preceded by a letter: mangled names put a length digit before identifiers
+    pattern = re.compile("(?<![A-Za-z_])(" + "|".join(re.escape(s) for s in ordered) + ")")
+
+    def match(section):
+        found = pattern.findall(section)
+        return max(found, key=len) if found else None
+
+    return match
+
+
+def attribute(map_path, symbols):
+    """Return {symbol: flash bytes} for the given "fonts::<Name>" symbols, from a linker map"""
+    names = {symbol[len("fonts::"):]: symbol for symbol in symbols if symbol.startswith("fonts::")}
+    match = build_matcher(names.keys())
+    font_bytes = dict.fromkeys(names.values(), 0)
+    for output, section, size in read_sections(map_path):
+        if output.startswith(FLASH_OUTPUT_SECTIONS):
+            name = match(section)
+            if name is not None:
+                font_bytes[names[name]] += size
+    return font_bytes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--map", default=DEFAULT_MAP, help="linker map (default: %(default)s)")
+    parser.add_argument("--catalog", default=DEFAULT_CATALOG, help="font manifest (default: %(default)s)")
+    parser.add_argument("--fonts", action="store_true", help="also list every font, not only family totals")
+    args = parser.parse_args()
+
+    try:
+        catalog = read_catalog(args.catalog)
+        sections = list(read_sections(args.map))
+    except OSError as error:
+        sys.exit(f"{error}\nBuild with 'pio run' first, or pass --map")
+    if not catalog:
+        sys.exit(f"no fonts found in {args.catalog}")
+
+    match = build_matcher(catalog.keys())
+    font_bytes = OrderedDict((symbol, 0) for symbol in catalog)
+    flash_total = 0
+    for output, section, size in sections:
+        if not output.startswith(FLASH_OUTPUT_SECTIONS):
+            continue
+        flash_total += size
+        symbol = match(section)
+        if symbol is not None:
+            font_bytes[symbol] += size
+
+    family_bytes = OrderedDict()
+    for symbol, (family, _) in catalog.items():
+        family_bytes[family] = family_bytes.get(family, 0) + font_bytes[symbol]
+
+    print(f"Font flash use from {args.map}")
+    if args.fonts:
+        print()
+        print(f"{'family':<24} {'font':<32} {'bytes':>9}")
+        for symbol, (family, name) in catalog.items():
+            size = font_bytes[symbol]
+            print(f"{family:<24} {name:<32} {size:>9}" if size else f"{family:<24} {name:<32} {'not linked':>9}")
+
+    print()
+    print(f"{'family':<24} {'fonts':>5} {'bytes':>9} {'KB':>8}")
+    for family, size in sorted(family_bytes.items(), key=lambda item: item[1], reverse=True):
+        count = sum(1 for f, _ in catalog.values() if f == family)
+        print(f"{family:<24} {count:>5} {size:>9} {size / 1024:>8.1f}")
+
+    attributed = sum(font_bytes.values())
+    missing = sum(1 for size in font_bytes.values() if size == 0)
+    print()
+    print(f"Attributed to fonts: {attributed} bytes ({attributed / 1024:.1f} KB) "
+          f"of {flash_total} bytes ({flash_total / 1024:.1f} KB) in flash sections")
+    if missing:
+        print(f"{missing} catalog fonts have no named sections in the map (not linked, or data shared/unnamed)")
+
+
+if __name__ == "__main__":
+    main()
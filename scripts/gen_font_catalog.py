@@ -0,0 +1,387 @@
+#!/usr/bin/env python3
+"""
+Generate src/fontcatalog.hpp, the font catalog of every build profile, from
+font_manifest.json.
+
+The manifest lists each family once, with its fonts either spelled out or as
+name templates over a list of sizes, and each font's style, script and
+whether it is monospaced. Profiles select fonts by those attributes; a font
+no profile of the build selects is never referenced, so it is not linked.
+Families that need a build flag ("requires") are generated with and
+without it.
+
+Usage:
+    python scripts/gen_font_catalog.py            # write src/fontcatalog.hpp
+    python scripts/gen_font_catalog.py --check    # fail if it is out of date
+    python scripts/gen_font_catalog.py --report [--env m5stack-stamps3-font-map | --map <firmware.map>]
+
+--report prints the flash and RAM each profile costs. Catalog tables and the
+per-font RAM of the font manager are computed here; glyph data is only known
+from a linker map of a build that linked the fonts. By default that is
+.pio/build/<env>/firmware.map of the m5stack-stamps3-font-map environment,
+which links all of them and is built only for its map.
+
+Pixel metrics (line height, ascent, descent, x-height, advances) are not part
+of the catalog. They come from the M5GFX font data, which this script does
+not read and which is not in the repository; the firmware measures them on
+first use and keeps them in FontMetricsIndex (fontmetricsindex.hpp).
+"""
+
+import argparse
+import itertools
+import json
+import os
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+DEFAULT_MANIFEST = os.path.join(ROOT, "font_manifest.json")
+DEFAULT_OUTPUT = os.path.join(ROOT, "src", "fontcatalog.hpp")
+DEFAULT_ENV = "m5stack-stamps3-font-map"  # Links every font, so its map has all the glyph data
+
+STYLES = {"regular": [], "bold": ["FONT_TRAIT_BOLD"], "italic": ["FONT_TRAIT_ITALIC"],
+          "bold-italic": ["FONT_TRAIT_BOLD", "FONT_TRAIT_ITALIC"]}
+SCRIPTS = ("latin", "cjk")
+
+# Sizes on the ESP32 (32-bit pointers), for the footprint report
+FONT_INFO_BYTES = 16       # FontInfo: family, name, size, fontPtr
+CATALOG_FONT_BYTES = 12    # CatalogFont
+CATALOG_FAMILY_BYTES = 8   # CatalogFamily
+SCALABLE_FONT_BYTES = 8    # ScalableFont object: vtable, face, size
+RAM_PER_FONT = (
+    ("metrics index", 18 + 4),      # FontMetricsEntry plus its font pointer, once FIT has run
+    ("thumbnail offsets", 4),       # ThumbnailStore::offsets
+)
+
+
+def load_manifest(path=DEFAULT_MANIFEST):
+    with open(path, encoding="utf-8") as source:
+        return json.load(source)
+
+
+def expand_fonts(manifest):
+    """Return the fonts of every family in catalog order, with all attributes resolved"""
+    fonts = []
+    for family_index, family in enumerate(manifest["families"]):
+        if "fonts" in family:
+            entries = family["fonts"]
+        else:
+            # Variant-major, so each style's sizes stay together on the dial
+            entries = []
+            for variant in family["variants"]:
+                for size in family["sizes"]:
+                    entry = {key: value.format(size=size) if isinstance(value, str) else value
+                             for key, value in variant.items()}
+                    entry["size"] = size
+                    entries.append(entry)
+
+        for entry in entries:
+            font = {
+                "group": family_index,
+                "family": entry.get("family", family["family"]),
+                "name": entry["name"],
+                "size": entry["size"],
+                "style": entry.get("style", family.get("style", "regular")),
+                "script": entry.get("script", family.get("script", "latin")),
+                "mono": entry.get("mono", family.get("mono", False)),
+                "format": entry.get("format", family.get("format", "")),
+                "requires": entry.get("requires", family.get("requires")),
+                "object": entry.get("object"),
+            }
+            font["symbol"] = entry.get("symbol", "fonts::" + entry["name"])
+            if font["style"] not in STYLES:
+                sys.exit(f"{font['name']}: unknown style {font['style']}")
+            if font["script"] not in SCRIPTS:
+                sys.exit(f"{font['name']}: unknown script {font['script']}")
+            if not 0 <= font["size"] <= 255:
+                sys.exit(f"{font['name']}: size {font['size']} does not fit the catalog")
+            fonts.append(font)
+
+    names = [font["name"] for font in fonts]
+    duplicates = sorted({name for name in names if names.count(name) > 1})
+    if duplicates:
+        sys.exit("fonts listed twice: " + ", ".join(duplicates))
+    return fonts
+
+
+def matches(font, selector):
+    for key, value in selector.items():
+        if key not in ("family", "name", "size", "style", "script", "mono", "format"):
+            sys.exit(f"unknown selector key {key}")
+        if font[key] != value:
+            return False
+    return True
+
+
+def select(fonts, profile, flags):
+    """Fonts of a profile, in catalog order, for a set of enabled build flags"""
+    return [font for font in fonts
+            if (font["requires"] is None or font["requires"] in flags)
+            and any(matches(font, selector) for selector in profile["select"])]
+
+
+def macro_name(profile):
+    return "FONT_PROFILE_" + profile["name"].upper().replace("-", "_")
+
+
+def flag_variants(fonts):
+    """Every combination of the optional build flags, most flags first"""
+    flags = sorted({font["requires"] for font in fonts if font["requires"] is not None})
+    variants = []
+    for count in range(len(flags), -1, -1):
+        variants.extend(set(combination) for combination in itertools.combinations(flags, count))
+    return flags, variants
+
+
+def c_string(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def families_of(selected):
+    """(name, first, count) per family of the selection, in catalog order"""
+    families = []
+    for index, font in enumerate(selected):
+        if not families or families[-1][3] != font["group"]:
+            families.append([font["family"], index, 0, font["group"]])
+        families[-1][2] += 1
+    return [(name, first, count) for name, first, count, _ in families]
+
+
+def traits_of(font):
+    traits = list(STYLES[font["style"]])
+    if font["mono"]:
+        traits.append("FONT_TRAIT_MONO")
+    if font["script"] == "cjk":
+        traits.append("FONT_TRAIT_CJK")
+    if font["object"] is not None:
+        traits.append("FONT_TRAIT_SCALABLE")
+    return " | ".join(traits) if traits else "0"
+
+
+def macro_lines(name, lines):
+    if not lines:
+        return [f"#define {name}"]
+    return [f"#define {name} \\"] + [f"    {line} \\" for line in lines[:-1]] + [f"    {lines[-1]}"]
+
+
+def generate_variant(profile, selected):
+    families = families_of(selected)
+    group_of = {}
+    for family_index, (_, first, count) in enumerate(families):
+        for index in range(first, first + count):
+            group_of[index] = family_index
+
+    out = [
+        f'#define FONT_PROFILE_NAME "{profile["name"]}"',
+        f"#define FONT_CATALOG_HAS_CJK {int(any(font['script'] == 'cjk' for font in selected))}",
+        f"static constexpr int FONT_CATALOG_FAMILY_COUNT = {len(families)};",
+        f"static constexpr int FONT_CATALOG_FONT_COUNT = {len(selected)};",
+        f"static constexpr int FONT_CATALOG_MONO_COUNT = {sum(1 for font in selected if font['mono'])};",
+        f"static constexpr int FONT_CATALOG_MAX_SIZE = {max(font['size'] for font in selected)};",
+        "static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {",
+    ]
+    for name, first, count in families:
+        out.append(f"    {{{c_string(name)}, {first}, {count}}},")
+    out.append("};")
+    out.append("static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {")
+    for index, font in enumerate(selected):
+        out.append(f"    {{{c_string(font['family'])}, {c_string(font['name'])}, {font['size']}, "
+                   f"{group_of[index]}, {traits_of(font)}}},")
+    out.append("};")
+
+    objects = [f"static const {font['object'].split('(')[0]} {font['symbol']}({font['object'].split('(', 1)[1]};"
+               for font in selected if font["object"] is not None]
+    out.extend(macro_lines("FONT_CATALOG_OBJECTS", objects))
+    entries = [f"{{{c_string(font['family'])}, {c_string(font['name'])}, {font['size']}, &{font['symbol']}}},"
+               for font in selected]
+    out.extend(macro_lines("FONT_CATALOG_ENTRIES", entries))
+    return out
+
+
+def generate(manifest, fonts):
+    flags, variants = flag_variants(fonts)
+    profiles = manifest["profiles"]
+    names = {profile["name"] for profile in profiles}
+    if "english" not in names or "full" not in names:
+        sys.exit("the manifest needs the english and full profiles, the defaults without FONT_PROFILE")
+
+    out = [
+        "/**",
+        " * @file fontcatalog.hpp",
+        " * @brief Font catalog of each build profile",
+        " * @date 2026-10-19",
+        " *",
+        " * Generated by scripts/gen_font_catalog.py from font_manifest.json; edit the",
+        " * manifest and run the script again instead of changing this file.",
+        " *",
+        " * Plain C++ with no Arduino dependencies. Only FONT_CATALOG_OBJECTS and",
+        " * FONT_CATALOG_ENTRIES name the lgfx font objects; lgfxfonts.cpp expands",
+        " * them, so fonts outside the selected profile are never referenced.",
+        " *",
+        " * Pixel metrics are not in the catalog: they depend on the M5GFX font data,",
+        " * which the generator does not read. FontMetricsIndex measures them on the",
+        " * device instead.",
+        " */",
+        "",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// Build profiles, selected with -DFONT_PROFILE=FONT_PROFILE_<NAME>",
+    ]
+    width = max(len(macro_name(profile)) for profile in profiles)
+    for number, profile in enumerate(profiles, 1):
+        out.append(f"#define {macro_name(profile):<{width}} {number} // {profile['description']}")
+    out += [
+        "",
+        "#ifndef FONT_PROFILE",
+        "#ifdef ENGLISH_FONTS_ONLY",
+        "#define FONT_PROFILE FONT_PROFILE_ENGLISH",
+        "#else",
+        "#define FONT_PROFILE FONT_PROFILE_FULL",
+        "#endif",
+        "#endif",
+        "",
+        "// Bits of CatalogFont::traits",
+        "enum CatalogFontTrait : uint8_t",
+        "{",
+        "    FONT_TRAIT_BOLD = 1,",
+        "    FONT_TRAIT_ITALIC = 2,",
+        "    FONT_TRAIT_MONO = 4,     // Printable ASCII glyphs share one advance",
+        "    FONT_TRAIT_CJK = 8,      // Covers Chinese or Japanese",
+        "    FONT_TRAIT_SCALABLE = 16 // Rasterized at run time, see scalablefont.hpp",
+        "};",
+        "",
+        "// A family's fonts are FONT_CATALOG_FONTS[first] to [first + count - 1]",
+        "struct CatalogFamily",
+        "{",
+        "    const char *name;",
+        "    uint16_t first;",
+        "    uint16_t count;",
+        "};",
+        "",
+        "// One font, in dial order",
+        "struct CatalogFont",
+        "{",
+        "    const char *family;",
+        "    const char *name;",
+        "    uint8_t size;",
+        "    uint8_t familyIndex; // Into FONT_CATALOG_FAMILIES",
+        "    uint8_t traits;      // CatalogFontTrait bits",
+        "};",
+        "",
+    ]
+
+    keyword = "#if"
+    for profile in profiles:
+        for enabled in variants:
+            selected = select(fonts, profile, enabled)
+            if not selected:
+                sys.exit(f"profile {profile['name']} selects no fonts")
+            condition = " && ".join([f"FONT_PROFILE == {macro_name(profile)}"] +
+                                    [f"defined({flag})" if flag in enabled else f"!defined({flag})"
+                                     for flag in flags])
+            out.append(f"{keyword} {condition}")
+            out.extend(generate_variant(profile, selected))
+            keyword = "#elif"
+    out += [
+        "#else",
+        '#error "Unknown FONT_PROFILE, see the FONT_PROFILE_ list above"',
+        "#endif",
+        "",
+    ]
+    return "\n".join(out)
+
+
+def footprint(fonts, profile, flags, glyph_bytes):
+    """(catalog flash, glyph flash or None, RAM) of one profile build"""
+    selected = select(fonts, profile, flags)
+    families = families_of(selected)
+    strings = {font["name"] for font in selected} | {font["family"] for font in selected}
+    catalog = (len(selected) * (FONT_INFO_BYTES + CATALOG_FONT_BYTES) + len(families) * CATALOG_FAMILY_BYTES +
+               sum(len(text) + 1 for text in strings))
+    glyphs = None
+    if glyph_bytes is not None:
+        glyphs = sum(glyph_bytes.get(font["symbol"], 0) for font in selected)
+    ram = len(selected) * sum(size for _, size in RAM_PER_FONT)
+    ram += sum(SCALABLE_FONT_BYTES for font in selected if font["object"] is not None)
+    return selected, catalog, glyphs, ram
+
+
+def default_map(env):
+    return os.path.join(ROOT, ".pio", "build", env, "firmware.map")
+
+
+def report(manifest, fonts, map_path, env):
+    """Footprint table; glyph data from map_path, or from env's build map if there is one"""
+    if map_path is None and os.path.exists(default_map(env)):
+        map_path = default_map(env)
+    glyph_bytes = None
+    if map_path is not None:
+        import font_flash_report
+        try:
+            glyph_bytes = font_flash_report.attribute(map_path, [font["symbol"] for font in fonts])
+        except OSError as error:
+            sys.exit(f"{error}\nBuild first (pio run -e {env}), or pass the --map of another build")
+        print(f"glyph data from {os.path.normpath(map_path)}")
+
+    flags, variants = flag_variants(fonts)
+    print(f"{'profile':<28} {'fonts':>5} {'mono':>5} {'catalog B':>10} {'glyph KB':>9} {'RAM B':>7}")
+    for profile in manifest["profiles"]:
+        for enabled in variants:
+            selected, catalog, glyphs, ram = footprint(fonts, profile, enabled, glyph_bytes)
+            name = "+".join([profile["name"]] + sorted(enabled))
+            mono = sum(1 for font in selected if font["mono"])
+            glyph_text = f"{glyphs / 1024:.1f}" if glyphs is not None else "-"
+            print(f"{name:<28} {len(selected):>5} {mono:>5} {catalog:>10} {glyph_text:>9} {ram:>7}")
+
+    print()
+    print("catalog: FontInfo and CatalogFont entries, families and name strings (flash)")
+    print("RAM: " + ", ".join(f"{name} {size} B" for name, size in RAM_PER_FONT) + " per font")
+    if glyph_bytes is None:
+        print(f"glyph KB: no {os.path.relpath(default_map(env), ROOT)}; run pio run -e {env}, "
+              "or pass --map with the linker map of a build that linked the fonts")
+    else:
+        missing = sorted(font["name"] for font in fonts
+                         if font["object"] is None and glyph_bytes.get(font["symbol"], 0) == 0)
+        if missing:
+            print(f"glyph KB: {len(missing)} fonts have no named sections in {map_path}: "
+                  + ", ".join(missing))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--manifest", default=DEFAULT_MANIFEST, help="font manifest (default: %(default)s)")
+    parser.add_argument("--output", default=DEFAULT_OUTPUT, help="generated header (default: %(default)s)")
+    parser.add_argument("--check", action="store_true", help="only check that the header is up to date")
+    parser.add_argument("--report", action="store_true", help="print the flash and RAM footprint of each profile")
+    parser.add_argument("--env", default=DEFAULT_ENV,
+                        help="PlatformIO environment whose firmware.map --report reads (default: %(default)s)")
+    parser.add_argument("--map", help="linker map to take glyph data sizes from instead of the --env build's")
+    args = parser.parse_args()
+
+    manifest = load_manifest(args.manifest)
+    fonts = expand_fonts(manifest)
+    if args.report:
+        report(manifest, fonts, args.map, args.env)
+        return
+
+    header = generate(manifest, fonts)
+    try:
+        with open(args.output, encoding="utf-8") as existing:
+            current = existing.read()
+    except OSError:
+        current = None
+
+    if args.check:
+        if current != header:
+            sys.exit(f"{args.output} is out of date; run scripts/gen_font_catalog.py")
+        print(f"{args.output} is up to date")
+        return
+    if current != header:
+        with open(args.output, "w", encoding="utf-8", newline="\n") as output:
+            output.write(header)
+        print(f"Wrote {args.output}: {len(fonts)} fonts, {len(manifest['profiles'])} profiles")
+
+
+if __name__ == "__main__":
+    main()
@@ -16,78 +16,774 @@
 
 #include <Arduino.h>
 #include <M5Unified.h>
+#include <LittleFS.h>
+#include <atomic>
+#include <string>
+#include <vector>
+#include "bootprofile.hpp"
+#include "editsession.hpp"
 #include "encoder.hpp"
+#ifdef DISPLAY_EPD
+#include "epddevice.hpp"
+#endif
+#include "eventscheduler.hpp"
+#ifdef FANOUT_DISPLAY
+#include "fanoutdevice.hpp"
+#endif
+#include "fnv1a.hpp"
 #include "fontmanager.hpp"
+#include "inputsession.hpp"
+#include "layoutstore.hpp"
+#include "lgfxtarget.hpp"
+#include "logqueue.hpp"
 #include "m5dial.hpp"
+#include "memorytracker.hpp"
+#include "sampletexts.hpp"
+#include "scalablefont.hpp"
+#include "serialcommands.hpp"
+#include "thumbnailstore.hpp"
 #include "version.h"
 
+// Files on the LittleFS partition, accessed through its VFS mount point
+#define STORAGE_ROOT "/littlefs"
+static const char *SAMPLE_TEXT_PATH = STORAGE_ROOT "/samples.txt";
+static const char *LAYOUT_CACHE_PATH = STORAGE_ROOT "/layouts.bin";
+static const char *THUMBNAIL_NAME_FORMAT = "thumbs-%08lx.bin"; // One file per stored sample text, by its hash
+#ifdef TRUETYPE_FONTS
+static const char *TRUETYPE_FACE_PATH = STORAGE_ROOT "/face.ttf";
+#endif
+
+// Inactivity before the backlight dims, then before light sleep (0 disables)
+#ifndef IDLE_DIM_MS
+#define IDLE_DIM_MS 30000
+#endif
+#ifndef IDLE_SLEEP_MS
+#define IDLE_SLEEP_MS 120000
+#endif
+
+// Scheduler timers
+enum
+{
+    TIMER_FRAME,  // Drives a running transition
+    TIMER_BUTTON, // Polls the button and touch panel while down, for hold and tap detection
+    TIMER_SERIAL, // Polls for commands while a USB host is connected
+#ifdef DISPLAY_EPD
+    TIMER_REFRESH, // Fires when batched e-paper damage is due for refresh
+#endif
+};
+static const uint32_t FRAME_INTERVAL_MS = 20;  // Matches the 50 fps transition pacing
+static const uint32_t BUTTON_POLL_MS = 10;
+static const uint32_t SERIAL_POLL_MS = 20;
+
+// Shortest time the splash stays up; boot otherwise continues as soon as the first font is ready
+#ifndef BOOT_MIN_SPLASH_MS
+#define BOOT_MIN_SPLASH_MS 0
+#endif
+static const int BOOT_WARM_FONTS = 3; // Fonts whose caches are filled before the first frame
+
+#ifdef FANOUT_DISPLAY
+#ifdef DISPLAY_EPD
+#error "FANOUT_DISPLAY draws on the dial's panel; it cannot be combined with DISPLAY_EPD"
+#endif
+// Size of the mirror sprite, standing in for an external panel or a host viewer
+#ifndef FANOUT_MIRROR_WIDTH
+#define FANOUT_MIRROR_WIDTH 320
+#endif
+#ifndef FANOUT_MIRROR_HEIGHT
+#define FANOUT_MIRROR_HEIGHT 240
+#endif
+static M5Canvas mirrorCanvas;
+static LgfxDisplayTarget dialTarget("dial", M5.Display);
+static LgfxDisplayTarget mirrorTarget("mirror", mirrorCanvas);
+#endif
+
+// Boot task progress, see bootTask()
+static const EventBits_t BOOT_DONE = BIT0;       // Sample texts and layouts loaded
+static const EventBits_t THUMBNAILS_DONE = BIT1; // thumbnailTask() ended, in the same group
+
+static EventScheduler scheduler;
+static EventGroupHandle_t bootEvents = nullptr;
+static bool bootComplete = false;
+static BootProfile setupProfile("Boot (setup):");
+static BootProfile loadProfile("Boot (background):");
+
+// Thumbnail generation, see requestThumbnails(). While the task runs it owns
+// thumbnailText and its file; the loop only sets thumbnailCancel.
+static const FontInfo *thumbnailFonts = nullptr; // The catalog, once the boot is done
+static size_t thumbnailFontCount = 0;
+static uint32_t thumbnailCatalogHash = 0;
+static uint32_t thumbnailWantedHash = 0; // Hash of the sample text the thumbnails should show
+static std::string thumbnailText;        // Sample text the running task renders
+static char thumbnailPath[48];           // File the running task writes
+static bool thumbnailTaskRunning = false;
+static std::atomic<bool> thumbnailCancel(false);
+static std::atomic<bool> thumbnailBuilt(false);
+
+// Times the font manager's renders
+static uint32_t clockMicros()
+{
+    return micros();
+}
+
+// The USB serial port, as the command protocol reads and writes it
+class SerialCommandStream : public CommandStream
+{
+public:
+    int available() override
+    {
+        return Serial.available();
+    }
+
+    int read() override
+    {
+        return Serial.read();
+    }
+
+    size_t write(const uint8_t *data, size_t size) override
+    {
+        return Serial.write(data, size);
+    }
+};
+static SerialCommandStream serialStream;
+
+/**
+ * @brief Load cached sample text layouts, rebuilding them if the fonts or texts changed
+ */
+static void prepareLayouts()
+{
+    std::vector<const void *> fonts;
+    for (int i = 0; i < fontManager.getTotalFonts(); i++)
+    {
+        fonts.push_back(fontManager.getFontAt(i)->fontPtr);
+    }
+
+    uint32_t catalogHash = fontManager.getCatalogHash();
+    uint32_t textsHash = sampleTextStore.getHash();
+    layoutStore.bind(fonts.data(), fonts.size(), sampleTextStore.getTexts(), sampleTextStore.getCount(),
+                     m5DialDevice.getWrapWidth());
+
+    unsigned long start = millis();
+    if (layoutStore.load(LAYOUT_CACHE_PATH, catalogHash, textsHash))
+    {
+        backgroundLog.printf("Layouts loaded in %lu ms\n", millis() - start);
+        return;
+    }
+
+    layoutStore.build(measureGlyphAdvance);
+    bool saved = layoutStore.save(LAYOUT_CACHE_PATH, catalogHash, textsHash);
+    backgroundLog.printf("Layouts rebuilt in %lu ms (%u bytes)%s\n", millis() - start,
+                         (unsigned)layoutStore.getMemoryUse(), saved ? "" : ", not saved");
+}
+
+/**
+ * @brief Background half of the boot, run while setup() shows the splash
+ *
+ * Until BOOT_DONE the loop leaves sampleTextStore and layoutStore to this
+ * task; layoutStore.find() only reports layouts once they are complete.
+ */
+static void bootTask(void *)
+{
+    loadProfile.begin(micros());
+
+    // Sample texts come from flash when present, built-in ones otherwise
+    if (!LittleFS.begin(true, STORAGE_ROOT))
+    {
+        backgroundLog.printf("LittleFS mount failed, using built-in sample texts\n");
+    }
+    loadProfile.mark("LittleFS", micros());
+
+#ifdef TRUETYPE_FONTS
+    // Before the layouts, which measure the TrueType entries too
+    if (scalableFonts.loadFace(0, TRUETYPE_FACE_PATH))
+    {
+        backgroundLog.printf("TrueType face: %u bytes, %u glyphs\n", (unsigned)scalableFonts.getFaceSize(0),
+                             (unsigned)scalableFonts.getFace(0)->getGlyphCount());
+    }
+    else
+    {
+        backgroundLog.printf("TrueType face missing, its catalog entries stay blank\n");
+    }
+    loadProfile.mark("TrueType face", micros());
+#endif
+
+    backgroundLog.printf("Sample texts: %u\n", (unsigned)sampleTextStore.load(SAMPLE_TEXT_PATH));
+    loadProfile.mark("sample texts", micros());
+
+    prepareLayouts();
+    loadProfile.mark("layouts", micros());
+
+    xEventGroupSetBits(bootEvents, BOOT_DONE);
+    m5DialDevice.notify();
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @brief Get the thumbnail file of a sample text
+ * @param textHash fnv1aString() of the text
+ * @param path Output, stdio path
+ * @param size Size of path in bytes
+ */
+static void getThumbnailPath(uint32_t textHash, char *path, size_t size)
+{
+    char name[24];
+    snprintf(name, sizeof(name), THUMBNAIL_NAME_FORMAT, (unsigned long)textHash);
+    snprintf(path, size, STORAGE_ROOT "/%s", name);
+}
+
+/**
+ * @brief Check whether a text is one of the stored sample texts
+ * @param textHash fnv1aString() of the text
+ * @return false for texts typed in the editor
+ */
+static bool isStoredText(uint32_t textHash)
+{
+    for (size_t i = 0; i < sampleTextStore.getCount(); i++)
+    {
+        if (fnv1aString(sampleTextStore.getText(i)) == textHash)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Delete thumbnail files of texts that are no longer stored, and unfinished ones
+ */
+static void pruneThumbnails()
+{
+    std::vector<std::string> stale;
+    File root = LittleFS.open("/");
+    for (File entry = root ? root.openNextFile() : File(); entry; entry = root.openNextFile())
+    {
+        const char *name = entry.name();
+        unsigned long hash;
+        char expected[24];
+        if (strncmp(name, "thumbs", 6) != 0)
+        {
+            continue;
+        }
+        bool current = sscanf(name, THUMBNAIL_NAME_FORMAT, &hash) == 1 &&
+                       snprintf(expected, sizeof(expected), THUMBNAIL_NAME_FORMAT, hash) > 0 &&
+                       strcmp(name, expected) == 0 && isStoredText(hash);
+        if (!current)
+        {
+            stale.push_back(std::string("/") + name);
+        }
+    }
+
+    for (const std::string &path : stale)
+    {
+        LittleFS.remove(path.c_str());
+    }
+    if (!stale.empty())
+    {
+        Serial.printf("Thumbnails: removed %u stale files\n", (unsigned)stale.size());
+    }
+}
+
+/**
+ * @brief Render every font's thumbnail for thumbnailText, off the main loop
+ */
+static void thumbnailTask(void *)
+{
+    unsigned long start = millis();
+    bool built = m5DialDevice.buildThumbnails(thumbnailPath, thumbnailFonts, thumbnailFontCount,
+                                              thumbnailCatalogHash, thumbnailText.c_str(), thumbnailCancel);
+    backgroundLog.printf("Thumbnails %s in %lu ms\n", built ? "built" : "not built", millis() - start);
+
+    thumbnailBuilt = built;
+    xEventGroupSetBits(bootEvents, THUMBNAILS_DONE);
+    m5DialDevice.notify();
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @brief Open the thumbnail file if it matches the catalog and the wanted text
+ */
+static bool loadThumbnails()
+{
+    char path[48];
+    getThumbnailPath(thumbnailWantedHash, path, sizeof(path));
+    if (!thumbnailStore.load(path, thumbnailCatalogHash, thumbnailWantedHash, m5DialDevice.getDisplayWidth(),
+                             thumbnailFontCount))
+    {
+        return false;
+    }
+    Serial.printf("Thumbnails loaded (%u bytes)\n", (unsigned)thumbnailStore.getFileSize());
+    return true;
+}
+
+/**
+ * @brief Use the stored thumbnails, or start rendering them in the background
+ *
+ * Only stored sample texts get thumbnails, each in its own file, so going
+ * back to a text reuses its file. Texts typed in the editor render live.
+ */
+static void startThumbnails()
+{
+    // The task may replace this text's file, so it must not stay open
+    thumbnailStore.close();
+    if (loadThumbnails() || !isStoredText(thumbnailWantedHash))
+    {
+        return;
+    }
+
+    thumbnailText = fontManager.getSampleText();
+    getThumbnailPath(thumbnailWantedHash, thumbnailPath, sizeof(thumbnailPath));
+    thumbnailCancel = false;
+    thumbnailTaskRunning = true;
+    xTaskCreatePinnedToCore(thumbnailTask, "thumbnails", 8192, nullptr, 1, nullptr, 0);
+}
+
+/**
+ * @brief Make the thumbnails follow the sample text; call after it may have changed
+ *
+ * A build for an older text is cancelled when the new text is a stored one,
+ * and the new text's thumbnails are loaded or built from finishThumbnails().
+ * An edited text lets the build finish, since its file stays useful.
+ */
+static void requestThumbnails()
+{
+    if (!bootComplete || !fontManager.arePreviewsEnabled())
+    {
+        return;
+    }
+
+    uint32_t hash = fnv1aString(fontManager.getSampleText());
+    if (hash == thumbnailWantedHash)
+    {
+        return;
+    }
+    thumbnailWantedHash = hash;
+
+    if (thumbnailTaskRunning)
+    {
+        thumbnailCancel = isStoredText(hash);
+        return;
+    }
+    startThumbnails();
+}
+
+/**
+ * @brief Adopt the result of thumbnailTask(), or start over for a newer text
+ */
+static void finishThumbnails()
+{
+    xEventGroupClearBits(bootEvents, THUMBNAILS_DONE);
+    thumbnailTaskRunning = false;
+
+    if (fnv1aString(thumbnailText.c_str()) != thumbnailWantedHash)
+    {
+        startThumbnails();
+    }
+    else if (thumbnailBuilt)
+    {
+        loadThumbnails();
+    }
+}
+
+/**
+ * @brief Turn input state into scheduler events
+ */
+static void pollInputs(uint32_t now)
+{
+    m5DialDevice.update();
+
+    if (encoder.hasPositionChanged())
+    {
+        scheduler.post(EVENT_ENCODER, encoder.getPosition(), now);
+    }
+
+    // Long press toggles the multi-font overview pages, a click changes the text
+    if (M5.BtnA.wasHold())
+    {
+        scheduler.post(EVENT_BUTTON_HOLD, 0, now);
+    }
+    if (M5.BtnA.wasClicked())
+    {
+        scheduler.post(EVENT_BUTTON_CLICK, 0, now);
+    }
+
+    // A tap on the screen opens the sample text editor
+    for (int i = 0; i < M5.Touch.getCount(); i++)
+    {
+        if (M5.Touch.getDetail(i).wasClicked())
+        {
+            scheduler.post(EVENT_TOUCH, 0, now);
+        }
+    }
+
+    // A held button produces no interrupt until release; poll it to see the hold
+    if (M5.BtnA.isPressed() || M5.Touch.getCount() > 0)
+    {
+        scheduler.noteActivity(now);
+        if (!scheduler.isTimerRunning(TIMER_BUTTON))
+        {
+            scheduler.startTimer(TIMER_BUTTON, BUTTON_POLL_MS, true, now);
+        }
+    }
+    else
+    {
+        scheduler.stopTimer(TIMER_BUTTON);
+    }
+
+    // USB serial data raises no interrupt on this task; poll while a host is attached
+    if (Serial)
+    {
+        if (Serial.available() > 0)
+        {
+            scheduler.post(EVENT_SERIAL, 0, now);
+        }
+        if (!scheduler.isTimerRunning(TIMER_SERIAL))
+        {
+            scheduler.startTimer(TIMER_SERIAL, SERIAL_POLL_MS, true, now);
+        }
+    }
+    else
+    {
+        scheduler.stopTimer(TIMER_SERIAL);
+    }
+}
+
+#ifdef DISPLAY_EPD
+/**
+ * @brief Arm the refresh timer for the panel's next batched refresh
+ */
+static void scheduleRefresh(uint32_t now)
+{
+    uint32_t delayMs = epdDevice.getRefreshDelay();
+    if (delayMs == 0xFFFFFFFFUL)
+    {
+        scheduler.stopTimer(TIMER_REFRESH);
+    }
+    else
+    {
+        // Restarting it keeps the refresh behind the latest change
+        scheduler.startTimer(TIMER_REFRESH, delayMs > 0 ? delayMs : 1, false, now);
+    }
+}
+#endif
+
+/**
+ * @brief Redraw for the current encoder position, keeping the frame timer
+ *        running for as long as a transition animates
+ */
+static void updateDisplay(uint32_t now)
+{
+#ifndef DISPLAY_EPD
+    // The editor draws the screen itself until it closes
+    if (editSession.isActive())
+    {
+        scheduler.stopTimer(TIMER_FRAME);
+        return;
+    }
+#endif
+
+    if (fontManager.update(encoder.getPosition(), now))
+    {
+        if (!scheduler.isTimerRunning(TIMER_FRAME))
+        {
+            scheduler.startTimer(TIMER_FRAME, FRAME_INTERVAL_MS, true, now);
+        }
+    }
+    else
+    {
+        scheduler.stopTimer(TIMER_FRAME);
+    }
+
+#ifdef DISPLAY_EPD
+    scheduleRefresh(now);
+#endif
+    requestThumbnails();
+}
+
+/**
+ * @brief Adopt the loaded sample texts once the boot task has finished
+ */
+static void finishBoot()
+{
+    fontManager.setSampleText(sampleTextStore.getText(sampleTextStore.getCurrentIndex()));
+    updateDisplay(millis());
+    bootComplete = true;
+
+    // Thumbnails use the loaded layouts, so they start once the boot is done
+    thumbnailFonts = fontManager.getFontAt(0);
+    thumbnailFontCount = fontManager.getTotalFonts();
+    thumbnailCatalogHash = fontManager.getCatalogHash();
+    pruneThumbnails();
+    requestThumbnails();
+
+    char report[768];
+    setupProfile.format(report, sizeof(report));
+    Serial.print(report);
+    loadProfile.format(report, sizeof(report));
+    Serial.print(report);
+    Serial.printf("Boot complete at %lu ms\n", (unsigned long)(loadProfile.getEndTime() / 1000));
+    serialCommands.sendMemoryReport();
+}
+
+#ifndef DISPLAY_EPD
+/**
+ * @brief Handle dial input while the sample text editor is open
+ * @return false for events handled as usual
+ *
+ * The dial turns the picker, a click commits the picked entry and a hold
+ * applies the text. Edit input is not recorded by inputSession.
+ */
+static bool handleEditEvent(const Event &event)
+{
+    switch (event.type)
+    {
+    case EVENT_ENCODER:
+        editSession.onEncoder(event.value);
+        return true;
+
+    case EVENT_BUTTON_CLICK:
+        if (editSession.commit())
+        {
+            uint32_t drawMicros;
+            uint32_t layoutMicros = editSession.getLastTiming(drawMicros);
+            const EditStats &stats = editSession.getEditor().getStats();
+            Serial.printf("Edit: layout %lu us (%u lines), draw %lu us (%u damaged)\n", (unsigned long)layoutMicros,
+                          stats.linesBroken, (unsigned long)drawMicros, stats.damageCount);
+        }
+        return true;
+
+    case EVENT_BUTTON_HOLD:
+        fontManager.setSampleText(editSession.finish());
+        fontManager.rebaseEncoder(encoder.getPosition());
+        fontManager.forceUpdate();
+        updateDisplay(event.time);
+
+        Serial.print("Text: ");
+        Serial.println(fontManager.getSampleText());
+        return true;
+
+    case EVENT_TOUCH:
+        return true;
+
+    default:
+        return false;
+    }
+}
+#endif
+
+static void handleEvent(const Event &event)
+{
+#ifndef DISPLAY_EPD
+    if (editSession.isActive() && handleEditEvent(event))
+    {
+        return;
+    }
+#endif
+
+    switch (event.type)
+    {
+    case EVENT_ENCODER:
+        inputSession.onEncoder(event.value, event.time);
+        updateDisplay(event.time);
+
+        // Print current font info when encoder changes
+        if (fontManager.isOverviewMode())
+        {
+            Serial.printf("Page %d/%d - %lu us\n", fontManager.getCurrentPage() + 1,
+                          fontManager.getPageCount(), fontManager.getLastFrameTime());
+        }
+        else
+        {
+            Serial.print(fontManager.getCurrentFamilyName());
+            Serial.print(" - ");
+            Serial.println(fontManager.getCurrentFontName());
+        }
+        break;
+
+    case EVENT_BUTTON_HOLD:
+        inputSession.onButton(INPUT_HOLD, event.time);
+        fontManager.setOverviewMode(!fontManager.isOverviewMode());
+        updateDisplay(event.time);
+
+        Serial.printf("Overview %s - %lu us\n", fontManager.isOverviewMode() ? "on" : "off",
+                      fontManager.getLastFrameTime());
+        break;
+
+    case EVENT_BUTTON_CLICK:
+        if (!bootComplete)
+        {
+            break; // Sample texts are still loading
+        }
+        inputSession.onButton(INPUT_CLICK, event.time);
+        fontManager.setSampleText(sampleTextStore.selectNext());
+        fontManager.forceUpdate();
+        updateDisplay(event.time);
+
+        Serial.print("Text: ");
+        Serial.println(fontManager.getSampleText());
+        break;
+
+    case EVENT_TOUCH:
+#ifndef DISPLAY_EPD
+        // The editor needs one font; overview pages show several
+        if (!fontManager.isOverviewMode())
+        {
+            editSession.begin(fontManager.getCurrentFontPtr(), fontManager.getSampleText(), encoder.getPosition());
+            Serial.println("Edit: turn to pick, click to type, hold to finish");
+        }
+#endif
+        break;
+
+    case EVENT_SERIAL:
+        // FONT and TEXT only mark the display as changed; draw it here
+        serialCommands.poll();
+        updateDisplay(event.time);
+        break;
+
+    case EVENT_TIMER:
+        if (event.value == TIMER_FRAME)
+        {
+            updateDisplay(event.time);
+        }
+#ifdef DISPLAY_EPD
+        else if (event.value == TIMER_REFRESH)
+        {
+            // Re-arms itself while the panel is busy or more damage is pending
+            epdDevice.service();
+            scheduleRefresh(event.time);
+        }
+#endif
+        // Button and serial timers only wake the loop so pollInputs() runs
+        break;
+
+    default:
+        break;
+    }
+}
+
 void setup()
 {
+    // Timestamps count from reset, so the first phase covers the bootloader and runtime start
+    setupProfile.begin(0);
     Serial.begin(115200);
 
     // Initialize M5Dial device
     m5DialDevice.begin();
-
-    delay(1000);
+    setupProfile.mark("startup", micros());
 
     Serial.println();
     Serial.println(STARTUP_MESSAGE_VERSION);
 
-    // Show startup screen
+    // Show startup screen while the rest of the boot runs
     m5DialDevice.showStartupMessage("LovyanGFX Font Display");
-    delay(2500);
+    unsigned long splashShown = millis();
+    setupProfile.mark("splash", micros());
+
+    bootEvents = xEventGroupCreate();
+    xTaskCreatePinnedToCore(bootTask, "boot", 8192, nullptr, 1, nullptr, 0);
 
-    // Setup encoder
+    // Setup encoder; its interrupts and the button's wake the idle loop
     encoder.setup();
+    encoder.setChangeCallback(M5DialDevice::notifyFromISR);
+    m5DialDevice.beginEventWait();
+    scheduler.setIdleTimeouts(IDLE_DIM_MS, IDLE_SLEEP_MS);
 
-    // Initialize font manager with device interface and sample text
+    // Initialize font manager with device interface and a built-in sample
+    // text; the loaded texts are adopted in finishBoot()
+    fontManager.setClock(clockMicros);
+#ifdef DISPLAY_EPD
+    // Draw to an e-paper panel instead; transitions are replaced by refresh batching
+    epdDevice.begin();
+    fontManager.setDevice(&epdDevice);
+    fontManager.setSampleText(SampleTextStore::getDefaultText());
+    fontManager.setTransitionsEnabled(false);
+#elif defined(FANOUT_DISPLAY)
+    // Lay each frame out once and draw it on the dial and on the mirror, each on its own task
+    fanoutDevice.begin(m5DialDevice.getDisplayWidth(), m5DialDevice.getDisplayHeight());
+    dialTarget.setLock(M5DialDevice::lockDisplay, M5DialDevice::unlockDisplay);
+    fanoutDevice.addTarget(dialTarget);
+    mirrorCanvas.setColorDepth(16);
+    mirrorCanvas.setPsram(true);
+    if (mirrorCanvas.createSprite(FANOUT_MIRROR_WIDTH, FANOUT_MIRROR_HEIGHT) != nullptr)
+    {
+        memoryTracker.recordAlloc(MEM_SPRITES, mirrorCanvas.getBuffer(), mirrorCanvas.bufferLength());
+        fanoutDevice.addTarget(mirrorTarget);
+    }
+    fontManager.setDevice(&fanoutDevice);
+    fontManager.setSampleText(SampleTextStore::getDefaultText());
+    fontManager.setTransitionsEnabled(false);
+#else
     fontManager.setDevice(&m5DialDevice);
-    fontManager.setSampleText("Hello World!");
+    fontManager.setSampleText(SampleTextStore::getDefaultText());
+    fontManager.setTransitionsEnabled(true);
+    fontManager.setPreviewsEnabled(true);
+#endif
+
+    // Remote control and screenshots over the same serial link
+    serialCommands.begin(serialStream, m5DialDevice);
+    setupProfile.mark("input", micros());
+
+    for (int i = 0; i < BOOT_WARM_FONTS && i < fontManager.getTotalFonts(); i++)
+    {
+        m5DialDevice.warmFontCache(fontManager.getFontAt(i)->fontPtr, fontManager.getSampleText());
+    }
+    setupProfile.mark("warm caches", micros());
+
+    long splashRemaining = (long)BOOT_MIN_SPLASH_MS - (long)(millis() - splashShown);
+    if (splashRemaining > 0)
+    {
+        delay(splashRemaining);
+    }
+    setupProfile.mark("splash hold", micros());
 
-    Serial.println("Setup complete! Total fonts: " + String(fontManager.getTotalFamilies()));
+    // First frame; after this the loop only draws in response to events
+    updateDisplay(millis());
+    scheduler.noteActivity(millis());
+    setupProfile.mark("first frame", micros());
+
+    Serial.printf("Setup complete! Total fonts: %d\n", fontManager.getTotalFamilies());
     Serial.println("=== Ready ===");
 }
 
-void loop()
+// runLoopStep() hooks on the M5Dial
+static uint32_t clockMillis()
 {
-    m5DialDevice.update();
+    return millis();
+}
 
-    // Check if encoder position changed
-    if (encoder.hasPositionChanged())
+static void applyPowerState(EventScheduler::PowerState state)
+{
+    m5DialDevice.setPowerState(state);
+}
+
+// Lines the boot and thumbnail tasks logged, between two command replies
+static void writeBackgroundLog()
+{
+    char logText[128];
+    size_t logLength;
+    while ((logLength = backgroundLog.read(logText, sizeof(logText))) > 0)
     {
-        long position = encoder.getPosition();
+        Serial.write(reinterpret_cast<const uint8_t *>(logText), logLength);
+    }
+}
 
-        // Update font display based on encoder position
-        fontManager.update(position);
+static void waitForEvent(uint32_t timeoutMs)
+{
+    m5DialDevice.waitForEvent(timeoutMs);
+}
 
-        // Print current font info when encoder changes
-        Serial.println(fontManager.getCurrentFamilyName() + " - " + fontManager.getCurrentFontName());
-    }
-
-    // Handle button press to change sample text
-    if (M5.BtnA.wasPressed())
-    {
-        static int textIndex = 0;
-
-        const char *sampleTexts[] = {
-            "Hello World!",
-            "Font Demo",
-            "M5Dial",
-            "12345",
-            "ABC abc",
-            // https://en.wikipedia.org/wiki/Pangram
-            "Pack my box with five dozen liquor jugs",
-            "The quick brown fox jumps over the lazy dog",
-            "Glib jocks quiz nymph to vex dwarf.",
-            "Sphinx of black quartz, judge my vow.",
-            "How vexingly quick daft zebras jump!",
-            "The five boxing wizards jump quickly.",
-            "Jackdaws love my big sphinx of quartz."};
-
-        textIndex = (textIndex + 1) % 12;
-        fontManager.setSampleText(sampleTexts[textIndex]);
-        fontManager.forceUpdate();
+static const LoopHooks loopHooks = {clockMillis, pollInputs, handleEvent, applyPowerState, writeBackgroundLog,
+                                    waitForEvent};
 
-        Serial.println("Text: " + String(sampleTexts[textIndex]));
+void loop()
+{
+    if (!bootComplete && (xEventGroupGetBits(bootEvents) & BOOT_DONE))
+    {
+        finishBoot();
     }
-}
\ No newline at end of file
+    if (xEventGroupGetBits(bootEvents) & THUMBNAILS_DONE)
+    {
+        finishThumbnails();
+    }
+
+    // Inputs and events, then dim or sleep, then block until the next input or timer
+    runLoopStep(scheduler, loopHooks);
+}
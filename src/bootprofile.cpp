@@ -0,0 +1,62 @@
+/**
+ * @file bootprofile.cpp
+ * @brief Boot phase timing report
+ * @date 2026-10-19
+ */
+
+#include "bootprofile.hpp"
+#include <stdio.h>
+
+BootProfile::BootProfile(const char *profileTitle) : title(profileTitle),
+                                                     phases(),
+                                                     phaseCount(0),
+                                                     phaseStart(0)
+{
+}
+
+void BootProfile::begin(uint32_t nowMicros)
+{
+    phaseCount = 0;
+    phaseStart = nowMicros;
+}
+
+void BootProfile::mark(const char *name, uint32_t nowMicros)
+{
+    if (phaseCount < MAX_PHASES)
+    {
+        phases[phaseCount].name = name;
+        phases[phaseCount].start = phaseStart;
+        phases[phaseCount].end = nowMicros;
+        phaseCount++;
+    }
+    phaseStart = nowMicros;
+}
+
+int BootProfile::getPhaseCount() const
+{
+    return phaseCount;
+}
+
+uint32_t BootProfile::getEndTime() const
+{
+    return phaseCount > 0 ? phases[phaseCount - 1].end : phaseStart;
+}
+
+size_t BootProfile::format(char *buffer, size_t size) const
+{
+    if (buffer == nullptr || size == 0)
+    {
+        return 0;
+    }
+
+    size_t used = snprintf(buffer, size, "%s\n", title);
+    for (int i = 0; i < phaseCount && used < size; i++)
+    {
+        const Phase &phase = phases[i];
+        uint32_t duration = phase.end - phase.start;
+        used += snprintf(buffer + used, size - used, "  %-14s at %5lu.%lu ms  +%lu.%lu ms\n", phase.name,
+                         (unsigned long)(phase.start / 1000), (unsigned long)(phase.start % 1000 / 100),
+                         (unsigned long)(duration / 1000), (unsigned long)(duration % 1000 / 100));
+    }
+    return used < size ? used : size - 1; // Truncated to fit
+}
@@ -0,0 +1,81 @@
+/**
+ * @file bootprofile.hpp
+ * @brief Boot phase timing report
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies; timestamps are passed in by the
+ * caller and the report is formatted into a buffer, so a host build can
+ * produce the same report as the device.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class BootProfile
+ * @brief Records consecutive named boot phases of one task
+ *
+ * Each mark() ends the phase that began at the previous mark (or at begin()).
+ * A profile is written by a single task; use one profile per task when boot
+ * work runs in parallel.
+ */
+class BootProfile
+{
+public:
+    static const int MAX_PHASES = 12;
+
+private:
+    struct Phase
+    {
+        const char *name; // Must outlive the profile (string literals)
+        uint32_t start;   // Microseconds
+        uint32_t end;
+    };
+
+    const char *title;
+    Phase phases[MAX_PHASES];
+    int phaseCount;
+    uint32_t phaseStart;
+
+public:
+    /**
+     * @brief Constructor
+     * @param profileTitle Heading printed above the phases
+     */
+    BootProfile(const char *profileTitle);
+
+    /**
+     * @brief Start timing; the first phase begins here
+     * @param nowMicros Current time in microseconds (0 = time since reset)
+     */
+    void begin(uint32_t nowMicros);
+
+    /**
+     * @brief End the current phase and start the next one
+     * @param name Phase name
+     * @param nowMicros Current time in microseconds
+     */
+    void mark(const char *name, uint32_t nowMicros);
+
+    /**
+     * @brief Get the number of recorded phases
+     * @return Phase count
+     */
+    int getPhaseCount() const;
+
+    /**
+     * @brief Get when the last recorded phase ended
+     * @return Timestamp in microseconds, or the begin() time with no phases
+     */
+    uint32_t getEndTime() const;
+
+    /**
+     * @brief Format the report, one line per phase with start time and duration
+     * @param buffer Output buffer
+     * @param size Buffer size
+     * @return Characters written, excluding the terminator
+     */
+    size_t format(char *buffer, size_t size) const;
+};
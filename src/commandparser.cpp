@@ -0,0 +1,103 @@
+/**
+ * @file commandparser.cpp
+ * @brief Line assembly and tokenizing for the serial command protocol
+ * @date 2026-10-19
+ */
+
+#include "commandparser.hpp"
+
+CommandParser::CommandParser() : line(),
+                                 length(0),
+                                 discarding(false),
+                                 overflowed(false),
+                                 command(""),
+                                 argument("")
+{
+}
+
+bool CommandParser::feed(char c)
+{
+    if (c == '\r')
+    {
+        return false;
+    }
+
+    if (c != '\n')
+    {
+        if (length < MAX_LINE)
+        {
+            line[length++] = c;
+        }
+        else
+        {
+            discarding = true;
+        }
+        return false;
+    }
+
+    line[length] = 0;
+    length = 0;
+    overflowed = discarding;
+    discarding = false;
+
+    if (overflowed)
+    {
+        command = "";
+        argument = "";
+        return true;
+    }
+
+    // Split at the first space and upper-case the command word
+    char *p = line;
+    while (*p == ' ')
+    {
+        p++;
+    }
+    command = p;
+    while (*p != 0 && *p != ' ')
+    {
+        if (*p >= 'a' && *p <= 'z')
+        {
+            *p -= 'a' - 'A';
+        }
+        p++;
+    }
+    if (*p == ' ')
+    {
+        *p++ = 0;
+    }
+    argument = p;
+    return true;
+}
+
+bool CommandParser::wasOverflowed() const
+{
+    return overflowed;
+}
+
+const char *CommandParser::getCommand() const
+{
+    return command;
+}
+
+const char *CommandParser::getArgument() const
+{
+    return argument;
+}
+
+bool CommandParser::getIntArgument(long &value) const
+{
+    const char *p = argument;
+    if (*p < '0' || *p > '9')
+    {
+        return false;
+    }
+
+    value = 0;
+    while (*p >= '0' && *p <= '9')
+    {
+        value = value * 10 + (*p - '0');
+        p++;
+    }
+    return *p == 0;
+}
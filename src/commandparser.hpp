@@ -0,0 +1,73 @@
+/**
+ * @file commandparser.hpp
+ * @brief Line assembly and tokenizing for the serial command protocol
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+/**
+ * @class CommandParser
+ * @brief Collects bytes into lines and splits them into command and argument
+ *
+ * A line is a command word, optionally followed by a space and an argument
+ * that runs to the end of the line (so TEXT can carry spaces). Lines end with
+ * LF or CR LF; over-long lines are discarded and reported as overflowed.
+ * The command and argument point into the line buffer, so handle them before
+ * feeding the next byte.
+ */
+class CommandParser
+{
+public:
+    static const size_t MAX_LINE = 300;
+
+private:
+    char line[MAX_LINE + 1];
+    size_t length;
+    bool discarding;  // The line being received is too long
+    bool overflowed;  // The completed line was too long
+    const char *command;
+    const char *argument;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    CommandParser();
+
+    /**
+     * @brief Add one received byte
+     * @param c Received byte
+     * @return true when a complete line is ready to inspect
+     */
+    bool feed(char c);
+
+    /**
+     * @brief Check whether the completed line was too long
+     * @return true if the line was discarded
+     */
+    bool wasOverflowed() const;
+
+    /**
+     * @brief Get the command word of the completed line, upper-cased
+     * @return Command word, empty for a blank line
+     */
+    const char *getCommand() const;
+
+    /**
+     * @brief Get the argument of the completed line
+     * @return Everything after the first space, empty if none
+     */
+    const char *getArgument() const;
+
+    /**
+     * @brief Parse the argument as a non-negative decimal integer
+     * @param value Output value
+     * @return true if the whole argument was a number
+     */
+    bool getIntArgument(long &value) const;
+};
@@ -0,0 +1,311 @@
+/**
+ * @file devicecommands.cpp
+ * @brief Serial commands that need the M5Dial hardware
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ *
+ * The SerialCommands members that use the input session, the editor, the
+ * sprites, the TrueType rasterizer, the fan-out or the ESP32 heap; the
+ * protocol itself is in serialcommands.cpp.
+ */
+
+#include <Arduino.h>
+#include "serialcommands.hpp"
+#include "editsession.hpp"
+#include "encoder.hpp"
+#ifdef FANOUT_DISPLAY
+#include "fanoutdevice.hpp"
+#endif
+#include "fontmanager.hpp"
+#include "inputsession.hpp"
+#include "m5dial.hpp"
+#include "scalablefont.hpp"
+#include <esp_heap_caps.h>
+#include <stdlib.h>
+#include <string.h>
+
+void SerialCommands::startRecording()
+{
+    inputSession.startRecording(millis());
+    stream->println("OK");
+}
+
+/**
+ * Reply format:
+ *   "OK <inputs> <log bytes>", followed by " full" if the log overflowed
+ */
+void SerialCommands::sendRecordingStop()
+{
+    inputSession.stopRecording();
+    const InputLog &log = inputSession.getLog();
+    stream->printf("OK %u %u%s\n", (unsigned)log.getCount(), (unsigned)log.getSize(),
+                   log.wasOverflowed() ? " full" : "");
+}
+
+void SerialCommands::openEditor()
+{
+#ifdef DISPLAY_EPD
+    stream->println("ERR no editor on e-paper");
+#else
+    if (fontManager.isOverviewMode() || editSession.isActive())
+    {
+        stream->println("ERR not on a single font");
+        return;
+    }
+    editSession.begin(fontManager.getCurrentFontPtr(), fontManager.getSampleText(), encoder.getPosition());
+    stream->println("OK");
+#endif
+}
+
+/**
+ * Reply format:
+ *   "PUSH <bpp> <buffer bytes> <us per frame> <kpixels per second>" for the
+ *   frame sprite, then the same for an RGB565 copy of it (us 0 if it could not
+ *   be allocated), then "OK <bytes saved>"
+ */
+void SerialCommands::sendPushTiming()
+{
+    static const long DEFAULT_REPEATS = 20;
+    long repeats = DEFAULT_REPEATS;
+    if (*parser.getArgument() != 0 && (!parser.getIntArgument(repeats) || repeats <= 0))
+    {
+        stream->println("ERR repeat count");
+        return;
+    }
+
+    M5DialDevice::PushTiming frame;
+    M5DialDevice::PushTiming rgb565;
+    fontManager.render(); // Puts the current font in the frame sprite
+    if (!m5DialDevice.measurePush(repeats, frame, rgb565))
+    {
+        stream->println("ERR no frame sprite");
+        return;
+    }
+
+    const uint32_t pixels = m5DialDevice.getDisplayWidth() * m5DialDevice.getDisplayHeight();
+    for (const M5DialDevice::PushTiming *timing : {&frame, &rgb565})
+    {
+        unsigned long rate = timing->frameMicros > 0 ? (unsigned long)((uint64_t)pixels * 1000 / timing->frameMicros) : 0;
+        stream->printf("PUSH %d %lu %lu %lu\n", timing->colorDepth, (unsigned long)timing->bufferBytes,
+                       (unsigned long)timing->frameMicros, rate);
+    }
+    stream->printf("OK %ld\n", (long)rgb565.bufferBytes - (long)frame.bufferBytes);
+}
+
+/**
+ * Reply format:
+ *   "TTF FACE <slot> <file bytes> <glyphs> <units per em>" per loaded face,
+ *   "TTF CACHE <glyphs> <bytes> <hits> <misses> <evictions>",
+ *   then "OK <faces>"
+ */
+void SerialCommands::sendTrueTypeInfo()
+{
+    int loaded = 0;
+    for (int i = 0; i < ScalableFontLibrary::MAX_FACES; i++)
+    {
+        const TrueTypeFace *face = scalableFonts.getFace(i);
+        if (face != nullptr)
+        {
+            stream->printf("TTF FACE %d %u %u %d\n", i, (unsigned)scalableFonts.getFaceSize(i),
+                           (unsigned)face->getGlyphCount(), face->getMetrics().unitsPerEm);
+            loaded++;
+        }
+    }
+
+    GlyphCache::Stats stats = scalableFonts.getCacheStats();
+    stream->printf("TTF CACHE %u %u %lu %lu %lu\n", (unsigned)stats.entries, (unsigned)stats.bytes,
+                   (unsigned long)stats.hits, (unsigned long)stats.misses, (unsigned long)stats.evictions);
+    stream->printf("OK %d\n", loaded);
+}
+
+/**
+ * Draws the sample text on one line into an off-screen RGB565 sprite, with
+ * face 0 at the given size: first with an empty glyph cache, then again
+ * from the cache, then in the current catalog font for reference.
+ *
+ * Reply format:
+ *   "TTF COLD <us> <glyphs rasterized> <rasterizer us>"
+ *   "TTF WARM <us> <cache hits>"
+ *   "TTF REF <us> <font name>"
+ *   then "OK <px> <glyph cache bytes>"
+ */
+void SerialCommands::sendTrueTypeBenchmark()
+{
+    const char *argument = parser.getArgument() + 5;
+    char *end;
+    long pixels = strtol(argument, &end, 10);
+    if (end == argument || pixels < 4 || pixels > 200)
+    {
+        stream->println("ERR pixel size");
+        return;
+    }
+    if (scalableFonts.getFace(0) == nullptr)
+    {
+        stream->println("ERR no face loaded");
+        return;
+    }
+
+    const ScalableFont font(0, pixels);
+    const lgfx::IFont *reference = static_cast<const lgfx::IFont *>(fontManager.getCurrentFontPtr());
+    const char *text = fontManager.getSampleText();
+
+    M5Canvas canvas(&M5.Display);
+    canvas.setColorDepth(16);
+    canvas.setPsram(true);
+    if (canvas.createSprite(m5DialDevice.getDisplayWidth(), pixels * 2) == nullptr)
+    {
+        stream->println("ERR no memory");
+        return;
+    }
+    canvas.setTextColor(WHITE);
+
+    // Time one drawString() of text in font
+    auto timeDraw = [&](const lgfx::IFont *drawFont)
+    {
+        canvas.fillSprite(BLACK);
+        canvas.setFont(drawFont);
+        uint32_t start = micros();
+        canvas.drawString(text, 0, 0);
+        return (unsigned long)(micros() - start);
+    };
+
+    scalableFonts.clearCache();
+    scalableFonts.resetTiming();
+    unsigned long cold = timeDraw(&font);
+    uint32_t rasterized;
+    uint32_t rasterizeMicros = scalableFonts.getRasterizeMicros(rasterized);
+    unsigned long warm = timeDraw(&font);
+    GlyphCache::Stats stats = scalableFonts.getCacheStats();
+    unsigned long referenceMicros = (reference != nullptr) ? timeDraw(reference) : 0;
+    canvas.deleteSprite();
+
+    stream->printf("TTF COLD %lu %lu %lu\n", cold, (unsigned long)rasterized, (unsigned long)rasterizeMicros);
+    stream->printf("TTF WARM %lu %lu\n", warm, (unsigned long)stats.hits);
+    stream->printf("TTF REF %lu %s\n", referenceMicros, fontManager.getCurrentFontName());
+    stream->printf("OK %ld %u\n", pixels, (unsigned)stats.bytes);
+}
+
+/**
+ * Reply format:
+ *   "LOG <bytes>" then the serialized log as hex, 64 bytes per line,
+ *   then "OK <inputs>"
+ */
+void SerialCommands::sendInputLog()
+{
+    static const size_t BYTES_PER_LINE = 64;
+    const InputLog &log = inputSession.getLog();
+    const uint8_t *data = log.getData();
+    char hex[BYTES_PER_LINE * 2 + 1];
+
+    stream->printf("LOG %u\n", (unsigned)log.getSize());
+    for (size_t offset = 0; offset < log.getSize(); offset += BYTES_PER_LINE)
+    {
+        size_t length = log.getSize() - offset;
+        length = length < BYTES_PER_LINE ? length : BYTES_PER_LINE;
+        for (size_t i = 0; i < length; i++)
+        {
+            snprintf(hex + i * 2, 3, "%02x", data[offset + i]);
+        }
+        stream->println(hex);
+    }
+    stream->printf("OK %u\n", (unsigned)log.getCount());
+}
+
+/**
+ * Reply format:
+ *   "LATENCY n=<inputs> p50=<us> p95=<us> p99=<us> max=<us> transitions=<on|off>"
+ *   then "OK <inputs> <frames> <replayed ms>"
+ */
+void SerialCommands::sendReplayLatency()
+{
+    ReplayResult result;
+    if (!inputSession.replay(result))
+    {
+        stream->println("ERR nothing to replay");
+        return;
+    }
+
+    char line[96];
+    inputSession.getLatency().format(line, sizeof(line));
+    stream->printf("LATENCY %s transitions=%s\n", line, inputSession.wereTransitionsReplayed() ? "on" : "off");
+    stream->printf("OK %u %u %lu\n", (unsigned)result.inputs, (unsigned)result.frames,
+                   (unsigned long)result.virtualTimeMs);
+}
+
+/**
+ * Reply format:
+ *   "KEYS LAYOUT n=<keystrokes> p50=<us> p95=<us> p99=<us> max=<us>", line breaking per keystroke
+ *   "KEYS DRAW n=<keystrokes> p50=<us> p95=<us> p99=<us> max=<us>", redraw per keystroke
+ *   then "OK <glyphs> <lines>" for the text in the editor
+ */
+void SerialCommands::sendEditTiming()
+{
+    char line[96];
+    editSession.getLayoutLatency().format(line, sizeof(line));
+    stream->printf("KEYS LAYOUT %s\n", line);
+    editSession.getDrawLatency().format(line, sizeof(line));
+    stream->printf("KEYS DRAW %s\n", line);
+
+    const TextEditor &editor = editSession.getEditor();
+    stream->printf("OK %u %u\n", (unsigned)editor.getGlyphCount(), (unsigned)editor.getLineCount());
+}
+
+/**
+ * Reply format:
+ *   per target: "FAN <index> <name> <width>x<height> <frames> <skipped> <last us>"
+ *   followed by "FAN <index> n=<frames> p50=<us> p95=<us> p99=<us> max=<us>", replay time per frame
+ *   then "OK <targets>"; no targets unless built with FANOUT_DISPLAY
+ */
+void SerialCommands::sendFanoutTiming()
+{
+#ifdef FANOUT_DISPLAY
+    DisplayFanout &fanout = fanoutDevice.getFanout();
+    char line[96];
+    for (int i = 0; i < fanout.getTargetCount(); i++)
+    {
+        const DisplayTarget &target = fanout.getTarget(i);
+        FanoutTargetStats stats = fanout.getStats(i);
+        stream->printf("FAN %d %s %dx%d %lu %lu %lu\n", i, target.getName(), target.getWidth(), target.getHeight(),
+                       (unsigned long)stats.frames, (unsigned long)stats.skipped, (unsigned long)stats.lastMicros);
+        fanout.formatLatency(i, line, sizeof(line));
+        stream->printf("FAN %d %s\n", i, line);
+    }
+    stream->printf("OK %d\n", fanout.getTargetCount());
+#else
+    stream->println("OK 0");
+#endif
+}
+
+void SerialCommands::resetFanout()
+{
+#ifdef FANOUT_DISPLAY
+    fanoutDevice.getFanout().resetStats();
+#endif
+    stream->println("OK");
+}
+
+/**
+ * Reply format:
+ *   "HEAP <region> free <bytes> min <bytes> total <bytes>" for sram and psram,
+ *   where min is the lowest free size since boot (the heap's high-water mark)
+ */
+void SerialCommands::sendHeapReport()
+{
+    const struct
+    {
+        const char *name;
+        uint32_t caps;
+    } regions[] = {{"sram", MALLOC_CAP_INTERNAL}, {"psram", MALLOC_CAP_SPIRAM}};
+    for (const auto &region : regions)
+    {
+        stream->printf("HEAP %s free %u min %u total %u\n", region.name,
+                       (unsigned)heap_caps_get_free_size(region.caps),
+                       (unsigned)heap_caps_get_minimum_free_size(region.caps),
+                       (unsigned)heap_caps_get_total_size(region.caps));
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * @file displayfanout.cpp
+ * @brief Replays each display list to several targets, each on its own thread
+ * @date 2026-10-19
+ */
+
+#include "displayfanout.hpp"
+#include <chrono>
+
+DisplayFanout::DisplayFanout(ClockFunc clockFunc) : slots(),
+                                                    targets(),
+                                                    targetCount(0),
+                                                    building(-1),
+                                                    newest(-1),
+                                                    generation(0),
+                                                    stopping(false),
+                                                    clock(clockFunc)
+{
+}
+
+DisplayFanout::~DisplayFanout()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    frameReady.notify_all();
+    for (int i = 0; i < targetCount; i++)
+    {
+        targets[i].thread.join();
+    }
+}
+
+int DisplayFanout::addTarget(DisplayTarget &target)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (targetCount >= MAX_TARGETS)
+    {
+        return -1;
+    }
+
+    // A new target starts with the newest frame, if there is one
+    int index = targetCount++;
+    Target &entry = targets[index];
+    entry.target = &target;
+    entry.generation = (generation > 0) ? generation - 1 : 0;
+    entry.busy = false;
+    entry.stats = FanoutTargetStats();
+    entry.latency.clear();
+    entry.thread = std::thread(&DisplayFanout::run, this, index);
+    return index;
+}
+
+int DisplayFanout::getTargetCount() const
+{
+    return targetCount;
+}
+
+DisplayTarget &DisplayFanout::getTarget(int index) const
+{
+    return *targets[index].target;
+}
+
+void DisplayFanout::run(int index)
+{
+    Target &self = targets[index];
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        frameReady.wait(lock, [&] { return stopping || self.generation != generation; });
+        if (stopping)
+        {
+            return;
+        }
+
+        // Take the newest frame; the ones published in between are skipped
+        int slot = newest;
+        self.stats.skipped += generation - self.generation - 1;
+        self.generation = generation;
+        self.busy = true;
+        slots[slot].readers++;
+        lock.unlock();
+
+        uint32_t start = clock();
+        replayDisplayList(slots[slot].list, *self.target);
+        uint32_t elapsed = clock() - start;
+
+        lock.lock();
+        slots[slot].readers--;
+        self.busy = false;
+        self.stats.frames++;
+        self.stats.lastMicros = elapsed;
+        self.latency.add(elapsed);
+        frameDone.notify_all();
+    }
+}
+
+DisplayList &DisplayFanout::beginFrame(int width, int height)
+{
+    {
+        // A slot no target is drawing and that is not the newest frame; there
+        // are more slots than targets plus those two, so one is always free
+        std::lock_guard<std::mutex> lock(mutex);
+        building = 0;
+        while (slots[building].readers > 0 || building == newest)
+        {
+            building++;
+        }
+    }
+
+    DisplayList &list = slots[building].list;
+    list.reset(width, height);
+    return list;
+}
+
+void DisplayFanout::publish()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (building < 0)
+        {
+            return;
+        }
+        newest = building;
+        building = -1;
+        generation++;
+    }
+    frameReady.notify_all();
+}
+
+bool DisplayFanout::waitIdle(uint32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    return frameDone.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                              [&]
+                              {
+                                  for (int i = 0; i < targetCount; i++)
+                                  {
+                                      if (targets[i].busy || targets[i].generation != generation)
+                                      {
+                                          return false;
+                                      }
+                                  }
+                                  return true;
+                              });
+}
+
+FanoutTargetStats DisplayFanout::getStats(int index)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return targets[index].stats;
+}
+
+void DisplayFanout::formatLatency(int index, char *buffer, size_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    targets[index].latency.format(buffer, size);
+}
+
+void DisplayFanout::resetStats()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < targetCount; i++)
+    {
+        targets[i].stats = FanoutTargetStats();
+        targets[i].latency.clear();
+    }
+}
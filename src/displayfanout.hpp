@@ -0,0 +1,154 @@
+/**
+ * @file displayfanout.hpp
+ * @brief Replays each display list to several targets, each on its own thread
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies: standard threads, which the ESP32
+ * runs as FreeRTOS tasks, and a clock function passed in, so two headless
+ * targets can be driven and timed on a host.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "displaylist.hpp"
+#include "inputlog.hpp"
+
+// Counters of one target, see DisplayFanout::getStats()
+struct FanoutTargetStats
+{
+    uint32_t frames;     // Frames drawn
+    uint32_t skipped;    // Newer frames arrived while the target was busy, so these were never drawn
+    uint32_t lastMicros; // Replay time of the last frame
+};
+
+/**
+ * @class DisplayFanout
+ * @brief Hands every published DisplayList to all targets without waiting for them
+ *
+ * The producer fills the list from beginFrame() and publishes it. Each
+ * target's thread draws the newest published list whenever it is free, so a
+ * slow panel skips frames instead of holding up the producer or the other
+ * targets. Lists are recycled from a fixed pool: every target holds at most
+ * one, plus the newest and the one being built.
+ */
+class DisplayFanout
+{
+public:
+    static const int MAX_TARGETS = 4;
+    typedef uint32_t (*ClockFunc)(); // Microseconds
+
+private:
+    static const int SLOT_COUNT = MAX_TARGETS + 2;
+
+    struct Slot
+    {
+        DisplayList list;
+        int readers; // Targets drawing this list
+    };
+
+    struct Target
+    {
+        DisplayTarget *target;
+        std::thread thread;
+        uint32_t generation; // Last frame taken
+        bool busy;
+        FanoutTargetStats stats;
+        LatencyStats latency;
+    };
+
+    Slot slots[SLOT_COUNT];
+    Target targets[MAX_TARGETS];
+    int targetCount;
+    int building;        // Slot returned by beginFrame(), -1 if none
+    int newest;          // Slot of the newest published frame, -1 before the first
+    uint32_t generation; // Number of frames published
+    bool stopping;
+    ClockFunc clock;
+    std::mutex mutex;
+    std::condition_variable frameReady; // Targets wait here for a new frame
+    std::condition_variable frameDone;  // waitIdle() waits here
+
+    void run(int index);
+
+public:
+    /**
+     * @brief Constructor
+     * @param clockFunc Clock the replay time of each frame is measured with
+     */
+    DisplayFanout(ClockFunc clockFunc);
+
+    /**
+     * @brief Destructor - stops the target threads
+     */
+    ~DisplayFanout();
+
+    /**
+     * @brief Register a target and start its thread
+     * @param target Target to draw on; must outlive the fan-out
+     * @return Target index, -1 if MAX_TARGETS are registered
+     *
+     * Thread attributes (stack size, core) are the platform defaults; on the
+     * ESP32 set them with esp_pthread_set_cfg() first.
+     */
+    int addTarget(DisplayTarget &target);
+
+    /**
+     * @brief Get the number of registered targets
+     * @return Target count
+     */
+    int getTargetCount() const;
+
+    /**
+     * @brief Get a registered target
+     * @param index Target index
+     * @return Target
+     */
+    DisplayTarget &getTarget(int index) const;
+
+    /**
+     * @brief Get a free list for the next frame
+     * @param width Width of the frame's coordinate space
+     * @param height Height of the frame's coordinate space
+     * @return Empty list, owned by the fan-out until publish()
+     *
+     * Call from one producer thread only.
+     */
+    DisplayList &beginFrame(int width, int height);
+
+    /**
+     * @brief Make the list from beginFrame() the frame every target draws next
+     */
+    void publish();
+
+    /**
+     * @brief Block until every target has drawn the newest frame
+     * @param timeoutMs Longest time to wait
+     * @return false on timeout
+     */
+    bool waitIdle(uint32_t timeoutMs);
+
+    /**
+     * @brief Get the counters of one target
+     * @param index Target index
+     * @return Frames drawn and skipped, last replay time
+     */
+    FanoutTargetStats getStats(int index);
+
+    /**
+     * @brief Write the replay time percentiles of one target
+     * @param index Target index
+     * @param buffer Destination buffer, see LatencyStats::format()
+     * @param size Size of buffer in bytes
+     */
+    void formatLatency(int index, char *buffer, size_t size);
+
+    /**
+     * @brief Reset the counters and latency samples of every target
+     */
+    void resetStats();
+};
@@ -0,0 +1,153 @@
+/**
+ * @file displaylist.cpp
+ * @brief A frame recorded as text runs and rectangles, replayed at any resolution
+ * @date 2026-10-19
+ */
+
+#include "displaylist.hpp"
+#include <math.h>
+#include <string.h>
+
+DisplayList::DisplayList() : width(0),
+                             height(0)
+{
+}
+
+void DisplayList::add(DisplayOpType type, int x, int y, int w, int h, uint16_t color)
+{
+    DisplayOp op;
+    op.type = type;
+    op.datum = 0;
+    op.color = color;
+    op.x = x;
+    op.y = y;
+    op.width = w;
+    op.height = h;
+    op.font = nullptr;
+    op.textOffset = 0;
+    ops.push_back(op);
+}
+
+void DisplayList::reset(int frameWidth, int frameHeight)
+{
+    ops.clear();
+    strings.clear();
+    width = frameWidth;
+    height = frameHeight;
+}
+
+void DisplayList::fill(uint16_t color)
+{
+    add(DISPLAY_FILL, 0, 0, width, height, color);
+}
+
+void DisplayList::fillRect(int x, int y, int w, int h, uint16_t color)
+{
+    add(DISPLAY_FILL_RECT, x, y, w, h, color);
+}
+
+void DisplayList::hline(int x, int y, int w, uint16_t color)
+{
+    add(DISPLAY_HLINE, x, y, w, 1, color);
+}
+
+void DisplayList::text(const void *font, const char *str, size_t length, int x, int y, uint8_t datum,
+                       uint16_t color)
+{
+    add(DISPLAY_TEXT, x, y, 0, 0, color);
+    DisplayOp &op = ops.back();
+    op.datum = datum;
+    op.font = font;
+    op.textOffset = strings.size();
+    strings.insert(strings.end(), str, str + length);
+    strings.push_back(0);
+}
+
+void DisplayList::text(const void *font, const char *str, int x, int y, uint8_t datum, uint16_t color)
+{
+    text(font, str, strlen(str), x, y, datum, color);
+}
+
+void DisplayList::clip(int x, int y, int w, int h)
+{
+    add(DISPLAY_CLIP, x, y, w, h, 0);
+}
+
+void DisplayList::unclip()
+{
+    add(DISPLAY_UNCLIP, 0, 0, 0, 0, 0);
+}
+
+int DisplayList::getWidth() const
+{
+    return width;
+}
+
+int DisplayList::getHeight() const
+{
+    return height;
+}
+
+size_t DisplayList::getCount() const
+{
+    return ops.size();
+}
+
+const DisplayOp &DisplayList::getOp(size_t index) const
+{
+    return ops[index];
+}
+
+const char *DisplayList::getText(const DisplayOp &op) const
+{
+    return strings.data() + op.textOffset;
+}
+
+void replayDisplayList(const DisplayList &list, DisplayTarget &target)
+{
+    if (list.getWidth() <= 0 || list.getHeight() <= 0)
+    {
+        return;
+    }
+
+    float scaleX = (float)target.getWidth() / list.getWidth();
+    float scaleY = (float)target.getHeight() / list.getHeight();
+    const float scale = (scaleX < scaleY) ? scaleX : scaleY;
+    const int offsetX = (target.getWidth() - (int)lroundf(list.getWidth() * scale)) / 2;
+    const int offsetY = (target.getHeight() - (int)lroundf(list.getHeight() * scale)) / 2;
+    auto mapX = [&](int x) { return offsetX + (int)lroundf(x * scale); };
+    auto mapY = [&](int y) { return offsetY + (int)lroundf(y * scale); };
+    auto mapSize = [&](int size)
+    {
+        int scaled = (int)lroundf(size * scale);
+        return (size > 0 && scaled < 1) ? 1 : scaled;
+    };
+
+    target.beginFrame();
+    for (size_t i = 0; i < list.getCount(); i++)
+    {
+        const DisplayOp &op = list.getOp(i);
+        switch (op.type)
+        {
+        case DISPLAY_FILL:
+            target.fill(op.color);
+            break;
+        case DISPLAY_FILL_RECT:
+            target.fillRect(mapX(op.x), mapY(op.y), mapSize(op.width), mapSize(op.height), op.color);
+            break;
+        case DISPLAY_HLINE:
+            target.drawHLine(mapX(op.x), mapY(op.y), mapSize(op.width), op.color);
+            break;
+        case DISPLAY_TEXT:
+            target.drawText(op.font, list.getText(op), mapX(op.x), mapY(op.y), op.datum, op.color, scale);
+            break;
+        case DISPLAY_CLIP:
+            target.setClip(mapX(op.x), mapY(op.y), mapSize(op.width), mapSize(op.height));
+            break;
+        case DISPLAY_UNCLIP:
+            target.clearClip();
+            break;
+        }
+    }
+    target.endFrame();
+}
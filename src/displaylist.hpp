@@ -0,0 +1,229 @@
+/**
+ * @file displaylist.hpp
+ * @brief A frame recorded as text runs and rectangles, replayed at any resolution
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. Fonts are opaque pointers and the
+ * text datum is a LovyanGFX textdatum_t value, so a list is built once and
+ * replayed to LovyanGFX panels on the device or to any DisplayTarget on a host.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "memorytracker.hpp"
+
+enum DisplayOpType : uint8_t
+{
+    DISPLAY_FILL = 0, // Whole frame
+    DISPLAY_FILL_RECT,
+    DISPLAY_HLINE, // width is the length
+    DISPLAY_TEXT,
+    DISPLAY_CLIP, // Later ops draw only inside x, y, width, height
+    DISPLAY_UNCLIP,
+};
+
+// LovyanGFX textdatum_t values, for lists built without LovyanGFX
+enum TextDatum : uint8_t
+{
+    DATUM_TOP_LEFT = 0,
+    DATUM_TOP_CENTER = 1,
+    DATUM_MIDDLE_LEFT = 4,
+    DATUM_MIDDLE_CENTER = 5,
+    DATUM_BOTTOM_CENTER = 9,
+};
+
+// One recorded drawing call, in the list's coordinates
+struct DisplayOp
+{
+    DisplayOpType type;
+    uint8_t datum;  // DISPLAY_TEXT: LovyanGFX textdatum_t the position refers to
+    uint16_t color; // RGB565
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    const void *font;    // DISPLAY_TEXT: lgfx::IFont on the device
+    uint32_t textOffset; // DISPLAY_TEXT: NUL-terminated text in the list's text pool
+};
+
+/**
+ * @class DisplayList
+ * @brief Drawing calls of one frame, with their positions and colors resolved
+ *
+ * Layout and measuring happen while the list is built; replaying it only
+ * draws. Both vectors keep their capacity across reset(), so rebuilding a
+ * frame does not touch the heap once the largest frame has been seen.
+ */
+class DisplayList
+{
+private:
+    std::vector<DisplayOp, TaggedAllocator<DisplayOp, MEM_DISPLAY_LIST>> ops;
+    std::vector<char, TaggedAllocator<char, MEM_DISPLAY_LIST>> strings; // Text of DISPLAY_TEXT ops
+    int width;
+    int height;
+
+    void add(DisplayOpType type, int x, int y, int w, int h, uint16_t color);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    DisplayList();
+
+    /**
+     * @brief Drop every op and start a frame
+     * @param frameWidth Width of the coordinate space ops are given in
+     * @param frameHeight Height of the coordinate space
+     */
+    void reset(int frameWidth, int frameHeight);
+
+    /**
+     * @brief Record a fill of the whole frame
+     * @param color RGB565 color
+     */
+    void fill(uint16_t color);
+
+    /**
+     * @brief Record a filled rectangle
+     * @param x Left edge
+     * @param y Top edge
+     * @param w Width
+     * @param h Height
+     * @param color RGB565 color
+     */
+    void fillRect(int x, int y, int w, int h, uint16_t color);
+
+    /**
+     * @brief Record a horizontal line
+     * @param x Left end
+     * @param y Row
+     * @param w Length
+     * @param color RGB565 color
+     */
+    void hline(int x, int y, int w, uint16_t color);
+
+    /**
+     * @brief Record a text run
+     * @param font Font to draw in
+     * @param str UTF-8 text
+     * @param length Bytes of str to draw
+     * @param x Anchor position
+     * @param y Anchor position
+     * @param datum LovyanGFX textdatum_t giving which point of the text the anchor is
+     * @param color RGB565 color
+     */
+    void text(const void *font, const char *str, size_t length, int x, int y, uint8_t datum, uint16_t color);
+
+    /**
+     * @brief Record a NUL-terminated text run
+     */
+    void text(const void *font, const char *str, int x, int y, uint8_t datum, uint16_t color);
+
+    /**
+     * @brief Limit the following ops to a rectangle
+     */
+    void clip(int x, int y, int w, int h);
+
+    /**
+     * @brief End the limit set by clip()
+     */
+    void unclip();
+
+    /**
+     * @brief Get the frame width
+     * @return Width given to reset()
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Get the frame height
+     * @return Height given to reset()
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Get the number of recorded ops
+     * @return Op count
+     */
+    size_t getCount() const;
+
+    /**
+     * @brief Get one op
+     * @param index Op index
+     * @return Op
+     */
+    const DisplayOp &getOp(size_t index) const;
+
+    /**
+     * @brief Get the text of a DISPLAY_TEXT op
+     * @param op Op of this list
+     * @return NUL-terminated UTF-8 text
+     */
+    const char *getText(const DisplayOp &op) const;
+};
+
+/**
+ * @class DisplayTarget
+ * @brief Somewhere a DisplayList can be drawn
+ *
+ * Coordinates arrive already scaled to the target; text comes with the scale
+ * factor, for targets that can enlarge glyphs.
+ */
+class DisplayTarget
+{
+public:
+    virtual ~DisplayTarget() = default;
+
+    /**
+     * @brief Get a name for reports
+     * @return Target name
+     */
+    virtual const char *getName() const = 0;
+
+    /**
+     * @brief Get the target width
+     * @return Width in pixels
+     */
+    virtual int getWidth() const = 0;
+
+    /**
+     * @brief Get the target height
+     * @return Height in pixels
+     */
+    virtual int getHeight() const = 0;
+
+    /**
+     * @brief Called before the first op of a frame
+     */
+    virtual void beginFrame()
+    {
+    }
+
+    /**
+     * @brief Called after the last op of a frame, e.g. to push a sprite
+     */
+    virtual void endFrame()
+    {
+    }
+
+    virtual void fill(uint16_t color) = 0;
+    virtual void fillRect(int x, int y, int w, int h, uint16_t color) = 0;
+    virtual void drawHLine(int x, int y, int w, uint16_t color) = 0;
+    virtual void drawText(const void *font, const char *text, int x, int y, uint8_t datum, uint16_t color,
+                          float scale) = 0;
+    virtual void setClip(int x, int y, int w, int h) = 0;
+    virtual void clearClip() = 0;
+};
+
+/**
+ * @brief Draw a list on a target, scaled to fit and centered
+ * @param list Recorded frame
+ * @param target Target to draw on
+ *
+ * The scale is the same on both axes, the smaller of the width and height
+ * ratios, so a round-panel frame stays round on a wide panel.
+ */
+void replayDisplayList(const DisplayList &list, DisplayTarget &target);
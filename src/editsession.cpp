@@ -0,0 +1,377 @@
+/**
+ * @file editsession.cpp
+ * @brief On-device sample text editor driven by the dial
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#include "editsession.hpp"
+#include <M5Unified.h>
+#ifdef FANOUT_DISPLAY
+#include "fanoutdevice.hpp"
+#endif
+#include "fontmanager.hpp"
+#include "m5dial.hpp"
+
+// Picker entries in dial order; the control characters stand for the actions below
+static const char PICKER[] = " abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+                             ".,!?'\"-:;()/&@#*+=%$_~<>[]{}|\\^`\n\b\x11\x12";
+static const int PICKER_COUNT = sizeof(PICKER) - 1;
+static const char PICK_DELETE = '\b';
+static const char PICK_LEFT = '\x11';
+static const char PICK_RIGHT = '\x12';
+static const int PICK_START = 1; // 'a'
+
+// Screen areas, for the 240x240 round panel
+static const int TEXT_LEFT = 10;
+static const int TEXT_TOP = 36;
+static const int PICKER_TOP = 196;
+static const int PICKER_HEIGHT = 24;
+static const int PICKER_SLOT = 30; // Width of one picker entry
+static const int PICKER_SIDE = 2;  // Entries shown either side of the picked one
+static const int CARET_WIDTH = 2;
+#ifdef FANOUT_DISPLAY
+static const uint32_t FANOUT_IDLE_MS = 500; // Longest wait for the fan-out to finish its frame
+#endif
+
+EditSession::EditSession() : editor(),
+                             widths(),
+                             font(nullptr),
+                             active(false),
+                             lastPosition(0),
+                             pick(PICK_START),
+                             lineHeight(1),
+                             firstRow(0),
+                             layoutLatency(),
+                             drawLatency(),
+                             lastLayoutMicros(0),
+                             lastDrawMicros(0),
+                             text()
+{
+}
+
+int EditSession::getVisibleRows() const
+{
+    int rows = (PICKER_TOP - TEXT_TOP) / lineHeight;
+    return (rows > 0) ? rows : 1;
+}
+
+bool EditSession::isRowVisible(size_t row) const
+{
+    return row >= firstRow && row < firstRow + getVisibleRows();
+}
+
+int EditSession::getRowY(size_t row) const
+{
+    return TEXT_TOP + (int)(row - firstRow) * lineHeight;
+}
+
+bool EditSession::scrollToCaret()
+{
+    size_t row;
+    int x;
+    editor.getCaret(row, x);
+
+    size_t rows = getVisibleRows();
+    size_t wanted = firstRow;
+    if (row < firstRow)
+    {
+        wanted = row;
+    }
+    else if (row >= firstRow + rows)
+    {
+        wanted = row - rows + 1;
+    }
+
+    if (wanted == firstRow)
+    {
+        return false;
+    }
+    firstRow = wanted;
+    return true;
+}
+
+void EditSession::drawGlyphs(size_t row, size_t first, size_t count)
+{
+    if (!isRowVisible(row))
+    {
+        return;
+    }
+
+    const int y = getRowY(row);
+    M5.Display.setFont(font);
+    M5.Display.setTextSize(1);
+    M5.Display.setTextColor(WHITE); // No background: cells are cleared before drawing
+    for (size_t i = first; i < first + count; i++)
+    {
+        const EditGlyph &glyph = editor.getGlyph(i);
+        if (glyph.codepoint != '\n' && glyph.codepoint != ' ')
+        {
+            M5.Display.drawChar((uint16_t)glyph.codepoint, TEXT_LEFT + glyph.x, y);
+        }
+    }
+}
+
+void EditSession::drawText()
+{
+    M5.Display.fillRect(0, TEXT_TOP, M5.Display.width(), PICKER_TOP - TEXT_TOP, BLACK);
+    for (size_t row = firstRow; row < editor.getLineCount() && isRowVisible(row); row++)
+    {
+        const EditLine &line = editor.getLine(row);
+        drawGlyphs(row, line.firstGlyph, line.glyphCount);
+    }
+}
+
+void EditSession::drawCaret(bool visible)
+{
+    size_t row;
+    int x;
+    editor.getCaret(row, x);
+    if (!isRowVisible(row))
+    {
+        return;
+    }
+
+    const int y = getRowY(row);
+    const int left = TEXT_LEFT + x - CARET_WIDTH / 2;
+    if (visible)
+    {
+        M5.Display.fillRect(left, y, CARET_WIDTH, lineHeight, YELLOW);
+        return;
+    }
+
+    // Clear the bar, then draw back the glyphs it covered
+    M5.Display.fillRect(left, y, CARET_WIDTH, lineHeight, BLACK);
+    const EditLine &line = editor.getLine(row);
+    for (size_t i = line.firstGlyph; i < line.firstGlyph + line.glyphCount; i++)
+    {
+        const EditGlyph &glyph = editor.getGlyph(i);
+        if (glyph.x < x + CARET_WIDTH && glyph.x + glyph.advance > x - CARET_WIDTH)
+        {
+            drawGlyphs(row, i, 1);
+        }
+    }
+}
+
+void EditSession::drawPicker()
+{
+    const int centerX = M5.Display.width() / 2;
+    M5.Display.fillRect(0, PICKER_TOP, M5.Display.width(), PICKER_HEIGHT, BLACK);
+    M5.Display.setFont(&fonts::Font2);
+    M5.Display.setTextSize(1);
+    M5.Display.setTextDatum(middle_center);
+
+    for (int offset = -PICKER_SIDE; offset <= PICKER_SIDE; offset++)
+    {
+        char entry = PICKER[((pick + offset) % PICKER_COUNT + PICKER_COUNT) % PICKER_COUNT];
+        char label[2] = {entry, 0};
+        const char *name = label;
+        switch (entry)
+        {
+        case ' ':
+            name = "SP";
+            break;
+        case '\n':
+            name = "RET";
+            break;
+        case PICK_DELETE:
+            name = "DEL";
+            break;
+        case PICK_LEFT:
+            name = "<";
+            break;
+        case PICK_RIGHT:
+            name = ">";
+            break;
+        }
+
+        const int x = centerX + offset * PICKER_SLOT;
+        if (offset == 0)
+        {
+            M5.Display.drawRect(x - PICKER_SLOT / 2, PICKER_TOP, PICKER_SLOT, PICKER_HEIGHT, YELLOW);
+        }
+        M5.Display.setTextColor(offset == 0 ? WHITE : DARKGREY);
+        M5.Display.drawString(name, x, PICKER_TOP + PICKER_HEIGHT / 2);
+    }
+    M5.Display.setTextDatum(top_left);
+}
+
+void EditSession::begin(const void *fontPtr, const char *initialText, long position)
+{
+    font = static_cast<const lgfx::IFont *>(fontPtr);
+    active = true;
+    lastPosition = position;
+    pick = PICK_START;
+    firstRow = 0;
+
+#ifdef FANOUT_DISPLAY
+    // Let the dial's fan-out task finish its frame first, so the editor's screen is not drawn over
+    fanoutDevice.getFanout().waitIdle(FANOUT_IDLE_MS);
+#endif
+
+    // Font and colors are panel state the fan-out's dial task sets too
+    M5DialDevice::lockDisplay();
+    M5.Display.setFont(font);
+    lineHeight = M5.Display.fontHeight();
+    if (lineHeight < 1)
+    {
+        lineHeight = 1;
+    }
+    widths.reset(font, measureGlyphAdvance);
+    editor.setFont(widths, m5DialDevice.getWrapWidth());
+    editor.setText(initialText != nullptr ? initialText : "");
+    scrollToCaret();
+
+    m5DialDevice.clearDisplay();
+    M5.Display.startWrite();
+    M5.Display.setFont(&fonts::Font2);
+    M5.Display.setTextSize(1);
+    M5.Display.setTextDatum(middle_center);
+    M5.Display.setTextColor(CYAN);
+    M5.Display.drawString("Edit - hold to finish", M5.Display.width() / 2, TEXT_TOP / 2 + 4);
+    M5.Display.setTextDatum(top_left);
+
+    M5.Display.setClipRect(0, TEXT_TOP, M5.Display.width(), PICKER_TOP - TEXT_TOP);
+    drawText();
+    drawCaret(true);
+    M5.Display.clearClipRect();
+    drawPicker();
+    M5.Display.endWrite();
+    M5DialDevice::unlockDisplay();
+}
+
+bool EditSession::isActive() const
+{
+    return active;
+}
+
+void EditSession::onEncoder(long position)
+{
+    if (!active || position == lastPosition)
+    {
+        return;
+    }
+
+    pick = ((pick + (int)(position - lastPosition)) % PICKER_COUNT + PICKER_COUNT) % PICKER_COUNT;
+    lastPosition = position;
+    M5DialDevice::lockDisplay();
+    M5.Display.startWrite();
+    drawPicker();
+    M5.Display.endWrite();
+    M5DialDevice::unlockDisplay();
+}
+
+bool EditSession::commit()
+{
+    if (!active)
+    {
+        return false;
+    }
+
+    M5DialDevice::lockDisplay();
+    uint32_t start = micros();
+    M5.Display.startWrite();
+    M5.Display.setClipRect(0, TEXT_TOP, M5.Display.width(), PICKER_TOP - TEXT_TOP);
+
+    // The caret comes off against the old layout, which is still on screen
+    drawCaret(false);
+
+    uint32_t layoutStart = micros();
+    bool changed = false;
+    size_t cursor = editor.getCursor();
+    switch (PICKER[pick])
+    {
+    case PICK_DELETE:
+        changed = editor.erase();
+        break;
+    case PICK_LEFT:
+        editor.setCursor(cursor > 0 ? cursor - 1 : 0);
+        break;
+    case PICK_RIGHT:
+        editor.setCursor(cursor + 1);
+        break;
+    default:
+        changed = editor.insert((uint8_t)PICKER[pick]);
+        break;
+    }
+    uint32_t layoutMicros = micros() - layoutStart;
+
+    if (scrollToCaret())
+    {
+        drawText();
+    }
+    else if (changed)
+    {
+        size_t count;
+        const EditDamage *damage = editor.getDamage(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const EditDamage &region = damage[i];
+            if (!isRowVisible(region.line))
+            {
+                continue;
+            }
+            M5.Display.fillRect(TEXT_LEFT + region.x, getRowY(region.line), region.width, lineHeight, BLACK);
+
+            // The glyph before the cleared cells too: its ink may reach into them
+            size_t first = region.firstGlyph;
+            size_t glyphCount = region.glyphCount;
+            if (region.line < editor.getLineCount() && first > editor.getLine(region.line).firstGlyph)
+            {
+                first--;
+                glyphCount++;
+            }
+            drawGlyphs(region.line, first, glyphCount);
+        }
+    }
+
+    drawCaret(true);
+    M5.Display.clearClipRect();
+    M5.Display.endWrite();
+    M5DialDevice::unlockDisplay();
+
+    if (changed)
+    {
+        lastLayoutMicros = layoutMicros;
+        lastDrawMicros = micros() - start - layoutMicros;
+        layoutLatency.add(lastLayoutMicros);
+        drawLatency.add(lastDrawMicros);
+    }
+    return changed;
+}
+
+const char *EditSession::finish()
+{
+    active = false;
+    editor.copyText(text, sizeof(text));
+    return text;
+}
+
+const TextEditor &EditSession::getEditor() const
+{
+    return editor;
+}
+
+LatencyStats &EditSession::getLayoutLatency()
+{
+    return layoutLatency;
+}
+
+LatencyStats &EditSession::getDrawLatency()
+{
+    return drawLatency;
+}
+
+uint32_t EditSession::getLastTiming(uint32_t &drawMicros) const
+{
+    drawMicros = lastDrawMicros;
+    return lastLayoutMicros;
+}
+
+// Global instance for easy access
+EditSession editSession;
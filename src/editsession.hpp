@@ -0,0 +1,123 @@
+/**
+ * @file editsession.hpp
+ * @brief On-device sample text editor driven by the dial
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "M5GFX.h"
+#include "inputlog.hpp"
+#include "texteditor.hpp"
+
+/**
+ * @class EditSession
+ * @brief Connects a TextEditor to the dial and draws it straight to the display
+ *
+ * The encoder turns a picker wheel of characters plus line break, delete
+ * and caret left/right; the button commits the picked entry. After each
+ * keystroke only the editor's damage is redrawn: the cells from the first
+ * changed glyph of each re-broken line, the caret and its neighbours. A
+ * full redraw happens only when the caret scrolls the text area.
+ */
+class EditSession
+{
+private:
+    TextEditor editor;
+    GlyphWidthTable widths;
+    const lgfx::IFont *font;
+    bool active;
+    long lastPosition; // Encoder position of the last picker move
+    int pick;          // Picker entry under the cursor
+    int lineHeight;
+    size_t firstRow; // Text line shown at the top of the text area
+    LatencyStats layoutLatency;
+    LatencyStats drawLatency;
+    uint32_t lastLayoutMicros;
+    uint32_t lastDrawMicros;
+    char text[TextEditor::MAX_GLYPHS * 4 + 1]; // The text as of the last finish()
+
+    int getVisibleRows() const;
+    bool isRowVisible(size_t row) const;
+    int getRowY(size_t row) const;
+    bool scrollToCaret();
+    void drawGlyphs(size_t row, size_t first, size_t count);
+    void drawText();
+    void drawCaret(bool visible);
+    void drawPicker();
+
+public:
+    /**
+     * @brief Constructor
+     */
+    EditSession();
+
+    /**
+     * @brief Open the editor full screen
+     * @param fontPtr Font to edit in
+     * @param initialText Text to start from; the caret goes at its end
+     * @param position Current encoder position
+     *
+     * The display is drawn directly, outside the frame sprites.
+     */
+    void begin(const void *fontPtr, const char *initialText, long position);
+
+    /**
+     * @brief Check if the editor is open
+     * @return true between begin() and finish()
+     */
+    bool isActive() const;
+
+    /**
+     * @brief Move the picker with the dial
+     * @param position New encoder position
+     */
+    void onEncoder(long position);
+
+    /**
+     * @brief Apply the picked entry: insert a character, delete or move the caret
+     * @return true if the text changed
+     */
+    bool commit();
+
+    /**
+     * @brief Close the editor
+     * @return The edited text, valid until the next finish()
+     */
+    const char *finish();
+
+    /**
+     * @brief Get the editor, for its text and counters
+     * @return Editor
+     */
+    const TextEditor &getEditor() const;
+
+    /**
+     * @brief Get the time spent re-breaking lines per keystroke
+     * @return Samples in microseconds, one per insert or delete
+     */
+    LatencyStats &getLayoutLatency();
+
+    /**
+     * @brief Get the time spent redrawing per keystroke
+     * @return Samples in microseconds, one per insert or delete
+     */
+    LatencyStats &getDrawLatency();
+
+    /**
+     * @brief Get the timing of the last insert or delete
+     * @param drawMicros Output, redraw time
+     * @return Line breaking time in microseconds
+     */
+    uint32_t getLastTiming(uint32_t &drawMicros) const;
+};
+
+// Global instance declaration
+extern EditSession editSession;
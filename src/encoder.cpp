@@ -1,4 +1,20 @@
 #include "encoder.hpp"
+#include "quadrature.hpp"
+
+// Position is maintained by the pin-change interrupt, so nothing has to poll
+static volatile int32_t encoder_count = 0;
+static QuadratureDecoder decoder;
+static portMUX_TYPE decoder_lock = portMUX_INITIALIZER_UNLOCKED; // Also taken by samplePins()
+static void (*change_callback)() = nullptr;
+
+static void IRAM_ATTR encoderInterrupt() {
+    portENTER_CRITICAL_ISR(&decoder_lock);
+    int step = decoder.update(digitalRead(Encoder::PIN_A), digitalRead(Encoder::PIN_B));
+    encoder_count += step;
+    portEXIT_CRITICAL_ISR(&decoder_lock);
+
+    if (step != 0 && change_callback) change_callback();
+}
 
 // Constructor
 Encoder::Encoder() : oldPosition(-999) {
@@ -12,33 +28,19 @@ Encoder::~Encoder() {
 
 void Encoder::setup() {
     // Setup encoder pins as input with pullup
-    // M5Dial encoder pins: A=40, B=41
-    pinMode(40, INPUT_PULLUP);
-    pinMode(41, INPUT_PULLUP);
-    
+    pinMode(PIN_A, INPUT_PULLUP);
+    pinMode(PIN_B, INPUT_PULLUP);
+    decoder.reset(digitalRead(PIN_A), digitalRead(PIN_B));
+
+    // Decode on every edge of either pin
+    attachInterrupt(digitalPinToInterrupt(PIN_A), encoderInterrupt, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(PIN_B), encoderInterrupt, CHANGE);
+
     // Get initial position
     oldPosition = getPosition();
 }
 
 long Encoder::getPosition() {
-    // Use M5Unified's direct encoder reading for M5Dial
-    // The encoder is connected to specific GPIO pins on M5Dial
-    static int32_t encoder_count = 0;
-    static bool last_a = false, last_b = false;
-    
-    // M5Dial encoder pins: A=40, B=41 (common configuration)
-    bool a = digitalRead(40);
-    bool b = digitalRead(41);
-    
-    if (last_a != a || last_b != b) {
-        if (last_a && !a) {  // falling edge on A
-            if (b) encoder_count++;
-            else encoder_count--;
-        }
-        last_a = a;
-        last_b = b;
-    }
-    
     return encoder_count;
 }
 
@@ -53,7 +55,6 @@ bool Encoder::hasPositionChanged() {
 
 void Encoder::resetPosition() {
     // Reset encoder position to 0 by updating our internal counter
-    getPosition(); // Initialize static variables
     oldPosition = 0;
 }
 
@@ -62,5 +63,17 @@ void Encoder::setPosition(long position) {
     oldPosition = position;
 }
 
+bool Encoder::samplePins() {
+    portENTER_CRITICAL(&decoder_lock);
+    int step = decoder.update(digitalRead(PIN_A), digitalRead(PIN_B));
+    encoder_count += step;
+    portEXIT_CRITICAL(&decoder_lock);
+    return step != 0;
+}
+
+void Encoder::setChangeCallback(void (*callback)()) {
+    change_callback = callback;
+}
+
 // Global instance for easy access
 Encoder encoder;
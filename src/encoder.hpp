@@ -28,6 +28,9 @@ private:
     long oldPosition; // Store previous encoder position
 
 public:
+    static const int PIN_A = 40; // M5Dial encoder pins
+    static const int PIN_B = 41;
+
     /**
      * @brief Constructor
      * Initializes encoder with default values
@@ -41,7 +44,7 @@ public:
 
     /**
      * @brief Setup encoder functionality
-     * Initializes encoder display and shows test message
+     * Configures the encoder pins and attaches the decoding interrupt
      */
     void setup();
 
@@ -67,6 +70,21 @@ public:
      * @param position Target position value
      */
     void setPosition(long position);
+
+    /**
+     * @brief Decode the pin levels now, as the interrupt handler would
+     * @return true if this completed a step
+     *
+     * Light sleep swallows the pin interrupt of the edge that woke the chip;
+     * calling this after waking counts that edge instead of losing it.
+     */
+    bool samplePins();
+
+    /**
+     * @brief Set a function to call whenever the position changes
+     * @param callback Function called from the interrupt handler; must be IRAM-safe
+     */
+    void setChangeCallback(void (*callback)());
 };
 
 // Global instance for easy access
@@ -0,0 +1,198 @@
+/**
+ * @file epddevice.cpp
+ * @brief E-paper Device Interface implementation
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Stack e-paper boards (M5Paper, CoreInk) or any M5GFX EPD panel
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#include "epddevice.hpp"
+#include "fnv1a.hpp"
+#include "lgfxtarget.hpp"
+#include "memorytracker.hpp"
+
+// Typical IT8951 (M5Paper) timings: GC16 full refresh vs DU partial update
+static const RefreshCostModel EPD_COST = {450, 260, 30};
+
+static const uint32_t BUSY_POLL_MS = 20; // Recheck interval while a refresh is running
+
+EpdDevice::EpdDevice() : frameReady(false),
+                         rowHash(),
+                         rowHashValid(false),
+                         refresh(0, 0)
+{
+}
+
+void EpdDevice::begin()
+{
+    // Drawing only updates panel memory; service() decides when it is shown
+    M5.Display.setAutoDisplay(false);
+    M5.Display.setEpdMode(epd_mode_t::epd_fast);
+
+    refresh = RefreshScheduler(getDisplayWidth(), getDisplayHeight());
+    refresh.setCostModel(EPD_COST);
+
+    // 4-bit grayscale matches the panel and halves the frame against 8-bit
+    frame.setColorDepth(4);
+    frame.setPsram(true);
+    frameReady = getDisplayHeight() <= MAX_HEIGHT &&
+                 frame.createSprite(getDisplayWidth(), getDisplayHeight()) != nullptr;
+    if (frameReady)
+    {
+        memoryTracker.recordAlloc(MEM_SPRITES, frame.getBuffer(), frame.bufferLength());
+    }
+    else
+    {
+        Serial.println("No memory for EPD frame, every change refreshes the whole panel");
+    }
+}
+
+void EpdDevice::clearDisplay()
+{
+    M5.Display.fillScreen(WHITE);
+    rowHashValid = false;
+    refresh.requestFull(millis());
+}
+
+int EpdDevice::getDisplayWidth() const
+{
+    return M5.Display.width();
+}
+
+int EpdDevice::getDisplayHeight() const
+{
+    return M5.Display.height();
+}
+
+void EpdDevice::commitFrame()
+{
+    const int width = frame.width();
+    const int height = frame.height();
+    const size_t rowBytes = (width * 4 + 7) / 8;
+    const uint8_t *pixels = static_cast<const uint8_t *>(frame.getBuffer());
+    uint32_t now = millis();
+
+    // Write each band of changed rows to panel memory and report it as damage
+    int bandStart = -1;
+    for (int y = 0; y <= height; y++)
+    {
+        bool changed = false;
+        if (y < height)
+        {
+            uint32_t hash = fnv1a(pixels + y * rowBytes, rowBytes);
+            changed = !rowHashValid || hash != rowHash[y];
+            rowHash[y] = hash;
+        }
+
+        if (changed && bandStart < 0)
+        {
+            bandStart = y;
+        }
+        else if (!changed && bandStart >= 0)
+        {
+            M5.Display.setClipRect(0, bandStart, width, y - bandStart);
+            frame.pushSprite(&M5.Display, 0, 0);
+            M5.Display.clearClipRect();
+            refresh.addDamage({0, (int16_t)bandStart, (int16_t)width, (int16_t)(y - bandStart)}, now);
+            bandStart = -1;
+        }
+    }
+    rowHashValid = true;
+}
+
+void EpdDevice::showFrame()
+{
+    if (!frameReady)
+    {
+        // No frame to diff against: draw straight to panel memory, refresh everything
+        LgfxDisplayTarget panel("epd", M5.Display);
+        replayDisplayList(frameList, panel);
+        rowHashValid = false;
+        refresh.requestFull(millis());
+        return;
+    }
+
+    LgfxDisplayTarget target("epd frame", frame);
+    replayDisplayList(frameList, target);
+    commitFrame();
+}
+
+void EpdDevice::displayFont(const char *familyName, const char *fontName,
+                            int fontSize, const void *fontPtr, const char *sampleText)
+{
+    frameList.reset(getDisplayWidth(), getDisplayHeight());
+    renderer.renderFont(frameList, PAPER_STYLE, familyName, fontName, fontSize, fontPtr, sampleText);
+    showFrame();
+}
+
+void EpdDevice::displayFontPage(const FontInfo *fonts, int count, int slots,
+                                const char *sampleText, int pageIndex, int pageCount)
+{
+    frameList.reset(getDisplayWidth(), getDisplayHeight());
+    renderer.renderFontPage(frameList, PAPER_STYLE, fonts, count, slots, sampleText, pageIndex, pageCount);
+    showFrame();
+}
+
+void EpdDevice::setTransition(int direction, float velocity)
+{
+    // Animation is pointless on e-paper; font changes are batched instead
+    (void)direction;
+    (void)velocity;
+}
+
+bool EpdDevice::updateTransition(bool hurry)
+{
+    (void)hurry;
+    return false;
+}
+
+bool EpdDevice::service()
+{
+    if (M5.Display.displayBusy())
+    {
+        return false;
+    }
+
+    DirtyRect regions[RefreshScheduler::MAX_RECTS];
+    int count = 0;
+    switch (refresh.poll(millis(), regions, count))
+    {
+    case REFRESH_FULL:
+        // The slow high-quality waveform also clears ghosting from partial updates
+        M5.Display.setEpdMode(epd_mode_t::epd_quality);
+        M5.Display.display();
+        M5.Display.setEpdMode(epd_mode_t::epd_fast);
+        return true;
+    case REFRESH_PARTIAL:
+        for (int i = 0; i < count; i++)
+        {
+            M5.Display.display(regions[i].x, regions[i].y, regions[i].w, regions[i].h);
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint32_t EpdDevice::getRefreshDelay() const
+{
+    uint32_t wait = refresh.getWaitTime(millis());
+    if (wait == 0 && M5.Display.displayBusy())
+    {
+        return BUSY_POLL_MS;
+    }
+    return wait;
+}
+
+void EpdDevice::setRefreshPolicy(uint32_t settleMs, uint32_t maxLatencyMs, int partialsBeforeFull,
+                                 int fullAreaPercent)
+{
+    refresh.setPolicy(settleMs, maxLatencyMs, partialsBeforeFull, fullAreaPercent);
+}
+
+// Global instance for easy access
+EpdDevice epdDevice;
@@ -0,0 +1,93 @@
+/**
+ * @file epddevice.hpp
+ * @brief E-paper Device Interface with batched partial refreshes
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Stack e-paper boards (M5Paper, CoreInk) or any M5GFX EPD panel
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <M5Unified.h>
+#include "displaylist.hpp"
+#include "fontmanager.hpp"
+#include "refreshscheduler.hpp"
+#include "specimen.hpp"
+
+/**
+ * @class EpdDevice
+ * @brief DeviceInterface for e-paper panels
+ *
+ * Frames are laid out by the shared SpecimenRenderer in black on white,
+ * composed in a 4-bit grayscale sprite and compared row by row
+ * (by hash) with the previous frame. Only changed row bands are written to
+ * the panel, and the panel is not refreshed straight away: the bands are
+ * handed to a RefreshScheduler, and service() performs the partial or full
+ * refresh it decides on once a burst of font changes has settled.
+ */
+class EpdDevice : public DeviceInterface
+{
+private:
+    static const int MAX_HEIGHT = 960; // Tallest supported panel (M5Paper)
+
+    M5Canvas frame;
+    bool frameReady;
+    uint32_t rowHash[MAX_HEIGHT]; // Per row of the frame on the panel
+    bool rowHashValid;
+    RefreshScheduler refresh;
+    SpecimenRenderer renderer;
+    DisplayList frameList; // The frame being drawn
+
+    void showFrame();
+    void commitFrame();
+
+public:
+    /**
+     * @brief Constructor
+     */
+    EpdDevice();
+
+    /**
+     * @brief Take over M5.Display: manual refreshes, fast partial waveform
+     */
+    void begin();
+
+    // DeviceInterface implementation
+    void clearDisplay() override;
+    int getDisplayWidth() const override;
+    int getDisplayHeight() const override;
+    void displayFont(const char *familyName, const char *fontName,
+                     int fontSize, const void *fontPtr, const char *sampleText) override;
+    void displayFontPage(const FontInfo *fonts, int count, int slots,
+                         const char *sampleText, int pageIndex, int pageCount) override;
+    void setTransition(int direction, float velocity) override;
+    bool updateTransition(bool hurry) override;
+
+    /**
+     * @brief Perform the refresh that is due, if any
+     * @return true if a refresh was started
+     *
+     * Call whenever getRefreshDelay() has elapsed. Does nothing while the
+     * panel is still busy with the previous refresh.
+     */
+    bool service();
+
+    /**
+     * @brief Get how long until service() has work to do
+     * @return Milliseconds, 0xFFFFFFFF with nothing pending
+     */
+    uint32_t getRefreshDelay() const;
+
+    /**
+     * @brief Change the batching and ghosting policy, see RefreshScheduler::setPolicy()
+     */
+    void setRefreshPolicy(uint32_t settleMs, uint32_t maxLatencyMs, int partialsBeforeFull, int fullAreaPercent);
+};
+
+// Global instance declaration
+extern EpdDevice epdDevice;
@@ -0,0 +1,215 @@
+/**
+ * @file eventscheduler.cpp
+ * @brief Event queue, software timers and idle tracking for the main loop
+ * @date 2026-10-19
+ */
+
+#include "eventscheduler.hpp"
+
+EventScheduler::EventScheduler() : queue(),
+                                   queueHead(0),
+                                   queueCount(0),
+                                   droppedEvents(0),
+                                   timers(),
+                                   lastActivity(0),
+                                   dimAfter(0),
+                                   sleepAfter(0)
+{
+}
+
+bool EventScheduler::isInput(EventType type)
+{
+    return type == EVENT_ENCODER || type == EVENT_BUTTON_CLICK || type == EVENT_BUTTON_HOLD ||
+           type == EVENT_SERIAL || type == EVENT_TOUCH;
+}
+
+uint32_t EventScheduler::until(uint32_t deadline, uint32_t now)
+{
+    // Signed difference keeps this correct across millis() wrap-around
+    int32_t remaining = (int32_t)(deadline - now);
+    return remaining > 0 ? (uint32_t)remaining : 0;
+}
+
+bool EventScheduler::post(EventType type, int32_t value, uint32_t now)
+{
+    if (isInput(type))
+    {
+        lastActivity = now;
+    }
+
+    // Only the newest encoder position matters: update a queued one in place
+    if (type == EVENT_ENCODER)
+    {
+        for (int i = 0; i < queueCount; i++)
+        {
+            Event &queued = queue[(queueHead + i) % QUEUE_SIZE];
+            if (queued.type == EVENT_ENCODER)
+            {
+                queued.value = value;
+                queued.time = now;
+                return true;
+            }
+        }
+    }
+
+    if (queueCount == QUEUE_SIZE)
+    {
+        droppedEvents++;
+        return false;
+    }
+
+    Event &event = queue[(queueHead + queueCount) % QUEUE_SIZE];
+    event.type = type;
+    event.value = value;
+    event.time = now;
+    queueCount++;
+    return true;
+}
+
+bool EventScheduler::next(Event &event, uint32_t now)
+{
+    if (queueCount > 0)
+    {
+        event = queue[queueHead];
+        queueHead = (queueHead + 1) % QUEUE_SIZE;
+        queueCount--;
+        return true;
+    }
+
+    for (int id = 0; id < MAX_TIMERS; id++)
+    {
+        Timer &timer = timers[id];
+        if (!timer.running || until(timer.deadline, now) > 0)
+        {
+            continue;
+        }
+
+        event.type = EVENT_TIMER;
+        event.value = id;
+        event.time = timer.deadline;
+
+        if (timer.repeat)
+        {
+            // Skip missed periods rather than firing a burst to catch up
+            timer.deadline += timer.period;
+            if (until(timer.deadline, now) == 0)
+            {
+                timer.deadline = now + timer.period;
+            }
+        }
+        else
+        {
+            timer.running = false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void EventScheduler::startTimer(int id, uint32_t period, bool repeat, uint32_t now)
+{
+    if (id < 0 || id >= MAX_TIMERS)
+    {
+        return;
+    }
+
+    timers[id].running = true;
+    timers[id].repeat = repeat;
+    timers[id].period = period > 0 ? period : 1;
+    timers[id].deadline = now + timers[id].period;
+}
+
+void EventScheduler::stopTimer(int id)
+{
+    if (id >= 0 && id < MAX_TIMERS)
+    {
+        timers[id].running = false;
+    }
+}
+
+bool EventScheduler::isTimerRunning(int id) const
+{
+    return id >= 0 && id < MAX_TIMERS && timers[id].running;
+}
+
+void EventScheduler::setIdleTimeouts(uint32_t dimAfterMs, uint32_t sleepAfterMs)
+{
+    dimAfter = dimAfterMs;
+    sleepAfter = sleepAfterMs;
+}
+
+void EventScheduler::noteActivity(uint32_t now)
+{
+    lastActivity = now;
+}
+
+EventScheduler::PowerState EventScheduler::getPowerState(uint32_t now) const
+{
+    uint32_t idle = now - lastActivity;
+    if (sleepAfter > 0 && idle >= sleepAfter)
+    {
+        return POWER_SLEEP;
+    }
+    if (dimAfter > 0 && idle >= dimAfter)
+    {
+        return POWER_DIMMED;
+    }
+    return POWER_ACTIVE;
+}
+
+uint32_t EventScheduler::getWaitTime(uint32_t now) const
+{
+    if (queueCount > 0)
+    {
+        return 0;
+    }
+
+    uint32_t wait = WAIT_FOREVER;
+    for (int id = 0; id < MAX_TIMERS; id++)
+    {
+        if (timers[id].running && until(timers[id].deadline, now) < wait)
+        {
+            wait = until(timers[id].deadline, now);
+        }
+    }
+
+    // Wake up in time to apply the next power state
+    PowerState state = getPowerState(now);
+    if (state == POWER_ACTIVE && dimAfter > 0 && until(lastActivity + dimAfter, now) < wait)
+    {
+        wait = until(lastActivity + dimAfter, now);
+    }
+    if (state != POWER_SLEEP && sleepAfter > 0 && until(lastActivity + sleepAfter, now) < wait)
+    {
+        wait = until(lastActivity + sleepAfter, now);
+    }
+    return wait;
+}
+
+uint32_t EventScheduler::getDroppedEvents() const
+{
+    return droppedEvents;
+}
+
+void runLoopStep(EventScheduler &scheduler, const LoopHooks &hooks)
+{
+    uint32_t now = hooks.clockMillis();
+    hooks.pollInputs(now);
+
+    Event event;
+    while (scheduler.next(event, now))
+    {
+        hooks.handleEvent(event);
+    }
+
+    // Dim, or sleep until an input wakes the chip
+    hooks.setPowerState(scheduler.getPowerState(hooks.clockMillis()));
+
+    if (hooks.beforeWait != nullptr)
+    {
+        hooks.beforeWait();
+    }
+
+    // Sleep until an input interrupt or the next timer; nothing runs in between
+    hooks.waitForEvent(scheduler.getWaitTime(hooks.clockMillis()));
+}
@@ -0,0 +1,178 @@
+/**
+ * @file eventscheduler.hpp
+ * @brief Event queue, software timers and idle tracking for the main loop
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies: every call takes the current time
+ * in milliseconds, so idle behaviour can be replayed against a simulated clock.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+enum EventType : uint8_t
+{
+    EVENT_NONE = 0,
+    EVENT_ENCODER,      // value: new encoder position
+    EVENT_BUTTON_CLICK, // Short press released
+    EVENT_BUTTON_HOLD,  // Long press
+    EVENT_SERIAL,       // Serial data is waiting
+    EVENT_TOUCH,        // Tap on the touch panel
+    EVENT_TIMER,        // value: timer id
+};
+
+struct Event
+{
+    EventType type;
+    int32_t value;
+    uint32_t time; // Milliseconds when posted (or when the timer expired)
+};
+
+/**
+ * @class EventScheduler
+ * @brief Decides what the main loop does next and how long it may block
+ *
+ * Inputs post events; consecutive encoder events are merged so only the
+ * newest position is handled. Timers are one-shot or periodic. Input events
+ * count as user activity; after the dim and sleep timeouts without activity
+ * getPowerState() reports the lower power states.
+ */
+class EventScheduler
+{
+public:
+    static const int QUEUE_SIZE = 16;
+    static const int MAX_TIMERS = 4;
+    static const uint32_t WAIT_FOREVER = 0xFFFFFFFFUL;
+
+    enum PowerState
+    {
+        POWER_ACTIVE,
+        POWER_DIMMED,
+        POWER_SLEEP,
+    };
+
+private:
+    struct Timer
+    {
+        bool running;
+        bool repeat;
+        uint32_t period;
+        uint32_t deadline;
+    };
+
+    Event queue[QUEUE_SIZE];
+    int queueHead;
+    int queueCount;
+    uint32_t droppedEvents;
+    Timer timers[MAX_TIMERS];
+    uint32_t lastActivity;
+    uint32_t dimAfter;   // 0 disables dimming
+    uint32_t sleepAfter; // 0 disables sleep
+
+    static bool isInput(EventType type);
+    static uint32_t until(uint32_t deadline, uint32_t now);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    EventScheduler();
+
+    /**
+     * @brief Queue an event
+     * @param type Event type
+     * @param value Event value
+     * @param now Current time in milliseconds
+     * @return false if the queue was full and the event was dropped
+     */
+    bool post(EventType type, int32_t value, uint32_t now);
+
+    /**
+     * @brief Take the next event: queued events first, then expired timers
+     * @param event Output event
+     * @param now Current time in milliseconds
+     * @return true if an event was returned
+     */
+    bool next(Event &event, uint32_t now);
+
+    /**
+     * @brief Start (or restart) a timer
+     * @param id Timer id (0..MAX_TIMERS-1)
+     * @param period Milliseconds until it fires
+     * @param repeat true to fire every period until stopped
+     * @param now Current time in milliseconds
+     */
+    void startTimer(int id, uint32_t period, bool repeat, uint32_t now);
+
+    /**
+     * @brief Stop a timer
+     * @param id Timer id
+     */
+    void stopTimer(int id);
+
+    /**
+     * @brief Check whether a timer is running
+     * @param id Timer id
+     * @return true if running
+     */
+    bool isTimerRunning(int id) const;
+
+    /**
+     * @brief Set the idle timeouts
+     * @param dimAfterMs Inactivity before POWER_DIMMED, 0 to never dim
+     * @param sleepAfterMs Inactivity before POWER_SLEEP, 0 to never sleep
+     */
+    void setIdleTimeouts(uint32_t dimAfterMs, uint32_t sleepAfterMs);
+
+    /**
+     * @brief Record user activity without posting an event
+     * @param now Current time in milliseconds
+     */
+    void noteActivity(uint32_t now);
+
+    /**
+     * @brief Get the power state implied by the time since the last activity
+     * @param now Current time in milliseconds
+     * @return Power state
+     */
+    PowerState getPowerState(uint32_t now) const;
+
+    /**
+     * @brief Get how long the main loop may block
+     * @param now Current time in milliseconds
+     * @return 0 if events are waiting, else milliseconds until the next timer
+     *         or power state change, or WAIT_FOREVER
+     */
+    uint32_t getWaitTime(uint32_t now) const;
+
+    /**
+     * @brief Get the number of events dropped because the queue was full
+     * @return Dropped event count
+     */
+    uint32_t getDroppedEvents() const;
+};
+
+// Functions through which runLoopStep() reaches the inputs, the application and the chip
+struct LoopHooks
+{
+    uint32_t (*clockMillis)();                                // Current time
+    void (*pollInputs)(uint32_t nowMs);                       // Post events for input state
+    void (*handleEvent)(const Event &event);                  // Act on one event
+    void (*setPowerState)(EventScheduler::PowerState state);  // Apply it; POWER_SLEEP returns once woken
+    void (*beforeWait)();                                     // Last work before blocking, or nullptr
+    void (*waitForEvent)(uint32_t timeoutMs);                 // Block until an input interrupt or the timeout
+};
+
+/**
+ * @brief Run one pass of the main loop
+ * @param scheduler Events, timers and idle state of the loop
+ * @param hooks Device and application functions
+ *
+ * Polls the inputs, handles every event due, applies the power state the
+ * idle time calls for, then blocks for as long as getWaitTime() allows.
+ * Nothing runs between passes, so the loop costs nothing while idle. The
+ * firmware's loop() calls this on the M5Dial; test_idlewake on a virtual
+ * clock.
+ */
+void runLoopStep(EventScheduler &scheduler, const LoopHooks &hooks);
@@ -0,0 +1,102 @@
+/**
+ * @file fanoutdevice.cpp
+ * @brief Device Interface that lays a frame out once and draws it on several panels
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial, plus any other LovyanGFX panel or sprite
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#include "fanoutdevice.hpp"
+
+#ifdef FANOUT_DISPLAY
+#include <esp_pthread.h>
+
+static const size_t TARGET_STACK_SIZE = 4096; // Replay only draws; layout stays on the caller's task
+
+static uint32_t clockMicros()
+{
+    return micros();
+}
+
+FanoutDevice::FanoutDevice() : fanout(clockMicros),
+                               renderer(),
+                               frameWidth(240),
+                               frameHeight(240)
+{
+}
+
+void FanoutDevice::begin(int width, int height)
+{
+    frameWidth = width;
+    frameHeight = height;
+
+    // Standard threads run as FreeRTOS tasks configured here
+    esp_pthread_cfg_t config = esp_pthread_get_default_config();
+    config.stack_size = TARGET_STACK_SIZE;
+    config.thread_name = "fanout";
+    esp_pthread_set_cfg(&config);
+}
+
+int FanoutDevice::addTarget(DisplayTarget &target)
+{
+    return fanout.addTarget(target);
+}
+
+DisplayFanout &FanoutDevice::getFanout()
+{
+    return fanout;
+}
+
+void FanoutDevice::clearDisplay()
+{
+    DisplayList &list = fanout.beginFrame(frameWidth, frameHeight);
+    list.fill(DIAL_STYLE.background);
+    fanout.publish();
+}
+
+int FanoutDevice::getDisplayWidth() const
+{
+    return frameWidth;
+}
+
+int FanoutDevice::getDisplayHeight() const
+{
+    return frameHeight;
+}
+
+void FanoutDevice::displayFont(const char *familyName, const char *fontName,
+                               int fontSize, const void *fontPtr, const char *sampleText)
+{
+    // The dial's frame, so every panel shows the dial's labels and line breaks
+    DisplayList &list = fanout.beginFrame(frameWidth, frameHeight);
+    renderer.renderFont(list, DIAL_STYLE, familyName, fontName, fontSize, fontPtr, sampleText);
+    fanout.publish();
+}
+
+void FanoutDevice::displayFontPage(const FontInfo *fonts, int count, int slots,
+                                   const char *sampleText, int pageIndex, int pageCount)
+{
+    DisplayList &list = fanout.beginFrame(frameWidth, frameHeight);
+    renderer.renderFontPage(list, DIAL_STYLE, fonts, count, slots, sampleText, pageIndex, pageCount);
+    fanout.publish();
+}
+
+void FanoutDevice::setTransition(int direction, float velocity)
+{
+    (void)direction;
+    (void)velocity;
+}
+
+bool FanoutDevice::updateTransition(bool hurry)
+{
+    (void)hurry;
+    return false;
+}
+
+// Global instance for easy access
+FanoutDevice fanoutDevice;
+#endif
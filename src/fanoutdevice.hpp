@@ -0,0 +1,86 @@
+/**
+ * @file fanoutdevice.hpp
+ * @brief Device Interface that lays a frame out once and draws it on several panels
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial, plus any other LovyanGFX panel or sprite
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <M5Unified.h>
+#include "displayfanout.hpp"
+#include "displaylist.hpp"
+#include "fontmanager.hpp"
+#include "specimen.hpp"
+
+/**
+ * @class FanoutDevice
+ * @brief DeviceInterface that builds each frame as a DisplayList for a DisplayFanout
+ *
+ * Frames are laid out once, on the caller's task, by the same
+ * SpecimenRenderer the dial and e-paper devices use. Each registered target
+ * then draws the list on its own task at its own resolution, so a slow
+ * external panel does not hold up the dial. Transitions are not animated: a
+ * frame is a list, not pixels to slide.
+ *
+ * Only compiled with FANOUT_DISPLAY, so other builds carry neither the
+ * instance nor its threads.
+ */
+class FanoutDevice : public DeviceInterface
+{
+private:
+    DisplayFanout fanout;
+    SpecimenRenderer renderer;
+    int frameWidth;
+    int frameHeight;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    FanoutDevice();
+
+    /**
+     * @brief Set the frame size lists are laid out for
+     * @param width Frame width, normally the main panel's
+     * @param height Frame height
+     *
+     * Sets the stack of the target tasks started by addTarget() afterwards.
+     */
+    void begin(int width, int height);
+
+    /**
+     * @brief Register a panel; it draws every frame from now on
+     * @param target Target to draw on; must outlive the device
+     * @return Target index, -1 if there are DisplayFanout::MAX_TARGETS already
+     */
+    int addTarget(DisplayTarget &target);
+
+    /**
+     * @brief Get the fan-out, for per-target statistics
+     * @return Fan-out of this device
+     */
+    DisplayFanout &getFanout();
+
+    // DeviceInterface implementation
+    void clearDisplay() override;
+    int getDisplayWidth() const override;
+    int getDisplayHeight() const override;
+    void displayFont(const char *familyName, const char *fontName,
+                     int fontSize, const void *fontPtr, const char *sampleText) override;
+    void displayFontPage(const FontInfo *fonts, int count, int slots,
+                         const char *sampleText, int pageIndex, int pageCount) override;
+    void setTransition(int direction, float velocity) override;
+    bool updateTransition(bool hurry) override;
+};
+
+#ifdef FANOUT_DISPLAY
+// Global instance declaration
+extern FanoutDevice fanoutDevice;
+#endif
@@ -0,0 +1,47 @@
+/**
+ * @file fnv1a.hpp
+ * @brief FNV-1a hashing used to key persisted caches
+ * @date 2026-10-19
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+static const uint32_t FNV1A_SEED = 2166136261UL;
+
+/**
+ * @brief Continue an FNV-1a hash over a block of bytes
+ * @param data Bytes to hash
+ * @param length Number of bytes
+ * @param hash Hash so far (FNV1A_SEED to start)
+ * @return Updated hash
+ */
+inline uint32_t fnv1a(const void *data, size_t length, uint32_t hash = FNV1A_SEED)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Continue an FNV-1a hash over a NUL-terminated string, terminator included
+ * @param text String to hash (nullptr hashes as empty)
+ * @param hash Hash so far (FNV1A_SEED to start)
+ * @return Updated hash
+ */
+inline uint32_t fnv1aString(const char *text, uint32_t hash = FNV1A_SEED)
+{
+    if (text != nullptr)
+    {
+        while (*text != 0)
+        {
+            hash = (hash ^ static_cast<uint8_t>(*text++)) * 16777619UL;
+        }
+    }
+    return (hash ^ 0) * 16777619UL;
+}
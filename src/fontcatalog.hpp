@@ -0,0 +1,1383 @@
+/**
+ * @file fontcatalog.hpp
+ * @brief Font catalog of each build profile
+ * @date 2026-10-19
+ *
+ * Generated by scripts/gen_font_catalog.py from font_manifest.json; edit the
+ * manifest and run the script again instead of changing this file.
+ *
+ * Plain C++ with no Arduino dependencies. Only FONT_CATALOG_OBJECTS and
+ * FONT_CATALOG_ENTRIES name the lgfx font objects; lgfxfonts.cpp expands
+ * them, so fonts outside the selected profile are never referenced.
+ *
+ * Pixel metrics are not in the catalog: they depend on the M5GFX font data,
+ * which the generator does not read. FontMetricsIndex measures them on the
+ * device instead.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Build profiles, selected with -DFONT_PROFILE=FONT_PROFILE_<NAME>
+#define FONT_PROFILE_ENGLISH     1 // Latin fonts only; fits the StampS3 app partition
+#define FONT_PROFILE_FULL        2 // Every font, including the CJK families (several MB)
+#define FONT_PROFILE_MONO        3 // Monospaced Latin fonts only
+#define FONT_PROFILE_LATIN_CJK16 4 // Latin fonts plus the 16 px CJK fonts
+
+#ifndef FONT_PROFILE
+#ifdef ENGLISH_FONTS_ONLY
+#define FONT_PROFILE FONT_PROFILE_ENGLISH
+#else
+#define FONT_PROFILE FONT_PROFILE_FULL
+#endif
+#endif
+
+// Bits of CatalogFont::traits
+enum CatalogFontTrait : uint8_t
+{
+    FONT_TRAIT_BOLD = 1,
+    FONT_TRAIT_ITALIC = 2,
+    FONT_TRAIT_MONO = 4,     // Printable ASCII glyphs share one advance
+    FONT_TRAIT_CJK = 8,      // Covers Chinese or Japanese
+    FONT_TRAIT_SCALABLE = 16 // Rasterized at run time, see scalablefont.hpp
+};
+
+// A family's fonts are FONT_CATALOG_FONTS[first] to [first + count - 1]
+struct CatalogFamily
+{
+    const char *name;
+    uint16_t first;
+    uint16_t count;
+};
+
+// One font, in dial order
+struct CatalogFont
+{
+    const char *family;
+    const char *name;
+    uint8_t size;
+    uint8_t familyIndex; // Into FONT_CATALOG_FAMILIES
+    uint8_t traits;      // CatalogFontTrait bits
+};
+
+#if FONT_PROFILE == FONT_PROFILE_ENGLISH && defined(TRUETYPE_FONTS)
+#define FONT_PROFILE_NAME "english"
+#define FONT_CATALOG_HAS_CJK 0
+static constexpr int FONT_CATALOG_FAMILY_COUNT = 8;
+static constexpr int FONT_CATALOG_FONT_COUNT = 82;
+static constexpr int FONT_CATALOG_MONO_COUNT = 17;
+static constexpr int FONT_CATALOG_MAX_SIZE = 72;
+static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {
+    {"lgfx_fonts", 0, 7},
+    {"Free Mono", 7, 16},
+    {"Free Sans", 23, 16},
+    {"Free Serif", 39, 16},
+    {"Orbitron", 55, 1},
+    {"Roboto", 56, 3},
+    {"DejaVu", 59, 7},
+    {"TrueType", 66, 16},
+};
+static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {
+    {"lgfx_fonts", "Font0", 0, 0, FONT_TRAIT_MONO},
+    {"lgfx_fonts", "Font2", 2, 0, 0},
+    {"lgfx_fonts", "Font4", 4, 0, 0},
+    {"lgfx_fonts", "Font6", 6, 0, 0},
+    {"lgfx_fonts", "Font7", 7, 0, 0},
+    {"lgfx_fonts", "Font8", 8, 0, 0},
+    {"lgfx_fonts", "TomThumb", 0, 0, 0},
+    {"Free Mono", "FreeMono9pt7b", 9, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono12pt7b", 12, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono18pt7b", 18, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono24pt7b", 24, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Sans", "FreeSans9pt7b", 9, 2, 0},
+    {"Free Sans", "FreeSans12pt7b", 12, 2, 0},
+    {"Free Sans", "FreeSans18pt7b", 18, 2, 0},
+    {"Free Sans", "FreeSans24pt7b", 24, 2, 0},
+    {"Free Sans", "FreeSansBold9pt7b", 9, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold12pt7b", 12, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold18pt7b", 18, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold24pt7b", 24, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansOblique9pt7b", 9, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique12pt7b", 12, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique18pt7b", 18, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique24pt7b", 24, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerif9pt7b", 9, 3, 0},
+    {"Free Serif", "FreeSerif12pt7b", 12, 3, 0},
+    {"Free Serif", "FreeSerif18pt7b", 18, 3, 0},
+    {"Free Serif", "FreeSerif24pt7b", 24, 3, 0},
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBold9pt7b", 9, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold12pt7b", 12, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold18pt7b", 18, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold24pt7b", 24, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Orbitron", "Orbitron_Light_24", 24, 4, 0},
+    {"Roboto", "Roboto_Thin_24", 24, 5, 0},
+    {"Satisfy", "Satisfy_24", 24, 5, 0},
+    {"Yellowtail", "Yellowtail_32", 32, 5, 0},
+    {"DejaVu", "DejaVu9", 9, 6, 0},
+    {"DejaVu", "DejaVu12", 12, 6, 0},
+    {"DejaVu", "DejaVu18", 18, 6, 0},
+    {"DejaVu", "DejaVu24", 24, 6, 0},
+    {"DejaVu", "DejaVu40", 40, 6, 0},
+    {"DejaVu", "DejaVu56", 56, 6, 0},
+    {"DejaVu", "DejaVu72", 72, 6, 0},
+    {"TrueType", "TrueType_8", 8, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_10", 10, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_12", 12, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_14", 14, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_16", 16, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_18", 18, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_20", 20, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_24", 24, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_28", 28, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_32", 32, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_36", 36, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_40", 40, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_48", 48, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_56", 56, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_64", 64, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_72", 72, 7, FONT_TRAIT_SCALABLE},
+};
+#define FONT_CATALOG_OBJECTS \
+    static const ScalableFont ttf8(0, 8); \
+    static const ScalableFont ttf10(0, 10); \
+    static const ScalableFont ttf12(0, 12); \
+    static const ScalableFont ttf14(0, 14); \
+    static const ScalableFont ttf16(0, 16); \
+    static const ScalableFont ttf18(0, 18); \
+    static const ScalableFont ttf20(0, 20); \
+    static const ScalableFont ttf24(0, 24); \
+    static const ScalableFont ttf28(0, 28); \
+    static const ScalableFont ttf32(0, 32); \
+    static const ScalableFont ttf36(0, 36); \
+    static const ScalableFont ttf40(0, 40); \
+    static const ScalableFont ttf48(0, 48); \
+    static const ScalableFont ttf56(0, 56); \
+    static const ScalableFont ttf64(0, 64); \
+    static const ScalableFont ttf72(0, 72);
+#define FONT_CATALOG_ENTRIES \
+    {"lgfx_fonts", "Font0", 0, &fonts::Font0}, \
+    {"lgfx_fonts", "Font2", 2, &fonts::Font2}, \
+    {"lgfx_fonts", "Font4", 4, &fonts::Font4}, \
+    {"lgfx_fonts", "Font6", 6, &fonts::Font6}, \
+    {"lgfx_fonts", "Font7", 7, &fonts::Font7}, \
+    {"lgfx_fonts", "Font8", 8, &fonts::Font8}, \
+    {"lgfx_fonts", "TomThumb", 0, &fonts::TomThumb}, \
+    {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b}, \
+    {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b}, \
+    {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b}, \
+    {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b}, \
+    {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b}, \
+    {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b}, \
+    {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b}, \
+    {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b}, \
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b}, \
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b}, \
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b}, \
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b}, \
+    {"Free Sans", "FreeSans9pt7b", 9, &fonts::FreeSans9pt7b}, \
+    {"Free Sans", "FreeSans12pt7b", 12, &fonts::FreeSans12pt7b}, \
+    {"Free Sans", "FreeSans18pt7b", 18, &fonts::FreeSans18pt7b}, \
+    {"Free Sans", "FreeSans24pt7b", 24, &fonts::FreeSans24pt7b}, \
+    {"Free Sans", "FreeSansBold9pt7b", 9, &fonts::FreeSansBold9pt7b}, \
+    {"Free Sans", "FreeSansBold12pt7b", 12, &fonts::FreeSansBold12pt7b}, \
+    {"Free Sans", "FreeSansBold18pt7b", 18, &fonts::FreeSansBold18pt7b}, \
+    {"Free Sans", "FreeSansBold24pt7b", 24, &fonts::FreeSansBold24pt7b}, \
+    {"Free Sans", "FreeSansOblique9pt7b", 9, &fonts::FreeSansOblique9pt7b}, \
+    {"Free Sans", "FreeSansOblique12pt7b", 12, &fonts::FreeSansOblique12pt7b}, \
+    {"Free Sans", "FreeSansOblique18pt7b", 18, &fonts::FreeSansOblique18pt7b}, \
+    {"Free Sans", "FreeSansOblique24pt7b", 24, &fonts::FreeSansOblique24pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, &fonts::FreeSansBoldOblique9pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, &fonts::FreeSansBoldOblique12pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, &fonts::FreeSansBoldOblique18pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, &fonts::FreeSansBoldOblique24pt7b}, \
+    {"Free Serif", "FreeSerif9pt7b", 9, &fonts::FreeSerif9pt7b}, \
+    {"Free Serif", "FreeSerif12pt7b", 12, &fonts::FreeSerif12pt7b}, \
+    {"Free Serif", "FreeSerif18pt7b", 18, &fonts::FreeSerif18pt7b}, \
+    {"Free Serif", "FreeSerif24pt7b", 24, &fonts::FreeSerif24pt7b}, \
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, &fonts::FreeSerifItalic9pt7b}, \
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, &fonts::FreeSerifItalic12pt7b}, \
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, &fonts::FreeSerifItalic18pt7b}, \
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, &fonts::FreeSerifItalic24pt7b}, \
+    {"Free Serif", "FreeSerifBold9pt7b", 9, &fonts::FreeSerifBold9pt7b}, \
+    {"Free Serif", "FreeSerifBold12pt7b", 12, &fonts::FreeSerifBold12pt7b}, \
+    {"Free Serif", "FreeSerifBold18pt7b", 18, &fonts::FreeSerifBold18pt7b}, \
+    {"Free Serif", "FreeSerifBold24pt7b", 24, &fonts::FreeSerifBold24pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, &fonts::FreeSerifBoldItalic9pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, &fonts::FreeSerifBoldItalic12pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, &fonts::FreeSerifBoldItalic18pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, &fonts::FreeSerifBoldItalic24pt7b}, \
+    {"Orbitron", "Orbitron_Light_24", 24, &fonts::Orbitron_Light_24}, \
+    {"Roboto", "Roboto_Thin_24", 24, &fonts::Roboto_Thin_24}, \
+    {"Satisfy", "Satisfy_24", 24, &fonts::Satisfy_24}, \
+    {"Yellowtail", "Yellowtail_32", 32, &fonts::Yellowtail_32}, \
+    {"DejaVu", "DejaVu9", 9, &fonts::DejaVu9}, \
+    {"DejaVu", "DejaVu12", 12, &fonts::DejaVu12}, \
+    {"DejaVu", "DejaVu18", 18, &fonts::DejaVu18}, \
+    {"DejaVu", "DejaVu24", 24, &fonts::DejaVu24}, \
+    {"DejaVu", "DejaVu40", 40, &fonts::DejaVu40}, \
+    {"DejaVu", "DejaVu56", 56, &fonts::DejaVu56}, \
+    {"DejaVu", "DejaVu72", 72, &fonts::DejaVu72}, \
+    {"TrueType", "TrueType_8", 8, &ttf8}, \
+    {"TrueType", "TrueType_10", 10, &ttf10}, \
+    {"TrueType", "TrueType_12", 12, &ttf12}, \
+    {"TrueType", "TrueType_14", 14, &ttf14}, \
+    {"TrueType", "TrueType_16", 16, &ttf16}, \
+    {"TrueType", "TrueType_18", 18, &ttf18}, \
+    {"TrueType", "TrueType_20", 20, &ttf20}, \
+    {"TrueType", "TrueType_24", 24, &ttf24}, \
+    {"TrueType", "TrueType_28", 28, &ttf28}, \
+    {"TrueType", "TrueType_32", 32, &ttf32}, \
+    {"TrueType", "TrueType_36", 36, &ttf36}, \
+    {"TrueType", "TrueType_40", 40, &ttf40}, \
+    {"TrueType", "TrueType_48", 48, &ttf48}, \
+    {"TrueType", "TrueType_56", 56, &ttf56}, \
+    {"TrueType", "TrueType_64", 64, &ttf64}, \
+    {"TrueType", "TrueType_72", 72, &ttf72},
+#elif FONT_PROFILE == FONT_PROFILE_ENGLISH && !defined(TRUETYPE_FONTS)
+#define FONT_PROFILE_NAME "english"
+#define FONT_CATALOG_HAS_CJK 0
+static constexpr int FONT_CATALOG_FAMILY_COUNT = 7;
+static constexpr int FONT_CATALOG_FONT_COUNT = 66;
+static constexpr int FONT_CATALOG_MONO_COUNT = 17;
+static constexpr int FONT_CATALOG_MAX_SIZE = 72;
+static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {
+    {"lgfx_fonts", 0, 7},
+    {"Free Mono", 7, 16},
+    {"Free Sans", 23, 16},
+    {"Free Serif", 39, 16},
+    {"Orbitron", 55, 1},
+    {"Roboto", 56, 3},
+    {"DejaVu", 59, 7},
+};
+static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {
+    {"lgfx_fonts", "Font0", 0, 0, FONT_TRAIT_MONO},
+    {"lgfx_fonts", "Font2", 2, 0, 0},
+    {"lgfx_fonts", "Font4", 4, 0, 0},
+    {"lgfx_fonts", "Font6", 6, 0, 0},
+    {"lgfx_fonts", "Font7", 7, 0, 0},
+    {"lgfx_fonts", "Font8", 8, 0, 0},
+    {"lgfx_fonts", "TomThumb", 0, 0, 0},
+    {"Free Mono", "FreeMono9pt7b", 9, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono12pt7b", 12, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono18pt7b", 18, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono24pt7b", 24, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Sans", "FreeSans9pt7b", 9, 2, 0},
+    {"Free Sans", "FreeSans12pt7b", 12, 2, 0},
+    {"Free Sans", "FreeSans18pt7b", 18, 2, 0},
+    {"Free Sans", "FreeSans24pt7b", 24, 2, 0},
+    {"Free Sans", "FreeSansBold9pt7b", 9, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold12pt7b", 12, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold18pt7b", 18, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold24pt7b", 24, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansOblique9pt7b", 9, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique12pt7b", 12, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique18pt7b", 18, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique24pt7b", 24, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerif9pt7b", 9, 3, 0},
+    {"Free Serif", "FreeSerif12pt7b", 12, 3, 0},
+    {"Free Serif", "FreeSerif18pt7b", 18, 3, 0},
+    {"Free Serif", "FreeSerif24pt7b", 24, 3, 0},
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBold9pt7b", 9, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold12pt7b", 12, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold18pt7b", 18, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold24pt7b", 24, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Orbitron", "Orbitron_Light_24", 24, 4, 0},
+    {"Roboto", "Roboto_Thin_24", 24, 5, 0},
+    {"Satisfy", "Satisfy_24", 24, 5, 0},
+    {"Yellowtail", "Yellowtail_32", 32, 5, 0},
+    {"DejaVu", "DejaVu9", 9, 6, 0},
+    {"DejaVu", "DejaVu12", 12, 6, 0},
+    {"DejaVu", "DejaVu18", 18, 6, 0},
+    {"DejaVu", "DejaVu24", 24, 6, 0},
+    {"DejaVu", "DejaVu40", 40, 6, 0},
+    {"DejaVu", "DejaVu56", 56, 6, 0},
+    {"DejaVu", "DejaVu72", 72, 6, 0},
+};
+#define FONT_CATALOG_OBJECTS
+#define FONT_CATALOG_ENTRIES \
+    {"lgfx_fonts", "Font0", 0, &fonts::Font0}, \
+    {"lgfx_fonts", "Font2", 2, &fonts::Font2}, \
+    {"lgfx_fonts", "Font4", 4, &fonts::Font4}, \
+    {"lgfx_fonts", "Font6", 6, &fonts::Font6}, \
+    {"lgfx_fonts", "Font7", 7, &fonts::Font7}, \
+    {"lgfx_fonts", "Font8", 8, &fonts::Font8}, \
+    {"lgfx_fonts", "TomThumb", 0, &fonts::TomThumb}, \
+    {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b}, \
+    {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b}, \
+    {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b}, \
+    {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b}, \
+    {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b}, \
+    {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b}, \
+    {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b}, \
+    {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b}, \
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b}, \
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b}, \
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b}, \
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b}, \
+    {"Free Sans", "FreeSans9pt7b", 9, &fonts::FreeSans9pt7b}, \
+    {"Free Sans", "FreeSans12pt7b", 12, &fonts::FreeSans12pt7b}, \
+    {"Free Sans", "FreeSans18pt7b", 18, &fonts::FreeSans18pt7b}, \
+    {"Free Sans", "FreeSans24pt7b", 24, &fonts::FreeSans24pt7b}, \
+    {"Free Sans", "FreeSansBold9pt7b", 9, &fonts::FreeSansBold9pt7b}, \
+    {"Free Sans", "FreeSansBold12pt7b", 12, &fonts::FreeSansBold12pt7b}, \
+    {"Free Sans", "FreeSansBold18pt7b", 18, &fonts::FreeSansBold18pt7b}, \
+    {"Free Sans", "FreeSansBold24pt7b", 24, &fonts::FreeSansBold24pt7b}, \
+    {"Free Sans", "FreeSansOblique9pt7b", 9, &fonts::FreeSansOblique9pt7b}, \
+    {"Free Sans", "FreeSansOblique12pt7b", 12, &fonts::FreeSansOblique12pt7b}, \
+    {"Free Sans", "FreeSansOblique18pt7b", 18, &fonts::FreeSansOblique18pt7b}, \
+    {"Free Sans", "FreeSansOblique24pt7b", 24, &fonts::FreeSansOblique24pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, &fonts::FreeSansBoldOblique9pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, &fonts::FreeSansBoldOblique12pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, &fonts::FreeSansBoldOblique18pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, &fonts::FreeSansBoldOblique24pt7b}, \
+    {"Free Serif", "FreeSerif9pt7b", 9, &fonts::FreeSerif9pt7b}, \
+    {"Free Serif", "FreeSerif12pt7b", 12, &fonts::FreeSerif12pt7b}, \
+    {"Free Serif", "FreeSerif18pt7b", 18, &fonts::FreeSerif18pt7b}, \
+    {"Free Serif", "FreeSerif24pt7b", 24, &fonts::FreeSerif24pt7b}, \
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, &fonts::FreeSerifItalic9pt7b}, \
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, &fonts::FreeSerifItalic12pt7b}, \
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, &fonts::FreeSerifItalic18pt7b}, \
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, &fonts::FreeSerifItalic24pt7b}, \
+    {"Free Serif", "FreeSerifBold9pt7b", 9, &fonts::FreeSerifBold9pt7b}, \
+    {"Free Serif", "FreeSerifBold12pt7b", 12, &fonts::FreeSerifBold12pt7b}, \
+    {"Free Serif", "FreeSerifBold18pt7b", 18, &fonts::FreeSerifBold18pt7b}, \
+    {"Free Serif", "FreeSerifBold24pt7b", 24, &fonts::FreeSerifBold24pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, &fonts::FreeSerifBoldItalic9pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, &fonts::FreeSerifBoldItalic12pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, &fonts::FreeSerifBoldItalic18pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, &fonts::FreeSerifBoldItalic24pt7b}, \
+    {"Orbitron", "Orbitron_Light_24", 24, &fonts::Orbitron_Light_24}, \
+    {"Roboto", "Roboto_Thin_24", 24, &fonts::Roboto_Thin_24}, \
+    {"Satisfy", "Satisfy_24", 24, &fonts::Satisfy_24}, \
+    {"Yellowtail", "Yellowtail_32", 32, &fonts::Yellowtail_32}, \
+    {"DejaVu", "DejaVu9", 9, &fonts::DejaVu9}, \
+    {"DejaVu", "DejaVu12", 12, &fonts::DejaVu12}, \
+    {"DejaVu", "DejaVu18", 18, &fonts::DejaVu18}, \
+    {"DejaVu", "DejaVu24", 24, &fonts::DejaVu24}, \
+    {"DejaVu", "DejaVu40", 40, &fonts::DejaVu40}, \
+    {"DejaVu", "DejaVu56", 56, &fonts::DejaVu56}, \
+    {"DejaVu", "DejaVu72", 72, &fonts::DejaVu72},
+#elif FONT_PROFILE == FONT_PROFILE_FULL && defined(TRUETYPE_FONTS)
+#define FONT_PROFILE_NAME "full"
+#define FONT_CATALOG_HAS_CJK 1
+static constexpr int FONT_CATALOG_FAMILY_COUNT = 12;
+static constexpr int FONT_CATALOG_FONT_COUNT = 112;
+static constexpr int FONT_CATALOG_MONO_COUNT = 37;
+static constexpr int FONT_CATALOG_MAX_SIZE = 72;
+static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {
+    {"lgfx_fonts", 0, 7},
+    {"Free Mono", 7, 16},
+    {"Free Sans", 23, 16},
+    {"Free Serif", 39, 16},
+    {"Orbitron", 55, 1},
+    {"Roboto", 56, 3},
+    {"DejaVu", 59, 7},
+    {"TrueType", 66, 16},
+    {"JapanMincho", 82, 10},
+    {"JapanGothic", 92, 10},
+    {"eFontCN", 102, 5},
+    {"eFontJA", 107, 5},
+};
+static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {
+    {"lgfx_fonts", "Font0", 0, 0, FONT_TRAIT_MONO},
+    {"lgfx_fonts", "Font2", 2, 0, 0},
+    {"lgfx_fonts", "Font4", 4, 0, 0},
+    {"lgfx_fonts", "Font6", 6, 0, 0},
+    {"lgfx_fonts", "Font7", 7, 0, 0},
+    {"lgfx_fonts", "Font8", 8, 0, 0},
+    {"lgfx_fonts", "TomThumb", 0, 0, 0},
+    {"Free Mono", "FreeMono9pt7b", 9, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono12pt7b", 12, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono18pt7b", 18, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono24pt7b", 24, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Sans", "FreeSans9pt7b", 9, 2, 0},
+    {"Free Sans", "FreeSans12pt7b", 12, 2, 0},
+    {"Free Sans", "FreeSans18pt7b", 18, 2, 0},
+    {"Free Sans", "FreeSans24pt7b", 24, 2, 0},
+    {"Free Sans", "FreeSansBold9pt7b", 9, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold12pt7b", 12, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold18pt7b", 18, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold24pt7b", 24, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansOblique9pt7b", 9, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique12pt7b", 12, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique18pt7b", 18, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique24pt7b", 24, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerif9pt7b", 9, 3, 0},
+    {"Free Serif", "FreeSerif12pt7b", 12, 3, 0},
+    {"Free Serif", "FreeSerif18pt7b", 18, 3, 0},
+    {"Free Serif", "FreeSerif24pt7b", 24, 3, 0},
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBold9pt7b", 9, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold12pt7b", 12, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold18pt7b", 18, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold24pt7b", 24, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Orbitron", "Orbitron_Light_24", 24, 4, 0},
+    {"Roboto", "Roboto_Thin_24", 24, 5, 0},
+    {"Satisfy", "Satisfy_24", 24, 5, 0},
+    {"Yellowtail", "Yellowtail_32", 32, 5, 0},
+    {"DejaVu", "DejaVu9", 9, 6, 0},
+    {"DejaVu", "DejaVu12", 12, 6, 0},
+    {"DejaVu", "DejaVu18", 18, 6, 0},
+    {"DejaVu", "DejaVu24", 24, 6, 0},
+    {"DejaVu", "DejaVu40", 40, 6, 0},
+    {"DejaVu", "DejaVu56", 56, 6, 0},
+    {"DejaVu", "DejaVu72", 72, 6, 0},
+    {"TrueType", "TrueType_8", 8, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_10", 10, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_12", 12, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_14", 14, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_16", 16, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_18", 18, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_20", 20, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_24", 24, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_28", 28, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_32", 32, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_36", 36, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_40", 40, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_48", 48, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_56", 56, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_64", 64, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_72", 72, 7, FONT_TRAIT_SCALABLE},
+    {"JapanMincho", "lgfxJapanMincho_8", 8, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMincho_12", 12, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMincho_16", 16, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMincho_20", 20, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMincho_24", 24, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_8", 8, 8, FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_12", 12, 8, FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_16", 16, 8, FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_20", 20, 8, FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_24", 24, 8, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_8", 8, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_12", 12, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_16", 16, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_20", 20, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_24", 24, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_8", 8, 9, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_12", 12, 9, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_16", 16, 9, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_20", 20, 9, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_24", 24, 9, FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_10", 10, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_12", 12, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_14", 14, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_16", 16, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_24", 24, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_10", 10, 11, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_12", 12, 11, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_14", 14, 11, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_16", 16, 11, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_24", 24, 11, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+};
+#define FONT_CATALOG_OBJECTS \
+    static const ScalableFont ttf8(0, 8); \
+    static const ScalableFont ttf10(0, 10); \
+    static const ScalableFont ttf12(0, 12); \
+    static const ScalableFont ttf14(0, 14); \
+    static const ScalableFont ttf16(0, 16); \
+    static const ScalableFont ttf18(0, 18); \
+    static const ScalableFont ttf20(0, 20); \
+    static const ScalableFont ttf24(0, 24); \
+    static const ScalableFont ttf28(0, 28); \
+    static const ScalableFont ttf32(0, 32); \
+    static const ScalableFont ttf36(0, 36); \
+    static const ScalableFont ttf40(0, 40); \
+    static const ScalableFont ttf48(0, 48); \
+    static const ScalableFont ttf56(0, 56); \
+    static const ScalableFont ttf64(0, 64); \
+    static const ScalableFont ttf72(0, 72);
+#define FONT_CATALOG_ENTRIES \
+    {"lgfx_fonts", "Font0", 0, &fonts::Font0}, \
+    {"lgfx_fonts", "Font2", 2, &fonts::Font2}, \
+    {"lgfx_fonts", "Font4", 4, &fonts::Font4}, \
+    {"lgfx_fonts", "Font6", 6, &fonts::Font6}, \
+    {"lgfx_fonts", "Font7", 7, &fonts::Font7}, \
+    {"lgfx_fonts", "Font8", 8, &fonts::Font8}, \
+    {"lgfx_fonts", "TomThumb", 0, &fonts::TomThumb}, \
+    {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b}, \
+    {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b}, \
+    {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b}, \
+    {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b}, \
+    {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b}, \
+    {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b}, \
+    {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b}, \
+    {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b}, \
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b}, \
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b}, \
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b}, \
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b}, \
+    {"Free Sans", "FreeSans9pt7b", 9, &fonts::FreeSans9pt7b}, \
+    {"Free Sans", "FreeSans12pt7b", 12, &fonts::FreeSans12pt7b}, \
+    {"Free Sans", "FreeSans18pt7b", 18, &fonts::FreeSans18pt7b}, \
+    {"Free Sans", "FreeSans24pt7b", 24, &fonts::FreeSans24pt7b}, \
+    {"Free Sans", "FreeSansBold9pt7b", 9, &fonts::FreeSansBold9pt7b}, \
+    {"Free Sans", "FreeSansBold12pt7b", 12, &fonts::FreeSansBold12pt7b}, \
+    {"Free Sans", "FreeSansBold18pt7b", 18, &fonts::FreeSansBold18pt7b}, \
+    {"Free Sans", "FreeSansBold24pt7b", 24, &fonts::FreeSansBold24pt7b}, \
+    {"Free Sans", "FreeSansOblique9pt7b", 9, &fonts::FreeSansOblique9pt7b}, \
+    {"Free Sans", "FreeSansOblique12pt7b", 12, &fonts::FreeSansOblique12pt7b}, \
+    {"Free Sans", "FreeSansOblique18pt7b", 18, &fonts::FreeSansOblique18pt7b}, \
+    {"Free Sans", "FreeSansOblique24pt7b", 24, &fonts::FreeSansOblique24pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, &fonts::FreeSansBoldOblique9pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, &fonts::FreeSansBoldOblique12pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, &fonts::FreeSansBoldOblique18pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, &fonts::FreeSansBoldOblique24pt7b}, \
+    {"Free Serif", "FreeSerif9pt7b", 9, &fonts::FreeSerif9pt7b}, \
+    {"Free Serif", "FreeSerif12pt7b", 12, &fonts::FreeSerif12pt7b}, \
+    {"Free Serif", "FreeSerif18pt7b", 18, &fonts::FreeSerif18pt7b}, \
+    {"Free Serif", "FreeSerif24pt7b", 24, &fonts::FreeSerif24pt7b}, \
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, &fonts::FreeSerifItalic9pt7b}, \
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, &fonts::FreeSerifItalic12pt7b}, \
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, &fonts::FreeSerifItalic18pt7b}, \
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, &fonts::FreeSerifItalic24pt7b}, \
+    {"Free Serif", "FreeSerifBold9pt7b", 9, &fonts::FreeSerifBold9pt7b}, \
+    {"Free Serif", "FreeSerifBold12pt7b", 12, &fonts::FreeSerifBold12pt7b}, \
+    {"Free Serif", "FreeSerifBold18pt7b", 18, &fonts::FreeSerifBold18pt7b}, \
+    {"Free Serif", "FreeSerifBold24pt7b", 24, &fonts::FreeSerifBold24pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, &fonts::FreeSerifBoldItalic9pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, &fonts::FreeSerifBoldItalic12pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, &fonts::FreeSerifBoldItalic18pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, &fonts::FreeSerifBoldItalic24pt7b}, \
+    {"Orbitron", "Orbitron_Light_24", 24, &fonts::Orbitron_Light_24}, \
+    {"Roboto", "Roboto_Thin_24", 24, &fonts::Roboto_Thin_24}, \
+    {"Satisfy", "Satisfy_24", 24, &fonts::Satisfy_24}, \
+    {"Yellowtail", "Yellowtail_32", 32, &fonts::Yellowtail_32}, \
+    {"DejaVu", "DejaVu9", 9, &fonts::DejaVu9}, \
+    {"DejaVu", "DejaVu12", 12, &fonts::DejaVu12}, \
+    {"DejaVu", "DejaVu18", 18, &fonts::DejaVu18}, \
+    {"DejaVu", "DejaVu24", 24, &fonts::DejaVu24}, \
+    {"DejaVu", "DejaVu40", 40, &fonts::DejaVu40}, \
+    {"DejaVu", "DejaVu56", 56, &fonts::DejaVu56}, \
+    {"DejaVu", "DejaVu72", 72, &fonts::DejaVu72}, \
+    {"TrueType", "TrueType_8", 8, &ttf8}, \
+    {"TrueType", "TrueType_10", 10, &ttf10}, \
+    {"TrueType", "TrueType_12", 12, &ttf12}, \
+    {"TrueType", "TrueType_14", 14, &ttf14}, \
+    {"TrueType", "TrueType_16", 16, &ttf16}, \
+    {"TrueType", "TrueType_18", 18, &ttf18}, \
+    {"TrueType", "TrueType_20", 20, &ttf20}, \
+    {"TrueType", "TrueType_24", 24, &ttf24}, \
+    {"TrueType", "TrueType_28", 28, &ttf28}, \
+    {"TrueType", "TrueType_32", 32, &ttf32}, \
+    {"TrueType", "TrueType_36", 36, &ttf36}, \
+    {"TrueType", "TrueType_40", 40, &ttf40}, \
+    {"TrueType", "TrueType_48", 48, &ttf48}, \
+    {"TrueType", "TrueType_56", 56, &ttf56}, \
+    {"TrueType", "TrueType_64", 64, &ttf64}, \
+    {"TrueType", "TrueType_72", 72, &ttf72}, \
+    {"JapanMincho", "lgfxJapanMincho_8", 8, &fonts::lgfxJapanMincho_8}, \
+    {"JapanMincho", "lgfxJapanMincho_12", 12, &fonts::lgfxJapanMincho_12}, \
+    {"JapanMincho", "lgfxJapanMincho_16", 16, &fonts::lgfxJapanMincho_16}, \
+    {"JapanMincho", "lgfxJapanMincho_20", 20, &fonts::lgfxJapanMincho_20}, \
+    {"JapanMincho", "lgfxJapanMincho_24", 24, &fonts::lgfxJapanMincho_24}, \
+    {"JapanMincho", "lgfxJapanMinchoP_8", 8, &fonts::lgfxJapanMinchoP_8}, \
+    {"JapanMincho", "lgfxJapanMinchoP_12", 12, &fonts::lgfxJapanMinchoP_12}, \
+    {"JapanMincho", "lgfxJapanMinchoP_16", 16, &fonts::lgfxJapanMinchoP_16}, \
+    {"JapanMincho", "lgfxJapanMinchoP_20", 20, &fonts::lgfxJapanMinchoP_20}, \
+    {"JapanMincho", "lgfxJapanMinchoP_24", 24, &fonts::lgfxJapanMinchoP_24}, \
+    {"JapanGothic", "lgfxJapanGothic_8", 8, &fonts::lgfxJapanGothic_8}, \
+    {"JapanGothic", "lgfxJapanGothic_12", 12, &fonts::lgfxJapanGothic_12}, \
+    {"JapanGothic", "lgfxJapanGothic_16", 16, &fonts::lgfxJapanGothic_16}, \
+    {"JapanGothic", "lgfxJapanGothic_20", 20, &fonts::lgfxJapanGothic_20}, \
+    {"JapanGothic", "lgfxJapanGothic_24", 24, &fonts::lgfxJapanGothic_24}, \
+    {"JapanGothic", "lgfxJapanGothicP_8", 8, &fonts::lgfxJapanGothicP_8}, \
+    {"JapanGothic", "lgfxJapanGothicP_12", 12, &fonts::lgfxJapanGothicP_12}, \
+    {"JapanGothic", "lgfxJapanGothicP_16", 16, &fonts::lgfxJapanGothicP_16}, \
+    {"JapanGothic", "lgfxJapanGothicP_20", 20, &fonts::lgfxJapanGothicP_20}, \
+    {"JapanGothic", "lgfxJapanGothicP_24", 24, &fonts::lgfxJapanGothicP_24}, \
+    {"eFontCN", "efontCN_10", 10, &fonts::efontCN_10}, \
+    {"eFontCN", "efontCN_12", 12, &fonts::efontCN_12}, \
+    {"eFontCN", "efontCN_14", 14, &fonts::efontCN_14}, \
+    {"eFontCN", "efontCN_16", 16, &fonts::efontCN_16}, \
+    {"eFontCN", "efontCN_24", 24, &fonts::efontCN_24}, \
+    {"eFontJA", "efontJA_10", 10, &fonts::efontJA_10}, \
+    {"eFontJA", "efontJA_12", 12, &fonts::efontJA_12}, \
+    {"eFontJA", "efontJA_14", 14, &fonts::efontJA_14}, \
+    {"eFontJA", "efontJA_16", 16, &fonts::efontJA_16}, \
+    {"eFontJA", "efontJA_24", 24, &fonts::efontJA_24},
+#elif FONT_PROFILE == FONT_PROFILE_FULL && !defined(TRUETYPE_FONTS)
+#define FONT_PROFILE_NAME "full"
+#define FONT_CATALOG_HAS_CJK 1
+static constexpr int FONT_CATALOG_FAMILY_COUNT = 11;
+static constexpr int FONT_CATALOG_FONT_COUNT = 96;
+static constexpr int FONT_CATALOG_MONO_COUNT = 37;
+static constexpr int FONT_CATALOG_MAX_SIZE = 72;
+static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {
+    {"lgfx_fonts", 0, 7},
+    {"Free Mono", 7, 16},
+    {"Free Sans", 23, 16},
+    {"Free Serif", 39, 16},
+    {"Orbitron", 55, 1},
+    {"Roboto", 56, 3},
+    {"DejaVu", 59, 7},
+    {"JapanMincho", 66, 10},
+    {"JapanGothic", 76, 10},
+    {"eFontCN", 86, 5},
+    {"eFontJA", 91, 5},
+};
+static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {
+    {"lgfx_fonts", "Font0", 0, 0, FONT_TRAIT_MONO},
+    {"lgfx_fonts", "Font2", 2, 0, 0},
+    {"lgfx_fonts", "Font4", 4, 0, 0},
+    {"lgfx_fonts", "Font6", 6, 0, 0},
+    {"lgfx_fonts", "Font7", 7, 0, 0},
+    {"lgfx_fonts", "Font8", 8, 0, 0},
+    {"lgfx_fonts", "TomThumb", 0, 0, 0},
+    {"Free Mono", "FreeMono9pt7b", 9, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono12pt7b", 12, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono18pt7b", 18, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono24pt7b", 24, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Sans", "FreeSans9pt7b", 9, 2, 0},
+    {"Free Sans", "FreeSans12pt7b", 12, 2, 0},
+    {"Free Sans", "FreeSans18pt7b", 18, 2, 0},
+    {"Free Sans", "FreeSans24pt7b", 24, 2, 0},
+    {"Free Sans", "FreeSansBold9pt7b", 9, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold12pt7b", 12, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold18pt7b", 18, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold24pt7b", 24, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansOblique9pt7b", 9, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique12pt7b", 12, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique18pt7b", 18, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique24pt7b", 24, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerif9pt7b", 9, 3, 0},
+    {"Free Serif", "FreeSerif12pt7b", 12, 3, 0},
+    {"Free Serif", "FreeSerif18pt7b", 18, 3, 0},
+    {"Free Serif", "FreeSerif24pt7b", 24, 3, 0},
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBold9pt7b", 9, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold12pt7b", 12, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold18pt7b", 18, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold24pt7b", 24, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Orbitron", "Orbitron_Light_24", 24, 4, 0},
+    {"Roboto", "Roboto_Thin_24", 24, 5, 0},
+    {"Satisfy", "Satisfy_24", 24, 5, 0},
+    {"Yellowtail", "Yellowtail_32", 32, 5, 0},
+    {"DejaVu", "DejaVu9", 9, 6, 0},
+    {"DejaVu", "DejaVu12", 12, 6, 0},
+    {"DejaVu", "DejaVu18", 18, 6, 0},
+    {"DejaVu", "DejaVu24", 24, 6, 0},
+    {"DejaVu", "DejaVu40", 40, 6, 0},
+    {"DejaVu", "DejaVu56", 56, 6, 0},
+    {"DejaVu", "DejaVu72", 72, 6, 0},
+    {"JapanMincho", "lgfxJapanMincho_8", 8, 7, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMincho_12", 12, 7, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMincho_16", 16, 7, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMincho_20", 20, 7, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMincho_24", 24, 7, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_8", 8, 7, FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_12", 12, 7, FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_16", 16, 7, FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_20", 20, 7, FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_24", 24, 7, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_8", 8, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_12", 12, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_16", 16, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_20", 20, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_24", 24, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_8", 8, 8, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_12", 12, 8, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_16", 16, 8, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_20", 20, 8, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_24", 24, 8, FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_10", 10, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_12", 12, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_14", 14, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_16", 16, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_24", 24, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_10", 10, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_12", 12, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_14", 14, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_16", 16, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_24", 24, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+};
+#define FONT_CATALOG_OBJECTS
+#define FONT_CATALOG_ENTRIES \
+    {"lgfx_fonts", "Font0", 0, &fonts::Font0}, \
+    {"lgfx_fonts", "Font2", 2, &fonts::Font2}, \
+    {"lgfx_fonts", "Font4", 4, &fonts::Font4}, \
+    {"lgfx_fonts", "Font6", 6, &fonts::Font6}, \
+    {"lgfx_fonts", "Font7", 7, &fonts::Font7}, \
+    {"lgfx_fonts", "Font8", 8, &fonts::Font8}, \
+    {"lgfx_fonts", "TomThumb", 0, &fonts::TomThumb}, \
+    {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b}, \
+    {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b}, \
+    {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b}, \
+    {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b}, \
+    {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b}, \
+    {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b}, \
+    {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b}, \
+    {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b}, \
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b}, \
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b}, \
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b}, \
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b}, \
+    {"Free Sans", "FreeSans9pt7b", 9, &fonts::FreeSans9pt7b}, \
+    {"Free Sans", "FreeSans12pt7b", 12, &fonts::FreeSans12pt7b}, \
+    {"Free Sans", "FreeSans18pt7b", 18, &fonts::FreeSans18pt7b}, \
+    {"Free Sans", "FreeSans24pt7b", 24, &fonts::FreeSans24pt7b}, \
+    {"Free Sans", "FreeSansBold9pt7b", 9, &fonts::FreeSansBold9pt7b}, \
+    {"Free Sans", "FreeSansBold12pt7b", 12, &fonts::FreeSansBold12pt7b}, \
+    {"Free Sans", "FreeSansBold18pt7b", 18, &fonts::FreeSansBold18pt7b}, \
+    {"Free Sans", "FreeSansBold24pt7b", 24, &fonts::FreeSansBold24pt7b}, \
+    {"Free Sans", "FreeSansOblique9pt7b", 9, &fonts::FreeSansOblique9pt7b}, \
+    {"Free Sans", "FreeSansOblique12pt7b", 12, &fonts::FreeSansOblique12pt7b}, \
+    {"Free Sans", "FreeSansOblique18pt7b", 18, &fonts::FreeSansOblique18pt7b}, \
+    {"Free Sans", "FreeSansOblique24pt7b", 24, &fonts::FreeSansOblique24pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, &fonts::FreeSansBoldOblique9pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, &fonts::FreeSansBoldOblique12pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, &fonts::FreeSansBoldOblique18pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, &fonts::FreeSansBoldOblique24pt7b}, \
+    {"Free Serif", "FreeSerif9pt7b", 9, &fonts::FreeSerif9pt7b}, \
+    {"Free Serif", "FreeSerif12pt7b", 12, &fonts::FreeSerif12pt7b}, \
+    {"Free Serif", "FreeSerif18pt7b", 18, &fonts::FreeSerif18pt7b}, \
+    {"Free Serif", "FreeSerif24pt7b", 24, &fonts::FreeSerif24pt7b}, \
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, &fonts::FreeSerifItalic9pt7b}, \
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, &fonts::FreeSerifItalic12pt7b}, \
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, &fonts::FreeSerifItalic18pt7b}, \
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, &fonts::FreeSerifItalic24pt7b}, \
+    {"Free Serif", "FreeSerifBold9pt7b", 9, &fonts::FreeSerifBold9pt7b}, \
+    {"Free Serif", "FreeSerifBold12pt7b", 12, &fonts::FreeSerifBold12pt7b}, \
+    {"Free Serif", "FreeSerifBold18pt7b", 18, &fonts::FreeSerifBold18pt7b}, \
+    {"Free Serif", "FreeSerifBold24pt7b", 24, &fonts::FreeSerifBold24pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, &fonts::FreeSerifBoldItalic9pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, &fonts::FreeSerifBoldItalic12pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, &fonts::FreeSerifBoldItalic18pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, &fonts::FreeSerifBoldItalic24pt7b}, \
+    {"Orbitron", "Orbitron_Light_24", 24, &fonts::Orbitron_Light_24}, \
+    {"Roboto", "Roboto_Thin_24", 24, &fonts::Roboto_Thin_24}, \
+    {"Satisfy", "Satisfy_24", 24, &fonts::Satisfy_24}, \
+    {"Yellowtail", "Yellowtail_32", 32, &fonts::Yellowtail_32}, \
+    {"DejaVu", "DejaVu9", 9, &fonts::DejaVu9}, \
+    {"DejaVu", "DejaVu12", 12, &fonts::DejaVu12}, \
+    {"DejaVu", "DejaVu18", 18, &fonts::DejaVu18}, \
+    {"DejaVu", "DejaVu24", 24, &fonts::DejaVu24}, \
+    {"DejaVu", "DejaVu40", 40, &fonts::DejaVu40}, \
+    {"DejaVu", "DejaVu56", 56, &fonts::DejaVu56}, \
+    {"DejaVu", "DejaVu72", 72, &fonts::DejaVu72}, \
+    {"JapanMincho", "lgfxJapanMincho_8", 8, &fonts::lgfxJapanMincho_8}, \
+    {"JapanMincho", "lgfxJapanMincho_12", 12, &fonts::lgfxJapanMincho_12}, \
+    {"JapanMincho", "lgfxJapanMincho_16", 16, &fonts::lgfxJapanMincho_16}, \
+    {"JapanMincho", "lgfxJapanMincho_20", 20, &fonts::lgfxJapanMincho_20}, \
+    {"JapanMincho", "lgfxJapanMincho_24", 24, &fonts::lgfxJapanMincho_24}, \
+    {"JapanMincho", "lgfxJapanMinchoP_8", 8, &fonts::lgfxJapanMinchoP_8}, \
+    {"JapanMincho", "lgfxJapanMinchoP_12", 12, &fonts::lgfxJapanMinchoP_12}, \
+    {"JapanMincho", "lgfxJapanMinchoP_16", 16, &fonts::lgfxJapanMinchoP_16}, \
+    {"JapanMincho", "lgfxJapanMinchoP_20", 20, &fonts::lgfxJapanMinchoP_20}, \
+    {"JapanMincho", "lgfxJapanMinchoP_24", 24, &fonts::lgfxJapanMinchoP_24}, \
+    {"JapanGothic", "lgfxJapanGothic_8", 8, &fonts::lgfxJapanGothic_8}, \
+    {"JapanGothic", "lgfxJapanGothic_12", 12, &fonts::lgfxJapanGothic_12}, \
+    {"JapanGothic", "lgfxJapanGothic_16", 16, &fonts::lgfxJapanGothic_16}, \
+    {"JapanGothic", "lgfxJapanGothic_20", 20, &fonts::lgfxJapanGothic_20}, \
+    {"JapanGothic", "lgfxJapanGothic_24", 24, &fonts::lgfxJapanGothic_24}, \
+    {"JapanGothic", "lgfxJapanGothicP_8", 8, &fonts::lgfxJapanGothicP_8}, \
+    {"JapanGothic", "lgfxJapanGothicP_12", 12, &fonts::lgfxJapanGothicP_12}, \
+    {"JapanGothic", "lgfxJapanGothicP_16", 16, &fonts::lgfxJapanGothicP_16}, \
+    {"JapanGothic", "lgfxJapanGothicP_20", 20, &fonts::lgfxJapanGothicP_20}, \
+    {"JapanGothic", "lgfxJapanGothicP_24", 24, &fonts::lgfxJapanGothicP_24}, \
+    {"eFontCN", "efontCN_10", 10, &fonts::efontCN_10}, \
+    {"eFontCN", "efontCN_12", 12, &fonts::efontCN_12}, \
+    {"eFontCN", "efontCN_14", 14, &fonts::efontCN_14}, \
+    {"eFontCN", "efontCN_16", 16, &fonts::efontCN_16}, \
+    {"eFontCN", "efontCN_24", 24, &fonts::efontCN_24}, \
+    {"eFontJA", "efontJA_10", 10, &fonts::efontJA_10}, \
+    {"eFontJA", "efontJA_12", 12, &fonts::efontJA_12}, \
+    {"eFontJA", "efontJA_14", 14, &fonts::efontJA_14}, \
+    {"eFontJA", "efontJA_16", 16, &fonts::efontJA_16}, \
+    {"eFontJA", "efontJA_24", 24, &fonts::efontJA_24},
+#elif FONT_PROFILE == FONT_PROFILE_MONO && defined(TRUETYPE_FONTS)
+#define FONT_PROFILE_NAME "mono"
+#define FONT_CATALOG_HAS_CJK 0
+static constexpr int FONT_CATALOG_FAMILY_COUNT = 2;
+static constexpr int FONT_CATALOG_FONT_COUNT = 17;
+static constexpr int FONT_CATALOG_MONO_COUNT = 17;
+static constexpr int FONT_CATALOG_MAX_SIZE = 24;
+static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {
+    {"lgfx_fonts", 0, 1},
+    {"Free Mono", 1, 16},
+};
+static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {
+    {"lgfx_fonts", "Font0", 0, 0, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono9pt7b", 9, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono12pt7b", 12, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono18pt7b", 18, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono24pt7b", 24, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+};
+#define FONT_CATALOG_OBJECTS
+#define FONT_CATALOG_ENTRIES \
+    {"lgfx_fonts", "Font0", 0, &fonts::Font0}, \
+    {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b}, \
+    {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b}, \
+    {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b}, \
+    {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b}, \
+    {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b}, \
+    {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b}, \
+    {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b}, \
+    {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b}, \
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b}, \
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b}, \
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b}, \
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b},
+#elif FONT_PROFILE == FONT_PROFILE_MONO && !defined(TRUETYPE_FONTS)
+#define FONT_PROFILE_NAME "mono"
+#define FONT_CATALOG_HAS_CJK 0
+static constexpr int FONT_CATALOG_FAMILY_COUNT = 2;
+static constexpr int FONT_CATALOG_FONT_COUNT = 17;
+static constexpr int FONT_CATALOG_MONO_COUNT = 17;
+static constexpr int FONT_CATALOG_MAX_SIZE = 24;
+static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {
+    {"lgfx_fonts", 0, 1},
+    {"Free Mono", 1, 16},
+};
+static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {
+    {"lgfx_fonts", "Font0", 0, 0, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono9pt7b", 9, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono12pt7b", 12, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono18pt7b", 18, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono24pt7b", 24, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+};
+#define FONT_CATALOG_OBJECTS
+#define FONT_CATALOG_ENTRIES \
+    {"lgfx_fonts", "Font0", 0, &fonts::Font0}, \
+    {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b}, \
+    {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b}, \
+    {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b}, \
+    {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b}, \
+    {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b}, \
+    {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b}, \
+    {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b}, \
+    {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b}, \
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b}, \
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b}, \
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b}, \
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b},
+#elif FONT_PROFILE == FONT_PROFILE_LATIN_CJK16 && defined(TRUETYPE_FONTS)
+#define FONT_PROFILE_NAME "latin-cjk16"
+#define FONT_CATALOG_HAS_CJK 1
+static constexpr int FONT_CATALOG_FAMILY_COUNT = 12;
+static constexpr int FONT_CATALOG_FONT_COUNT = 88;
+static constexpr int FONT_CATALOG_MONO_COUNT = 21;
+static constexpr int FONT_CATALOG_MAX_SIZE = 72;
+static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {
+    {"lgfx_fonts", 0, 7},
+    {"Free Mono", 7, 16},
+    {"Free Sans", 23, 16},
+    {"Free Serif", 39, 16},
+    {"Orbitron", 55, 1},
+    {"Roboto", 56, 3},
+    {"DejaVu", 59, 7},
+    {"TrueType", 66, 16},
+    {"JapanMincho", 82, 2},
+    {"JapanGothic", 84, 2},
+    {"eFontCN", 86, 1},
+    {"eFontJA", 87, 1},
+};
+static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {
+    {"lgfx_fonts", "Font0", 0, 0, FONT_TRAIT_MONO},
+    {"lgfx_fonts", "Font2", 2, 0, 0},
+    {"lgfx_fonts", "Font4", 4, 0, 0},
+    {"lgfx_fonts", "Font6", 6, 0, 0},
+    {"lgfx_fonts", "Font7", 7, 0, 0},
+    {"lgfx_fonts", "Font8", 8, 0, 0},
+    {"lgfx_fonts", "TomThumb", 0, 0, 0},
+    {"Free Mono", "FreeMono9pt7b", 9, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono12pt7b", 12, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono18pt7b", 18, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono24pt7b", 24, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Sans", "FreeSans9pt7b", 9, 2, 0},
+    {"Free Sans", "FreeSans12pt7b", 12, 2, 0},
+    {"Free Sans", "FreeSans18pt7b", 18, 2, 0},
+    {"Free Sans", "FreeSans24pt7b", 24, 2, 0},
+    {"Free Sans", "FreeSansBold9pt7b", 9, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold12pt7b", 12, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold18pt7b", 18, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold24pt7b", 24, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansOblique9pt7b", 9, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique12pt7b", 12, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique18pt7b", 18, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique24pt7b", 24, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerif9pt7b", 9, 3, 0},
+    {"Free Serif", "FreeSerif12pt7b", 12, 3, 0},
+    {"Free Serif", "FreeSerif18pt7b", 18, 3, 0},
+    {"Free Serif", "FreeSerif24pt7b", 24, 3, 0},
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBold9pt7b", 9, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold12pt7b", 12, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold18pt7b", 18, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold24pt7b", 24, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Orbitron", "Orbitron_Light_24", 24, 4, 0},
+    {"Roboto", "Roboto_Thin_24", 24, 5, 0},
+    {"Satisfy", "Satisfy_24", 24, 5, 0},
+    {"Yellowtail", "Yellowtail_32", 32, 5, 0},
+    {"DejaVu", "DejaVu9", 9, 6, 0},
+    {"DejaVu", "DejaVu12", 12, 6, 0},
+    {"DejaVu", "DejaVu18", 18, 6, 0},
+    {"DejaVu", "DejaVu24", 24, 6, 0},
+    {"DejaVu", "DejaVu40", 40, 6, 0},
+    {"DejaVu", "DejaVu56", 56, 6, 0},
+    {"DejaVu", "DejaVu72", 72, 6, 0},
+    {"TrueType", "TrueType_8", 8, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_10", 10, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_12", 12, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_14", 14, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_16", 16, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_18", 18, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_20", 20, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_24", 24, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_28", 28, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_32", 32, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_36", 36, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_40", 40, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_48", 48, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_56", 56, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_64", 64, 7, FONT_TRAIT_SCALABLE},
+    {"TrueType", "TrueType_72", 72, 7, FONT_TRAIT_SCALABLE},
+    {"JapanMincho", "lgfxJapanMincho_16", 16, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_16", 16, 8, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_16", 16, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_16", 16, 9, FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_16", 16, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_16", 16, 11, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+};
+#define FONT_CATALOG_OBJECTS \
+    static const ScalableFont ttf8(0, 8); \
+    static const ScalableFont ttf10(0, 10); \
+    static const ScalableFont ttf12(0, 12); \
+    static const ScalableFont ttf14(0, 14); \
+    static const ScalableFont ttf16(0, 16); \
+    static const ScalableFont ttf18(0, 18); \
+    static const ScalableFont ttf20(0, 20); \
+    static const ScalableFont ttf24(0, 24); \
+    static const ScalableFont ttf28(0, 28); \
+    static const ScalableFont ttf32(0, 32); \
+    static const ScalableFont ttf36(0, 36); \
+    static const ScalableFont ttf40(0, 40); \
+    static const ScalableFont ttf48(0, 48); \
+    static const ScalableFont ttf56(0, 56); \
+    static const ScalableFont ttf64(0, 64); \
+    static const ScalableFont ttf72(0, 72);
+#define FONT_CATALOG_ENTRIES \
+    {"lgfx_fonts", "Font0", 0, &fonts::Font0}, \
+    {"lgfx_fonts", "Font2", 2, &fonts::Font2}, \
+    {"lgfx_fonts", "Font4", 4, &fonts::Font4}, \
+    {"lgfx_fonts", "Font6", 6, &fonts::Font6}, \
+    {"lgfx_fonts", "Font7", 7, &fonts::Font7}, \
+    {"lgfx_fonts", "Font8", 8, &fonts::Font8}, \
+    {"lgfx_fonts", "TomThumb", 0, &fonts::TomThumb}, \
+    {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b}, \
+    {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b}, \
+    {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b}, \
+    {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b}, \
+    {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b}, \
+    {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b}, \
+    {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b}, \
+    {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b}, \
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b}, \
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b}, \
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b}, \
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b}, \
+    {"Free Sans", "FreeSans9pt7b", 9, &fonts::FreeSans9pt7b}, \
+    {"Free Sans", "FreeSans12pt7b", 12, &fonts::FreeSans12pt7b}, \
+    {"Free Sans", "FreeSans18pt7b", 18, &fonts::FreeSans18pt7b}, \
+    {"Free Sans", "FreeSans24pt7b", 24, &fonts::FreeSans24pt7b}, \
+    {"Free Sans", "FreeSansBold9pt7b", 9, &fonts::FreeSansBold9pt7b}, \
+    {"Free Sans", "FreeSansBold12pt7b", 12, &fonts::FreeSansBold12pt7b}, \
+    {"Free Sans", "FreeSansBold18pt7b", 18, &fonts::FreeSansBold18pt7b}, \
+    {"Free Sans", "FreeSansBold24pt7b", 24, &fonts::FreeSansBold24pt7b}, \
+    {"Free Sans", "FreeSansOblique9pt7b", 9, &fonts::FreeSansOblique9pt7b}, \
+    {"Free Sans", "FreeSansOblique12pt7b", 12, &fonts::FreeSansOblique12pt7b}, \
+    {"Free Sans", "FreeSansOblique18pt7b", 18, &fonts::FreeSansOblique18pt7b}, \
+    {"Free Sans", "FreeSansOblique24pt7b", 24, &fonts::FreeSansOblique24pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, &fonts::FreeSansBoldOblique9pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, &fonts::FreeSansBoldOblique12pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, &fonts::FreeSansBoldOblique18pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, &fonts::FreeSansBoldOblique24pt7b}, \
+    {"Free Serif", "FreeSerif9pt7b", 9, &fonts::FreeSerif9pt7b}, \
+    {"Free Serif", "FreeSerif12pt7b", 12, &fonts::FreeSerif12pt7b}, \
+    {"Free Serif", "FreeSerif18pt7b", 18, &fonts::FreeSerif18pt7b}, \
+    {"Free Serif", "FreeSerif24pt7b", 24, &fonts::FreeSerif24pt7b}, \
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, &fonts::FreeSerifItalic9pt7b}, \
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, &fonts::FreeSerifItalic12pt7b}, \
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, &fonts::FreeSerifItalic18pt7b}, \
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, &fonts::FreeSerifItalic24pt7b}, \
+    {"Free Serif", "FreeSerifBold9pt7b", 9, &fonts::FreeSerifBold9pt7b}, \
+    {"Free Serif", "FreeSerifBold12pt7b", 12, &fonts::FreeSerifBold12pt7b}, \
+    {"Free Serif", "FreeSerifBold18pt7b", 18, &fonts::FreeSerifBold18pt7b}, \
+    {"Free Serif", "FreeSerifBold24pt7b", 24, &fonts::FreeSerifBold24pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, &fonts::FreeSerifBoldItalic9pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, &fonts::FreeSerifBoldItalic12pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, &fonts::FreeSerifBoldItalic18pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, &fonts::FreeSerifBoldItalic24pt7b}, \
+    {"Orbitron", "Orbitron_Light_24", 24, &fonts::Orbitron_Light_24}, \
+    {"Roboto", "Roboto_Thin_24", 24, &fonts::Roboto_Thin_24}, \
+    {"Satisfy", "Satisfy_24", 24, &fonts::Satisfy_24}, \
+    {"Yellowtail", "Yellowtail_32", 32, &fonts::Yellowtail_32}, \
+    {"DejaVu", "DejaVu9", 9, &fonts::DejaVu9}, \
+    {"DejaVu", "DejaVu12", 12, &fonts::DejaVu12}, \
+    {"DejaVu", "DejaVu18", 18, &fonts::DejaVu18}, \
+    {"DejaVu", "DejaVu24", 24, &fonts::DejaVu24}, \
+    {"DejaVu", "DejaVu40", 40, &fonts::DejaVu40}, \
+    {"DejaVu", "DejaVu56", 56, &fonts::DejaVu56}, \
+    {"DejaVu", "DejaVu72", 72, &fonts::DejaVu72}, \
+    {"TrueType", "TrueType_8", 8, &ttf8}, \
+    {"TrueType", "TrueType_10", 10, &ttf10}, \
+    {"TrueType", "TrueType_12", 12, &ttf12}, \
+    {"TrueType", "TrueType_14", 14, &ttf14}, \
+    {"TrueType", "TrueType_16", 16, &ttf16}, \
+    {"TrueType", "TrueType_18", 18, &ttf18}, \
+    {"TrueType", "TrueType_20", 20, &ttf20}, \
+    {"TrueType", "TrueType_24", 24, &ttf24}, \
+    {"TrueType", "TrueType_28", 28, &ttf28}, \
+    {"TrueType", "TrueType_32", 32, &ttf32}, \
+    {"TrueType", "TrueType_36", 36, &ttf36}, \
+    {"TrueType", "TrueType_40", 40, &ttf40}, \
+    {"TrueType", "TrueType_48", 48, &ttf48}, \
+    {"TrueType", "TrueType_56", 56, &ttf56}, \
+    {"TrueType", "TrueType_64", 64, &ttf64}, \
+    {"TrueType", "TrueType_72", 72, &ttf72}, \
+    {"JapanMincho", "lgfxJapanMincho_16", 16, &fonts::lgfxJapanMincho_16}, \
+    {"JapanMincho", "lgfxJapanMinchoP_16", 16, &fonts::lgfxJapanMinchoP_16}, \
+    {"JapanGothic", "lgfxJapanGothic_16", 16, &fonts::lgfxJapanGothic_16}, \
+    {"JapanGothic", "lgfxJapanGothicP_16", 16, &fonts::lgfxJapanGothicP_16}, \
+    {"eFontCN", "efontCN_16", 16, &fonts::efontCN_16}, \
+    {"eFontJA", "efontJA_16", 16, &fonts::efontJA_16},
+#elif FONT_PROFILE == FONT_PROFILE_LATIN_CJK16 && !defined(TRUETYPE_FONTS)
+#define FONT_PROFILE_NAME "latin-cjk16"
+#define FONT_CATALOG_HAS_CJK 1
+static constexpr int FONT_CATALOG_FAMILY_COUNT = 11;
+static constexpr int FONT_CATALOG_FONT_COUNT = 72;
+static constexpr int FONT_CATALOG_MONO_COUNT = 21;
+static constexpr int FONT_CATALOG_MAX_SIZE = 72;
+static constexpr CatalogFamily FONT_CATALOG_FAMILIES[FONT_CATALOG_FAMILY_COUNT] = {
+    {"lgfx_fonts", 0, 7},
+    {"Free Mono", 7, 16},
+    {"Free Sans", 23, 16},
+    {"Free Serif", 39, 16},
+    {"Orbitron", 55, 1},
+    {"Roboto", 56, 3},
+    {"DejaVu", 59, 7},
+    {"JapanMincho", 66, 2},
+    {"JapanGothic", 68, 2},
+    {"eFontCN", 70, 1},
+    {"eFontJA", 71, 1},
+};
+static constexpr CatalogFont FONT_CATALOG_FONTS[FONT_CATALOG_FONT_COUNT] = {
+    {"lgfx_fonts", "Font0", 0, 0, FONT_TRAIT_MONO},
+    {"lgfx_fonts", "Font2", 2, 0, 0},
+    {"lgfx_fonts", "Font4", 4, 0, 0},
+    {"lgfx_fonts", "Font6", 6, 0, 0},
+    {"lgfx_fonts", "Font7", 7, 0, 0},
+    {"lgfx_fonts", "Font8", 8, 0, 0},
+    {"lgfx_fonts", "TomThumb", 0, 0, 0},
+    {"Free Mono", "FreeMono9pt7b", 9, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono12pt7b", 12, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono18pt7b", 18, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMono24pt7b", 24, 1, FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBold24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, 1, FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, 1, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC | FONT_TRAIT_MONO},
+    {"Free Sans", "FreeSans9pt7b", 9, 2, 0},
+    {"Free Sans", "FreeSans12pt7b", 12, 2, 0},
+    {"Free Sans", "FreeSans18pt7b", 18, 2, 0},
+    {"Free Sans", "FreeSans24pt7b", 24, 2, 0},
+    {"Free Sans", "FreeSansBold9pt7b", 9, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold12pt7b", 12, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold18pt7b", 18, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansBold24pt7b", 24, 2, FONT_TRAIT_BOLD},
+    {"Free Sans", "FreeSansOblique9pt7b", 9, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique12pt7b", 12, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique18pt7b", 18, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansOblique24pt7b", 24, 2, FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, 2, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerif9pt7b", 9, 3, 0},
+    {"Free Serif", "FreeSerif12pt7b", 12, 3, 0},
+    {"Free Serif", "FreeSerif18pt7b", 18, 3, 0},
+    {"Free Serif", "FreeSerif24pt7b", 24, 3, 0},
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, 3, FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBold9pt7b", 9, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold12pt7b", 12, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold18pt7b", 18, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBold24pt7b", 24, 3, FONT_TRAIT_BOLD},
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, 3, FONT_TRAIT_BOLD | FONT_TRAIT_ITALIC},
+    {"Orbitron", "Orbitron_Light_24", 24, 4, 0},
+    {"Roboto", "Roboto_Thin_24", 24, 5, 0},
+    {"Satisfy", "Satisfy_24", 24, 5, 0},
+    {"Yellowtail", "Yellowtail_32", 32, 5, 0},
+    {"DejaVu", "DejaVu9", 9, 6, 0},
+    {"DejaVu", "DejaVu12", 12, 6, 0},
+    {"DejaVu", "DejaVu18", 18, 6, 0},
+    {"DejaVu", "DejaVu24", 24, 6, 0},
+    {"DejaVu", "DejaVu40", 40, 6, 0},
+    {"DejaVu", "DejaVu56", 56, 6, 0},
+    {"DejaVu", "DejaVu72", 72, 6, 0},
+    {"JapanMincho", "lgfxJapanMincho_16", 16, 7, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanMincho", "lgfxJapanMinchoP_16", 16, 7, FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothic_16", 16, 8, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"JapanGothic", "lgfxJapanGothicP_16", 16, 8, FONT_TRAIT_CJK},
+    {"eFontCN", "efontCN_16", 16, 9, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+    {"eFontJA", "efontJA_16", 16, 10, FONT_TRAIT_MONO | FONT_TRAIT_CJK},
+};
+#define FONT_CATALOG_OBJECTS
+#define FONT_CATALOG_ENTRIES \
+    {"lgfx_fonts", "Font0", 0, &fonts::Font0}, \
+    {"lgfx_fonts", "Font2", 2, &fonts::Font2}, \
+    {"lgfx_fonts", "Font4", 4, &fonts::Font4}, \
+    {"lgfx_fonts", "Font6", 6, &fonts::Font6}, \
+    {"lgfx_fonts", "Font7", 7, &fonts::Font7}, \
+    {"lgfx_fonts", "Font8", 8, &fonts::Font8}, \
+    {"lgfx_fonts", "TomThumb", 0, &fonts::TomThumb}, \
+    {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b}, \
+    {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b}, \
+    {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b}, \
+    {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b}, \
+    {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b}, \
+    {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b}, \
+    {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b}, \
+    {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b}, \
+    {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b}, \
+    {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b}, \
+    {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b}, \
+    {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b}, \
+    {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b}, \
+    {"Free Sans", "FreeSans9pt7b", 9, &fonts::FreeSans9pt7b}, \
+    {"Free Sans", "FreeSans12pt7b", 12, &fonts::FreeSans12pt7b}, \
+    {"Free Sans", "FreeSans18pt7b", 18, &fonts::FreeSans18pt7b}, \
+    {"Free Sans", "FreeSans24pt7b", 24, &fonts::FreeSans24pt7b}, \
+    {"Free Sans", "FreeSansBold9pt7b", 9, &fonts::FreeSansBold9pt7b}, \
+    {"Free Sans", "FreeSansBold12pt7b", 12, &fonts::FreeSansBold12pt7b}, \
+    {"Free Sans", "FreeSansBold18pt7b", 18, &fonts::FreeSansBold18pt7b}, \
+    {"Free Sans", "FreeSansBold24pt7b", 24, &fonts::FreeSansBold24pt7b}, \
+    {"Free Sans", "FreeSansOblique9pt7b", 9, &fonts::FreeSansOblique9pt7b}, \
+    {"Free Sans", "FreeSansOblique12pt7b", 12, &fonts::FreeSansOblique12pt7b}, \
+    {"Free Sans", "FreeSansOblique18pt7b", 18, &fonts::FreeSansOblique18pt7b}, \
+    {"Free Sans", "FreeSansOblique24pt7b", 24, &fonts::FreeSansOblique24pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique9pt7b", 9, &fonts::FreeSansBoldOblique9pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique12pt7b", 12, &fonts::FreeSansBoldOblique12pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique18pt7b", 18, &fonts::FreeSansBoldOblique18pt7b}, \
+    {"Free Sans", "FreeSansBoldOblique24pt7b", 24, &fonts::FreeSansBoldOblique24pt7b}, \
+    {"Free Serif", "FreeSerif9pt7b", 9, &fonts::FreeSerif9pt7b}, \
+    {"Free Serif", "FreeSerif12pt7b", 12, &fonts::FreeSerif12pt7b}, \
+    {"Free Serif", "FreeSerif18pt7b", 18, &fonts::FreeSerif18pt7b}, \
+    {"Free Serif", "FreeSerif24pt7b", 24, &fonts::FreeSerif24pt7b}, \
+    {"Free Serif", "FreeSerifItalic9pt7b", 9, &fonts::FreeSerifItalic9pt7b}, \
+    {"Free Serif", "FreeSerifItalic12pt7b", 12, &fonts::FreeSerifItalic12pt7b}, \
+    {"Free Serif", "FreeSerifItalic18pt7b", 18, &fonts::FreeSerifItalic18pt7b}, \
+    {"Free Serif", "FreeSerifItalic24pt7b", 24, &fonts::FreeSerifItalic24pt7b}, \
+    {"Free Serif", "FreeSerifBold9pt7b", 9, &fonts::FreeSerifBold9pt7b}, \
+    {"Free Serif", "FreeSerifBold12pt7b", 12, &fonts::FreeSerifBold12pt7b}, \
+    {"Free Serif", "FreeSerifBold18pt7b", 18, &fonts::FreeSerifBold18pt7b}, \
+    {"Free Serif", "FreeSerifBold24pt7b", 24, &fonts::FreeSerifBold24pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, &fonts::FreeSerifBoldItalic9pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, &fonts::FreeSerifBoldItalic12pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, &fonts::FreeSerifBoldItalic18pt7b}, \
+    {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, &fonts::FreeSerifBoldItalic24pt7b}, \
+    {"Orbitron", "Orbitron_Light_24", 24, &fonts::Orbitron_Light_24}, \
+    {"Roboto", "Roboto_Thin_24", 24, &fonts::Roboto_Thin_24}, \
+    {"Satisfy", "Satisfy_24", 24, &fonts::Satisfy_24}, \
+    {"Yellowtail", "Yellowtail_32", 32, &fonts::Yellowtail_32}, \
+    {"DejaVu", "DejaVu9", 9, &fonts::DejaVu9}, \
+    {"DejaVu", "DejaVu12", 12, &fonts::DejaVu12}, \
+    {"DejaVu", "DejaVu18", 18, &fonts::DejaVu18}, \
+    {"DejaVu", "DejaVu24", 24, &fonts::DejaVu24}, \
+    {"DejaVu", "DejaVu40", 40, &fonts::DejaVu40}, \
+    {"DejaVu", "DejaVu56", 56, &fonts::DejaVu56}, \
+    {"DejaVu", "DejaVu72", 72, &fonts::DejaVu72}, \
+    {"JapanMincho", "lgfxJapanMincho_16", 16, &fonts::lgfxJapanMincho_16}, \
+    {"JapanMincho", "lgfxJapanMinchoP_16", 16, &fonts::lgfxJapanMinchoP_16}, \
+    {"JapanGothic", "lgfxJapanGothic_16", 16, &fonts::lgfxJapanGothic_16}, \
+    {"JapanGothic", "lgfxJapanGothicP_16", 16, &fonts::lgfxJapanGothicP_16}, \
+    {"eFontCN", "efontCN_16", 16, &fonts::efontCN_16}, \
+    {"eFontJA", "efontJA_16", 16, &fonts::efontJA_16},
+#else
+#error "Unknown FONT_PROFILE, see the FONT_PROFILE_ list above"
+#endif
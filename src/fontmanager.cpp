@@ -11,170 +11,41 @@
  */
 
 #include "fontmanager.hpp"
-#include <M5Unified.h> // For font definitions
-
-// Define font families with font pointers for easy iteration
-const FontInfo fontFamilies[][20] = {
-    // Built-in LGFX fonts
-    {
-        {"lgfx_fonts", "Font0", 0, &fonts::Font0},
-        {"lgfx_fonts", "Font2", 2, &fonts::Font2},
-        {"lgfx_fonts", "Font4", 4, &fonts::Font4},
-        {"lgfx_fonts", "Font6", 6, &fonts::Font6},
-        {"lgfx_fonts", "Font7", 7, &fonts::Font7},
-        {"lgfx_fonts", "Font8", 8, &fonts::Font8},
-        {"lgfx_fonts", "TomThumb", 0, &fonts::TomThumb},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // Free Mono family
-    {
-        {"Free Mono", "FreeMono9pt7b", 9, &fonts::FreeMono9pt7b},
-        {"Free Mono", "FreeMono12pt7b", 12, &fonts::FreeMono12pt7b},
-        {"Free Mono", "FreeMono18pt7b", 18, &fonts::FreeMono18pt7b},
-        {"Free Mono", "FreeMono24pt7b", 24, &fonts::FreeMono24pt7b},
-        {"Free Mono", "FreeMonoBold9pt7b", 9, &fonts::FreeMonoBold9pt7b},
-        {"Free Mono", "FreeMonoBold12pt7b", 12, &fonts::FreeMonoBold12pt7b},
-        {"Free Mono", "FreeMonoBold18pt7b", 18, &fonts::FreeMonoBold18pt7b},
-        {"Free Mono", "FreeMonoBold24pt7b", 24, &fonts::FreeMonoBold24pt7b},
-        {"Free Mono", "FreeMonoOblique9pt7b", 9, &fonts::FreeMonoOblique9pt7b},
-        {"Free Mono", "FreeMonoOblique12pt7b", 12, &fonts::FreeMonoOblique12pt7b},
-        {"Free Mono", "FreeMonoOblique18pt7b", 18, &fonts::FreeMonoOblique18pt7b},
-        {"Free Mono", "FreeMonoOblique24pt7b", 24, &fonts::FreeMonoOblique24pt7b},
-        {"Free Mono", "FreeMonoBoldOblique9pt7b", 9, &fonts::FreeMonoBoldOblique9pt7b},
-        {"Free Mono", "FreeMonoBoldOblique12pt7b", 12, &fonts::FreeMonoBoldOblique12pt7b},
-        {"Free Mono", "FreeMonoBoldOblique18pt7b", 18, &fonts::FreeMonoBoldOblique18pt7b},
-        {"Free Mono", "FreeMonoBoldOblique24pt7b", 24, &fonts::FreeMonoBoldOblique24pt7b},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // Free Sans family
-    {
-        {"Free Sans", "FreeSans9pt7b", 9, &fonts::FreeSans9pt7b},
-        {"Free Sans", "FreeSans12pt7b", 12, &fonts::FreeSans12pt7b},
-        {"Free Sans", "FreeSans18pt7b", 18, &fonts::FreeSans18pt7b},
-        {"Free Sans", "FreeSans24pt7b", 24, &fonts::FreeSans24pt7b},
-        {"Free Sans", "FreeSansBold9pt7b", 9, &fonts::FreeSansBold9pt7b},
-        {"Free Sans", "FreeSansBold12pt7b", 12, &fonts::FreeSansBold12pt7b},
-        {"Free Sans", "FreeSansBold18pt7b", 18, &fonts::FreeSansBold18pt7b},
-        {"Free Sans", "FreeSansBold24pt7b", 24, &fonts::FreeSansBold24pt7b},
-        {"Free Sans", "FreeSansOblique9pt7b", 9, &fonts::FreeSansOblique9pt7b},
-        {"Free Sans", "FreeSansOblique12pt7b", 12, &fonts::FreeSansOblique12pt7b},
-        {"Free Sans", "FreeSansOblique18pt7b", 18, &fonts::FreeSansOblique18pt7b},
-        {"Free Sans", "FreeSansOblique24pt7b", 24, &fonts::FreeSansOblique24pt7b},
-        {"Free Sans", "FreeSansBoldOblique9pt7b", 9, &fonts::FreeSansBoldOblique9pt7b},
-        {"Free Sans", "FreeSansBoldOblique12pt7b", 12, &fonts::FreeSansBoldOblique12pt7b},
-        {"Free Sans", "FreeSansBoldOblique18pt7b", 18, &fonts::FreeSansBoldOblique18pt7b},
-        {"Free Sans", "FreeSansBoldOblique24pt7b", 24, &fonts::FreeSansBoldOblique24pt7b},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // Free Serif family
-    {
-        {"Free Serif", "FreeSerif9pt7b", 9, &fonts::FreeSerif9pt7b},
-        {"Free Serif", "FreeSerif12pt7b", 12, &fonts::FreeSerif12pt7b},
-        {"Free Serif", "FreeSerif18pt7b", 18, &fonts::FreeSerif18pt7b},
-        {"Free Serif", "FreeSerif24pt7b", 24, &fonts::FreeSerif24pt7b},
-        {"Free Serif", "FreeSerifItalic9pt7b", 9, &fonts::FreeSerifItalic9pt7b},
-        {"Free Serif", "FreeSerifItalic12pt7b", 12, &fonts::FreeSerifItalic12pt7b},
-        {"Free Serif", "FreeSerifItalic18pt7b", 18, &fonts::FreeSerifItalic18pt7b},
-        {"Free Serif", "FreeSerifItalic24pt7b", 24, &fonts::FreeSerifItalic24pt7b},
-        {"Free Serif", "FreeSerifBold9pt7b", 9, &fonts::FreeSerifBold9pt7b},
-        {"Free Serif", "FreeSerifBold12pt7b", 12, &fonts::FreeSerifBold12pt7b},
-        {"Free Serif", "FreeSerifBold18pt7b", 18, &fonts::FreeSerifBold18pt7b},
-        {"Free Serif", "FreeSerifBold24pt7b", 24, &fonts::FreeSerifBold24pt7b},
-        {"Free Serif", "FreeSerifBoldItalic9pt7b", 9, &fonts::FreeSerifBoldItalic9pt7b},
-        {"Free Serif", "FreeSerifBoldItalic12pt7b", 12, &fonts::FreeSerifBoldItalic12pt7b},
-        {"Free Serif", "FreeSerifBoldItalic18pt7b", 18, &fonts::FreeSerifBoldItalic18pt7b},
-        {"Free Serif", "FreeSerifBoldItalic24pt7b", 24, &fonts::FreeSerifBoldItalic24pt7b},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // Orbitron family
-    {
-        {"Orbitron", "Orbitron_Light_24", 24, &fonts::Orbitron_Light_24},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // Roboto and other decorative fonts
-    {
-        {"Roboto", "Roboto_Thin_24", 24, &fonts::Roboto_Thin_24},
-        {"Satisfy", "Satisfy_24", 24, &fonts::Satisfy_24},
-        {"Yellowtail", "Yellowtail_32", 32, &fonts::Yellowtail_32},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // DejaVu family
-    {
-        {"DejaVu", "DejaVu9", 9, &fonts::DejaVu9},
-        {"DejaVu", "DejaVu12", 12, &fonts::DejaVu12},
-        {"DejaVu", "DejaVu18", 18, &fonts::DejaVu18},
-        {"DejaVu", "DejaVu24", 24, &fonts::DejaVu24},
-        {"DejaVu", "DejaVu40", 40, &fonts::DejaVu40},
-        {"DejaVu", "DejaVu56", 56, &fonts::DejaVu56},
-        {"DejaVu", "DejaVu72", 72, &fonts::DejaVu72},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    }
-#ifndef ENGLISH_FONTS_ONLY
-    // East Asian fonts - these are VERY large (several MB each)
-    // Only include when building with ALL_FONTS=1 or sufficient flash space
-    ,
-    // Japanese Mincho family
-    {
-        {"JapanMincho", "lgfxJapanMincho_8", 8, &fonts::lgfxJapanMincho_8},
-        {"JapanMincho", "lgfxJapanMincho_12", 12, &fonts::lgfxJapanMincho_12},
-        {"JapanMincho", "lgfxJapanMincho_16", 16, &fonts::lgfxJapanMincho_16},
-        {"JapanMincho", "lgfxJapanMincho_20", 20, &fonts::lgfxJapanMincho_20},
-        {"JapanMincho", "lgfxJapanMincho_24", 24, &fonts::lgfxJapanMincho_24},
-        {"JapanMincho", "lgfxJapanMinchoP_8", 8, &fonts::lgfxJapanMinchoP_8},
-        {"JapanMincho", "lgfxJapanMinchoP_12", 12, &fonts::lgfxJapanMinchoP_12},
-        {"JapanMincho", "lgfxJapanMinchoP_16", 16, &fonts::lgfxJapanMinchoP_16},
-        {"JapanMincho", "lgfxJapanMinchoP_20", 20, &fonts::lgfxJapanMinchoP_20},
-        {"JapanMincho", "lgfxJapanMinchoP_24", 24, &fonts::lgfxJapanMinchoP_24},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // Japanese Gothic family
-    {
-        {"JapanGothic", "lgfxJapanGothic_8", 8, &fonts::lgfxJapanGothic_8},
-        {"JapanGothic", "lgfxJapanGothic_12", 12, &fonts::lgfxJapanGothic_12},
-        {"JapanGothic", "lgfxJapanGothic_16", 16, &fonts::lgfxJapanGothic_16},
-        {"JapanGothic", "lgfxJapanGothic_20", 20, &fonts::lgfxJapanGothic_20},
-        {"JapanGothic", "lgfxJapanGothic_24", 24, &fonts::lgfxJapanGothic_24},
-        {"JapanGothic", "lgfxJapanGothicP_8", 8, &fonts::lgfxJapanGothicP_8},
-        {"JapanGothic", "lgfxJapanGothicP_12", 12, &fonts::lgfxJapanGothicP_12},
-        {"JapanGothic", "lgfxJapanGothicP_16", 16, &fonts::lgfxJapanGothicP_16},
-        {"JapanGothic", "lgfxJapanGothicP_20", 20, &fonts::lgfxJapanGothicP_20},
-        {"JapanGothic", "lgfxJapanGothicP_24", 24, &fonts::lgfxJapanGothicP_24},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // eFontCN family (Chinese)
-    {
-        {"eFontCN", "efontCN_10", 10, &fonts::efontCN_10},
-        {"eFontCN", "efontCN_12", 12, &fonts::efontCN_12},
-        {"eFontCN", "efontCN_14", 14, &fonts::efontCN_14},
-        {"eFontCN", "efontCN_16", 16, &fonts::efontCN_16},
-        {"eFontCN", "efontCN_24", 24, &fonts::efontCN_24},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    },
-    // eFontJA family (Japanese)
-    {
-        {"eFontJA", "efontJA_10", 10, &fonts::efontJA_10},
-        {"eFontJA", "efontJA_12", 12, &fonts::efontJA_12},
-        {"eFontJA", "efontJA_14", 14, &fonts::efontJA_14},
-        {"eFontJA", "efontJA_16", 16, &fonts::efontJA_16},
-        {"eFontJA", "efontJA_24", 24, &fonts::efontJA_24},
-        {nullptr, nullptr, 0, nullptr} // End marker
-    }
-#endif // !ENGLISH_FONTS_ONLY
-
-};
-
-const int NUM_FONT_FAMILIES = sizeof(fontFamilies) / sizeof(fontFamilies[0]);
+#include "fnv1a.hpp"
+#include <vector>
+#ifdef TRUETYPE_FONTS
+#include "scalablefont.hpp"
+#endif
 
 // Constructor implementation
 FontDisplayManager::FontDisplayManager(DeviceInterface *deviceInterface) : currentFamilyIndex(0),
                                                                            currentFontIndex(0),
+                                                                           currentFlatIndex(0),
                                                                            lastEncoderPosition(-999),
+                                                                           basePosition(0),
+                                                                           baseIndex(0),
                                                                            sampleText("Sample Text 123"),
                                                                            displayChanged(true),
-                                                                           device(deviceInterface)
+                                                                           overviewMode(false),
+                                                                           fontsPerPage(6),
+                                                                           currentPage(0),
+                                                                           lastFrameMicros(0),
+                                                                           transitionsEnabled(false),
+                                                                           previewsEnabled(false),
+                                                                           livePending(false),
+                                                                           pendingDirection(0),
+                                                                           encoderVelocity(0),
+                                                                           lastEncoderMillis(0),
+                                                                           device(deviceInterface),
+                                                                           clock(nullptr)
 {
 }
 
+void FontDisplayManager::setClock(ClockFunc clockFunc)
+{
+    clock = clockFunc;
+}
+
 void FontDisplayManager::setDevice(DeviceInterface *deviceInterface)
 {
     device = deviceInterface;
@@ -184,36 +55,25 @@ void FontDisplayManager::setDevice(DeviceInterface *deviceInterface)
 // Private method implementations
 int FontDisplayManager::getFontsInFamily(int familyIndex) const
 {
-    if (familyIndex < 0 || familyIndex >= NUM_FONT_FAMILIES)
+    if (familyIndex < 0 || familyIndex >= FONT_CATALOG_FAMILY_COUNT)
     {
         return 0;
     }
-
-    int count = 0;
-    while (fontFamilies[familyIndex][count].family != nullptr)
-    {
-        count++;
-    }
-    return count;
+    return FONT_CATALOG_FAMILIES[familyIndex].count;
 }
 
-String FontDisplayManager::getFamilyName(int familyIndex) const
+const char *FontDisplayManager::getFamilyName(int familyIndex) const
 {
-    if (familyIndex < 0 || familyIndex >= NUM_FONT_FAMILIES)
+    if (familyIndex < 0 || familyIndex >= FONT_CATALOG_FAMILY_COUNT)
     {
         return "Unknown";
     }
-
-    if (fontFamilies[familyIndex][0].family != nullptr)
-    {
-        return String(fontFamilies[familyIndex][0].family);
-    }
-    return "Empty Family";
+    return FONT_CATALOG_FAMILIES[familyIndex].name;
 }
 
-String FontDisplayManager::getFontName(int familyIndex, int fontIndex) const
+const char *FontDisplayManager::getFontName(int familyIndex, int fontIndex) const
 {
-    if (familyIndex < 0 || familyIndex >= NUM_FONT_FAMILIES)
+    if (familyIndex < 0 || familyIndex >= FONT_CATALOG_FAMILY_COUNT)
     {
         return "Invalid Family";
     }
@@ -224,45 +84,54 @@ String FontDisplayManager::getFontName(int familyIndex, int fontIndex) const
         return "Invalid Font";
     }
 
-    return String(fontFamilies[familyIndex][fontIndex].name);
+    return fontCatalog[FONT_CATALOG_FAMILIES[familyIndex].first + fontIndex].name;
 }
 
 void FontDisplayManager::mapEncoderToFont(long encoderPosition)
 {
-    // Calculate total number of fonts across all families
-    int totalFonts = 0;
-    for (int i = 0; i < NUM_FONT_FAMILIES; i++)
-    {
-        totalFonts += getFontsInFamily(i);
-    }
-
+    int totalFonts = getTotalFonts();
     if (totalFonts == 0)
     {
         currentFamilyIndex = 0;
         currentFontIndex = 0;
+        currentFlatIndex = 0;
         return;
     }
 
     // Ensure position is positive and wrap around
-    long positivePosition = ((encoderPosition % totalFonts) + totalFonts) % totalFonts;
+    long offset = baseIndex + (encoderPosition - basePosition);
+    selectFlatIndex(((offset % totalFonts) + totalFonts) % totalFonts);
+}
 
-    // Find which family and font index this position corresponds to
-    int currentPos = 0;
-    for (int familyIdx = 0; familyIdx < NUM_FONT_FAMILIES; familyIdx++)
+void FontDisplayManager::mapEncoderToPage(long encoderPosition)
+{
+    int pageCount = getPageCount();
+    if (pageCount == 0)
     {
-        int fontsInThisFamily = getFontsInFamily(familyIdx);
-        if (positivePosition < currentPos + fontsInThisFamily)
-        {
-            currentFamilyIndex = familyIdx;
-            currentFontIndex = positivePosition - currentPos;
-            return;
-        }
-        currentPos += fontsInThisFamily;
+        currentPage = 0;
+        return;
+    }
+
+    long offset = baseIndex + (encoderPosition - basePosition);
+    currentPage = ((offset % pageCount) + pageCount) % pageCount;
+}
+
+void FontDisplayManager::selectFlatIndex(int flatIndex)
+{
+    currentFlatIndex = flatIndex;
+
+    // The catalog records each font's family and each family's first font
+    if (flatIndex >= 0 && flatIndex < FONT_CATALOG_FONT_COUNT)
+    {
+        currentFamilyIndex = FONT_CATALOG_FONTS[flatIndex].familyIndex;
+        currentFontIndex = flatIndex - FONT_CATALOG_FAMILIES[currentFamilyIndex].first;
+        return;
     }
 
     // Fallback
     currentFamilyIndex = 0;
     currentFontIndex = 0;
+    currentFlatIndex = 0;
 }
 
 // Public method implementations
@@ -272,22 +141,80 @@ void FontDisplayManager::setSampleText(const char *text)
     displayChanged = true;
 }
 
-void FontDisplayManager::update(long encoderPosition)
+bool FontDisplayManager::update(long encoderPosition, unsigned long nowMillis)
 {
     // Check if encoder position has changed
     if (encoderPosition != lastEncoderPosition)
     {
-        mapEncoderToFont(encoderPosition);
+        if (overviewMode)
+        {
+            mapEncoderToPage(encoderPosition);
+        }
+        else
+        {
+            mapEncoderToFont(encoderPosition);
+        }
+
+        // Track direction and a smoothed speed to shape the transition
+        if (lastEncoderPosition != -999)
+        {
+            long delta = encoderPosition - lastEncoderPosition;
+            unsigned long elapsed = nowMillis - lastEncoderMillis;
+            float instant = (elapsed > 0) ? (delta < 0 ? -delta : delta) * 1000.0f / elapsed : 0.0f;
+            encoderVelocity = (elapsed > 500) ? instant : (encoderVelocity + instant) * 0.5f;
+            lastEncoderMillis = nowMillis;
+            pendingDirection = (delta > 0) ? 1 : -1;
+        }
+
         lastEncoderPosition = encoderPosition;
         displayChanged = true;
     }
 
+    // A running transition owns the screen; newer fonts wait and the ones
+    // in between are dropped rather than queued
+    if (device != nullptr && device->updateTransition(displayChanged))
+    {
+        return true;
+    }
+
+    // The thumbnail shown by the last call gives way to the live render,
+    // unless a newer font is already waiting
+    if (livePending)
+    {
+        livePending = false;
+        if (!displayChanged)
+        {
+            displayCurrentFont();
+            return false;
+        }
+    }
+
     // Update display if needed
+    bool animating = false;
     if (displayChanged)
     {
-        displayCurrentFont();
+        if (transitionsEnabled && !overviewMode && pendingDirection != 0 && device != nullptr)
+        {
+            device->setTransition(pendingDirection, encoderVelocity);
+            animating = true;
+        }
+        pendingDirection = 0;
+
+        // A thumbnail is a decode and a blit; while the dial keeps turning
+        // only thumbnails are drawn
+        if (previewsEnabled && !overviewMode && device != nullptr &&
+            device->displayPreview(currentFlatIndex, sampleText))
+        {
+            livePending = true;
+            animating = true;
+        }
+        else
+        {
+            displayCurrentFont();
+        }
         displayChanged = false;
     }
+    return animating;
 }
 
 void FontDisplayManager::displayCurrentFont()
@@ -297,27 +224,90 @@ void FontDisplayManager::displayCurrentFont()
         return; // Cannot display without a device
     }
 
-    String familyName = getFamilyName(currentFamilyIndex);
-    String fontName = getFontName(currentFamilyIndex, currentFontIndex);
-    int fontSize = getCurrentFontSize();
-    const lgfx::IFont *fontPtr = getCurrentFontPtr();
+    uint32_t frameStart = (clock != nullptr) ? clock() : 0;
 
-    device->displayFont(familyName, fontName, fontSize, fontPtr, sampleText);
+    if (overviewMode)
+    {
+        int first = currentPage * fontsPerPage;
+        int count = getTotalFonts() - first;
+        if (count > fontsPerPage)
+        {
+            count = fontsPerPage;
+        }
+        if (count < 0)
+        {
+            count = 0;
+        }
+
+        device->displayFontPage(&fontCatalog[first], count, fontsPerPage,
+                                sampleText, currentPage, getPageCount());
+    }
+    else
+    {
+        const char *familyName = getFamilyName(currentFamilyIndex);
+        const char *fontName = getFontName(currentFamilyIndex, currentFontIndex);
+        int fontSize = getCurrentFontSize();
+        const void *fontPtr = getCurrentFontPtr();
+
+        device->displayFont(familyName, fontName, fontSize, fontPtr, sampleText);
+    }
+
+    lastFrameMicros = (clock != nullptr) ? clock() - frameStart : 0;
 }
 
-String FontDisplayManager::getCurrentFamilyName() const
+void FontDisplayManager::render()
+{
+    if (device != nullptr)
+    {
+        while (device->updateTransition(true))
+        {
+        }
+    }
+
+    pendingDirection = 0;
+    livePending = false;
+    displayCurrentFont();
+    displayChanged = false;
+}
+
+void FontDisplayManager::selectFont(int flatIndex)
+{
+    if (flatIndex < 0 || flatIndex >= getTotalFonts())
+    {
+        return;
+    }
+
+    overviewMode = false;
+    selectFlatIndex(flatIndex);
+    basePosition = (lastEncoderPosition == -999) ? 0 : lastEncoderPosition;
+    baseIndex = flatIndex;
+    pendingDirection = 0;
+    displayChanged = true;
+}
+
+int FontDisplayManager::getCurrentCatalogIndex() const
+{
+    return currentFlatIndex;
+}
+
+const char *FontDisplayManager::getSampleText() const
+{
+    return sampleText;
+}
+
+const char *FontDisplayManager::getCurrentFamilyName() const
 {
     return getFamilyName(currentFamilyIndex);
 }
 
-String FontDisplayManager::getCurrentFontName() const
+const char *FontDisplayManager::getCurrentFontName() const
 {
     return getFontName(currentFamilyIndex, currentFontIndex);
 }
 
 int FontDisplayManager::getTotalFamilies() const
 {
-    return NUM_FONT_FAMILIES;
+    return FONT_CATALOG_FAMILY_COUNT;
 }
 
 void FontDisplayManager::forceUpdate()
@@ -325,25 +315,165 @@ void FontDisplayManager::forceUpdate()
     displayChanged = true;
 }
 
+void FontDisplayManager::rebaseEncoder(long encoderPosition)
+{
+    basePosition = encoderPosition;
+    baseIndex = overviewMode ? currentPage : currentFlatIndex;
+    lastEncoderPosition = encoderPosition;
+}
+
 int FontDisplayManager::getCurrentFontSize() const
 {
-    if (currentFamilyIndex >= 0 && currentFamilyIndex < NUM_FONT_FAMILIES &&
+    if (currentFamilyIndex >= 0 && currentFamilyIndex < FONT_CATALOG_FAMILY_COUNT &&
         currentFontIndex >= 0 && currentFontIndex < getFontsInFamily(currentFamilyIndex))
     {
-        return fontFamilies[currentFamilyIndex][currentFontIndex].size;
+        return fontCatalog[FONT_CATALOG_FAMILIES[currentFamilyIndex].first + currentFontIndex].size;
     }
     return 0;
 }
 
-const lgfx::IFont *FontDisplayManager::getCurrentFontPtr() const
+const void *FontDisplayManager::getCurrentFontPtr() const
 {
-    if (currentFamilyIndex >= 0 && currentFamilyIndex < NUM_FONT_FAMILIES &&
+    if (currentFamilyIndex >= 0 && currentFamilyIndex < FONT_CATALOG_FAMILY_COUNT &&
         currentFontIndex >= 0 && currentFontIndex < getFontsInFamily(currentFamilyIndex))
     {
-        return fontFamilies[currentFamilyIndex][currentFontIndex].fontPtr;
+        return fontCatalog[FONT_CATALOG_FAMILIES[currentFamilyIndex].first + currentFontIndex].fontPtr;
     }
     return nullptr;
 }
 
+int FontDisplayManager::getTotalFonts()
+{
+    return FONT_CATALOG_FONT_COUNT;
+}
+
+const FontInfo *FontDisplayManager::getFontAt(int flatIndex)
+{
+    if (flatIndex < 0 || flatIndex >= getTotalFonts())
+    {
+        return nullptr;
+    }
+    return &fontCatalog[flatIndex];
+}
+
+uint32_t FontDisplayManager::getCatalogHash()
+{
+    uint32_t hash = FNV1A_SEED;
+    for (int i = 0; i < getTotalFonts(); i++)
+    {
+        hash = fnv1aString(fontCatalog[i].family, hash);
+        hash = fnv1aString(fontCatalog[i].name, hash);
+        hash = fnv1a(&fontCatalog[i].size, sizeof(fontCatalog[i].size), hash);
+    }
+#ifdef TRUETYPE_FONTS
+    // The same entries draw differently once another face file is loaded
+    uint32_t faceHash = scalableFonts.getHash();
+    hash = fnv1a(&faceHash, sizeof(faceHash), hash);
+#endif
+    return hash;
+}
+
+FontMetricsIndex &FontDisplayManager::getMetricsIndex()
+{
+    if (!metricsIndex.isBuilt())
+    {
+        std::vector<const void *> fonts;
+        for (int i = 0; i < getTotalFonts(); i++)
+        {
+            fonts.push_back(fontCatalog[i].fontPtr);
+        }
+        metricsIndex.build(fonts.data(), fonts.size(), measureFontVertical, measureGlyphAdvance);
+    }
+    return metricsIndex;
+}
+
+void FontDisplayManager::setOverviewMode(bool enabled)
+{
+    if (enabled == overviewMode)
+    {
+        return;
+    }
+
+    // Re-base the encoder so the view stays on the same fonts
+    // (before the first update the encoder is still at its boot position of 0)
+    basePosition = (lastEncoderPosition == -999) ? 0 : lastEncoderPosition;
+    if (enabled)
+    {
+        currentPage = currentFlatIndex / fontsPerPage;
+        baseIndex = currentPage;
+    }
+    else
+    {
+        selectFlatIndex(currentPage * fontsPerPage);
+        baseIndex = currentFlatIndex;
+    }
+
+    overviewMode = enabled;
+    displayChanged = true;
+}
+
+bool FontDisplayManager::isOverviewMode() const
+{
+    return overviewMode;
+}
+
+void FontDisplayManager::setFontsPerPage(int count)
+{
+    if (count < 1)
+    {
+        count = 1;
+    }
+    if (count > MAX_FONTS_PER_PAGE)
+    {
+        count = MAX_FONTS_PER_PAGE;
+    }
+
+    if (overviewMode)
+    {
+        // Keep the first font of the current page visible
+        currentPage = (currentPage * fontsPerPage) / count;
+        basePosition = (lastEncoderPosition == -999) ? 0 : lastEncoderPosition;
+        baseIndex = currentPage;
+    }
+
+    fontsPerPage = count;
+    displayChanged = true;
+}
+
+int FontDisplayManager::getCurrentPage() const
+{
+    return currentPage;
+}
+
+int FontDisplayManager::getPageCount()
+{
+    return (getTotalFonts() + fontsPerPage - 1) / fontsPerPage;
+}
+
+unsigned long FontDisplayManager::getLastFrameTime() const
+{
+    return lastFrameMicros;
+}
+
+void FontDisplayManager::setTransitionsEnabled(bool enabled)
+{
+    transitionsEnabled = enabled;
+}
+
+bool FontDisplayManager::areTransitionsEnabled() const
+{
+    return transitionsEnabled;
+}
+
+void FontDisplayManager::setPreviewsEnabled(bool enabled)
+{
+    previewsEnabled = enabled;
+}
+
+bool FontDisplayManager::arePreviewsEnabled() const
+{
+    return previewsEnabled;
+}
+
 // Global instance for easy access
 FontDisplayManager fontManager;
\ No newline at end of file
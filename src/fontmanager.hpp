@@ -8,12 +8,27 @@
  * @Dependent Library:
  * M5GFX: https://github.com/m5stack/M5GFX
  * M5Unified: https://github.com/m5stack/M5Unified
+ *
+ * Plain C++ with no Arduino dependencies: fonts are opaque pointers, and
+ * the catalog's font objects and their measuring are in lgfxfonts.cpp, so
+ * the manager runs unchanged in the host tests.
  */
 
 #pragma once
 
-#include <Arduino.h>
-#include "M5GFX.h" // For lgfx font types
+#include <stddef.h>
+#include <stdint.h>
+#include "fontcatalog.hpp"
+#include "fontmetricsindex.hpp"
+
+// One catalog font with the object that draws it
+struct FontInfo
+{
+    const char *family;
+    const char *name;
+    int size;
+    const void *fontPtr; // lgfx::IFont on the device
+};
 
 /**
  * @interface DeviceInterface
@@ -49,25 +64,118 @@ public:
      * @param familyName Font family name
      * @param fontName Font name
      * @param fontSize Font size
-     * @param fontPtr Pointer to the font object
+     * @param fontPtr Pointer to the font object (FontInfo::fontPtr)
      * @param sampleText Sample text to display
      */
-    virtual void displayFont(const String &familyName, const String &fontName,
-                             int fontSize, const lgfx::IFont *fontPtr, const char *sampleText) = 0;
-};
+    virtual void displayFont(const char *familyName, const char *fontName,
+                             int fontSize, const void *fontPtr, const char *sampleText) = 0;
 
-// Arduino-compatible font definitions with font pointer
-struct FontInfo
-{
-    const char *family;
-    const char *name;
-    int size;
-    const lgfx::IFont *fontPtr; // Pointer to actual font object
+    /**
+     * @brief Display an overview page with one specimen per font
+     * @param fonts Fonts shown on this page, in catalog order
+     * @param count Number of entries in fonts
+     * @param slots Number of rows a full page is laid out for
+     * @param sampleText Sample text to display in each font
+     * @param pageIndex Zero-based index of this page
+     * @param pageCount Total number of overview pages
+     */
+    virtual void displayFontPage(const FontInfo *fonts, int count, int slots,
+                                 const char *sampleText, int pageIndex, int pageCount) = 0;
+
+    /**
+     * @brief Request an animated transition for the next displayFont() call
+     * @param direction +1 slides the new font in from below, -1 from above
+     * @param velocity Encoder speed in detents per second
+     */
+    virtual void setTransition(int direction, float velocity) = 0;
+
+    /**
+     * @brief Advance a running transition by at most one paced frame
+     * @param hurry true if a newer font is waiting and the transition should finish now
+     * @return true while a transition is still running
+     */
+    virtual bool updateTransition(bool hurry) = 0;
+
+    /**
+     * @brief Show a pre-rendered thumbnail of a font in place of a live render
+     * @param fontId Catalog index of the font
+     * @param sampleText Sample text the thumbnail has to show
+     * @return true if a thumbnail was shown; the default has none
+     *
+     * Honors a pending setTransition() like displayFont() does.
+     */
+    virtual bool displayPreview(int fontId, const char *sampleText)
+    {
+        (void)fontId;
+        (void)sampleText;
+        return false;
+    }
+
+    /**
+     * @brief Read one row of the frame currently on screen, for screenshots
+     * @param y Row to read
+     * @param pixels Output, getDisplayWidth() pixels of RGB565 in byte-swapped
+     *               (most significant byte first) order
+     * @return false if the frame cannot be read back; the default cannot
+     */
+    virtual bool readFrameRow(int y, uint16_t *pixels)
+    {
+        (void)y;
+        (void)pixels;
+        return false;
+    }
+
+    /**
+     * @brief Keep the frame from changing while it is read row by row
+     *
+     * Paired with endFrameRead(). The default has no other task drawing.
+     */
+    virtual void beginFrameRead()
+    {
+    }
+
+    /**
+     * @brief Let the frame change again after beginFrameRead()
+     */
+    virtual void endFrameRead()
+    {
+    }
 };
 
-// Define font families - simplified for Arduino compatibility
-extern const FontInfo fontFamilies[][20];
-extern const int NUM_FONT_FAMILIES;
+// Fonts of the build's FONT_PROFILE in dial order, FONT_CATALOG_FONT_COUNT of them;
+// families are ranges of it, see FONT_CATALOG_FAMILIES. Defined with the font objects, in lgfxfonts.cpp
+extern const FontInfo *const fontCatalog;
+
+/**
+ * @brief Get the advance width of one glyph from the font tables
+ * @param font Pointer to an lgfx::IFont
+ * @param codepoint Unicode codepoint
+ * @return Advance in pixels, 0 if the font has no such glyph
+ *
+ * Matches GlyphWidthTable::MeasureFunc so text layout can run without a draw target.
+ */
+int measureGlyphAdvance(const void *font, uint32_t codepoint);
+
+/**
+ * @brief Get the line height of a font from its tables
+ * @param font Pointer to an lgfx::IFont
+ * @return Height in pixels, 0 if font is nullptr
+ *
+ * What measureFontVertical() reports as the height, without drawing anything.
+ */
+int measureFontHeight(const void *font);
+
+/**
+ * @brief Measure line height, ascent, descent and x-height of an lgfx::IFont
+ * @param font lgfx::IFont pointer
+ * @param metrics Output metrics
+ * @return false if font is nullptr
+ *
+ * The x-height is found by drawing "x" into a small 1-bit sprite, since the
+ * lgfx font interfaces report no per-glyph heights. Matches
+ * FontMetricsIndex::VerticalFunc.
+ */
+bool measureFontVertical(const void *font, FontVerticalMetrics &metrics);
 
 /**
  * @class FontDisplayManager
@@ -78,20 +186,42 @@ extern const int NUM_FONT_FAMILIES;
  */
 class FontDisplayManager
 {
+public:
+    typedef uint32_t (*ClockFunc)(); // Microseconds
+
 private:
-    int currentFamilyIndex;  // Currently selected font family
-    int currentFontIndex;    // Currently selected font within family
-    int lastEncoderPosition; // Last recorded encoder position
-    const char *sampleText;  // Sample text to display
-    bool displayChanged;     // Flag to track if display needs update
-    DeviceInterface *device; // Pointer to device-specific implementation
+    int currentFamilyIndex;           // Currently selected font family
+    int currentFontIndex;             // Currently selected font within family
+    int currentFlatIndex;             // Currently selected font across all families
+    long lastEncoderPosition;         // Last recorded encoder position
+    long basePosition;                // Encoder position at the last mode switch
+    int baseIndex;                    // Font (or page) index at the last mode switch
+    const char *sampleText;           // Sample text to display
+    bool displayChanged;              // Flag to track if display needs update
+    bool overviewMode;                // Show pages of specimens instead of one font
+    int fontsPerPage;                 // Specimens per overview page
+    int currentPage;                  // Currently selected overview page
+    unsigned long lastFrameMicros;    // Duration of the last device render
+    bool transitionsEnabled;          // Slide between fonts instead of hard cuts
+    bool previewsEnabled;             // Show the device's thumbnail before the live render
+    bool livePending;                 // A thumbnail is on screen, the live render is due
+    int pendingDirection;             // Direction of the encoder change awaiting display
+    float encoderVelocity;            // Smoothed encoder speed in detents per second
+    unsigned long lastEncoderMillis;  // Time of the last encoder change
+    DeviceInterface *device;          // Pointer to device-specific implementation
+    ClockFunc clock;                  // Times device renders; nullptr leaves them at 0
+    FontMetricsIndex metricsIndex; // Built on first use
 
     int getFontsInFamily(int familyIndex) const;
-    String getFamilyName(int familyIndex) const;
-    String getFontName(int familyIndex, int fontIndex) const;
+    const char *getFamilyName(int familyIndex) const;
+    const char *getFontName(int familyIndex, int fontIndex) const;
     void mapEncoderToFont(long encoderPosition);
+    void mapEncoderToPage(long encoderPosition);
+    void selectFlatIndex(int flatIndex);
 
 public:
+    static const int MAX_FONTS_PER_PAGE = 12; // Upper bound for setFontsPerPage()
+
     /**
      * @brief Constructor
      * @param deviceInterface Pointer to device-specific implementation
@@ -104,6 +234,12 @@ public:
      */
     void setDevice(DeviceInterface *deviceInterface);
 
+    /**
+     * @brief Set the clock device renders are timed with, see getLastFrameTime()
+     * @param clockFunc Microsecond clock, e.g. micros() on the device or a virtual one on a host
+     */
+    void setClock(ClockFunc clockFunc);
+
     /**
      * @brief Set sample text to display
      * @param text Text to display with fonts
@@ -113,25 +249,57 @@ public:
     /**
      * @brief Update display based on encoder position
      * @param encoderPosition Current encoder position
+     * @param nowMillis Time of the update in milliseconds, used for the encoder speed
+     * @return true while a transition is animating and needs further calls
+     *
+     * Call this on encoder changes and, while it returns true, once per
+     * frame: it also drives running transitions. Fonts selected while a
+     * transition is running are skipped, only the latest one is shown once
+     * the transition completes. Input replay passes a virtual time.
      */
-    void update(long encoderPosition);
+    bool update(long encoderPosition, unsigned long nowMillis);
 
     /**
      * @brief Display current font with sample text
      */
     void displayCurrentFont();
 
+    /**
+     * @brief Finish any running transition and redraw the current view now
+     */
+    void render();
+
+    /**
+     * @brief Select a font by its position in the catalog
+     * @param flatIndex Index across all families (0..getTotalFonts()-1)
+     *
+     * The encoder continues from the selected font. Leaves overview mode.
+     */
+    void selectFont(int flatIndex);
+
+    /**
+     * @brief Get the position of the current font in the catalog
+     * @return Index across all families
+     */
+    int getCurrentCatalogIndex() const;
+
+    /**
+     * @brief Get the sample text being displayed
+     * @return Current sample text
+     */
+    const char *getSampleText() const;
+
     /**
      * @brief Get current font family name
-     * @return Current font family name
+     * @return Current font family name (catalog storage, never nullptr)
      */
-    String getCurrentFamilyName() const;
+    const char *getCurrentFamilyName() const;
 
     /**
      * @brief Get current font name
-     * @return Current font name
+     * @return Current font name (catalog storage, never nullptr)
      */
-    String getCurrentFontName() const;
+    const char *getCurrentFontName() const;
 
     /**
      * @brief Get total number of font families
@@ -150,11 +318,110 @@ public:
      */
     void forceUpdate();
 
+    /**
+     * @brief Make the dial continue from the font (or page) on screen
+     * @param encoderPosition Current encoder position
+     *
+     * For when the dial was used for something else, e.g. the text editor.
+     */
+    void rebaseEncoder(long encoderPosition);
+
     /**
      * @brief Get font pointer for current font
-     * @return Pointer to current font object
+     * @return Pointer to current font object (FontInfo::fontPtr)
+     */
+    const void *getCurrentFontPtr() const;
+
+    /**
+     * @brief Get total number of fonts across all families
+     * @return Number of fonts in the catalog
+     */
+    int getTotalFonts();
+
+    /**
+     * @brief Get a font by its position in the catalog
+     * @param flatIndex Index across all families (0..getTotalFonts()-1)
+     * @return Font entry, or nullptr if out of range
+     */
+    const FontInfo *getFontAt(int flatIndex);
+
+    /**
+     * @brief Get a hash identifying the font catalog
+     * @return FNV-1a hash of every font's family, name and size, and of any
+     *         loaded TrueType face files
+     *
+     * Used to invalidate caches persisted in flash when the catalog changes.
+     */
+    uint32_t getCatalogHash();
+
+    /**
+     * @brief Get the metrics index over the catalog, building it on first use
+     * @return Index keyed by catalog index (getFontAt() order)
+     */
+    FontMetricsIndex &getMetricsIndex();
+
+    /**
+     * @brief Switch between single-font and overview page display
+     * @param enabled true to show pages of specimens
+     *
+     * The encoder keeps its place: entering overview shows the page that
+     * contains the current font, leaving it selects the first font on the page.
+     */
+    void setOverviewMode(bool enabled);
+
+    /**
+     * @brief Check whether overview page display is active
+     * @return true if overview mode is active
+     */
+    bool isOverviewMode() const;
+
+    /**
+     * @brief Set the number of specimens drawn per overview page
+     * @param count Fonts per page (clamped to 1..MAX_FONTS_PER_PAGE)
+     */
+    void setFontsPerPage(int count);
+
+    /**
+     * @brief Get the current overview page
+     * @return Zero-based page index
+     */
+    int getCurrentPage() const;
+
+    /**
+     * @brief Get the number of overview pages
+     * @return Page count for the current fonts-per-page setting
+     */
+    int getPageCount();
+
+    /**
+     * @brief Get the time the device took to render the last frame
+     * @return Render time in microseconds, 0 without a clock
+     */
+    unsigned long getLastFrameTime() const;
+
+    /**
+     * @brief Enable or disable animated transitions between fonts
+     * @param enabled true to slide fonts in, false for hard cuts
+     */
+    void setTransitionsEnabled(bool enabled);
+
+    /**
+     * @brief Check whether animated transitions are enabled
+     * @return true if transitions are enabled
+     */
+    bool areTransitionsEnabled() const;
+
+    /**
+     * @brief Enable or disable thumbnails ahead of live renders
+     * @param enabled true once the device has thumbnails, see DeviceInterface::displayPreview()
+     */
+    void setPreviewsEnabled(bool enabled);
+
+    /**
+     * @brief Check whether thumbnails are shown ahead of live renders
+     * @return true if previews are enabled
      */
-    const lgfx::IFont *getCurrentFontPtr() const;
+    bool arePreviewsEnabled() const;
 };
 
 // Global instance declaration
@@ -0,0 +1,163 @@
+/**
+ * @file fontmetricsindex.cpp
+ * @brief Sorted metrics of every catalog font for "which fonts fit" queries
+ * @date 2026-10-19
+ */
+
+#include "fontmetricsindex.hpp"
+#include <algorithm>
+
+static const uint32_t FIRST_PRINTABLE = 0x20;
+static const uint32_t LAST_PRINTABLE = 0x7E;
+
+FontMetricsIndex::FontMetricsIndex() : measure(nullptr)
+{
+}
+
+void FontMetricsIndex::build(const void *const *fontList, size_t count, VerticalFunc vertical,
+                             GlyphWidthTable::MeasureFunc measureFunc)
+{
+    fonts.assign(fontList, fontList + count);
+    measure = measureFunc;
+    entries.clear();
+    entries.reserve(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        FontMetricsEntry entry = {};
+        entry.fontId = i;
+        if (vertical != nullptr)
+        {
+            vertical(fonts[i], entry.vertical);
+        }
+
+        int minAdvance = 0;
+        int maxAdvance = 0;
+        int total = 0;
+        int glyphs = 0;
+        for (uint32_t codepoint = FIRST_PRINTABLE; codepoint <= LAST_PRINTABLE; codepoint++)
+        {
+            int advance = measure(fonts[i], codepoint);
+            if (advance <= 0)
+            {
+                continue; // Not in this font
+            }
+            minAdvance = (glyphs == 0 || advance < minAdvance) ? advance : minAdvance;
+            maxAdvance = std::max(maxAdvance, advance);
+            total += advance;
+            glyphs++;
+        }
+        entry.minAdvance = minAdvance;
+        entry.maxAdvance = maxAdvance;
+        entry.avgAdvance = (glyphs > 0) ? (total + glyphs / 2) / glyphs : 0;
+        entry.monospace = (glyphs > 1 && minAdvance == maxAdvance);
+        entry.asciiComplete = (glyphs == (int)(LAST_PRINTABLE - FIRST_PRINTABLE + 1));
+        entries.push_back(entry);
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const FontMetricsEntry &a, const FontMetricsEntry &b)
+                     { return a.vertical.height < b.vertical.height; });
+}
+
+bool FontMetricsIndex::isBuilt() const
+{
+    return !entries.empty();
+}
+
+size_t FontMetricsIndex::getCount() const
+{
+    return entries.size();
+}
+
+const FontMetricsEntry *FontMetricsIndex::getEntry(int fontId) const
+{
+    for (const FontMetricsEntry &entry : entries)
+    {
+        if (entry.fontId == fontId)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+int FontMetricsIndex::measureText(const void *font)
+{
+    int width = 0;
+    for (const CodepointSpan &span : querySpans)
+    {
+        int advance = measure(font, span.codepoint);
+        if (advance <= 0)
+        {
+            return -1; // Would be drawn with a gap
+        }
+        width += advance;
+    }
+    return width;
+}
+
+size_t FontMetricsIndex::query(const FontQuery &query, uint16_t *results, size_t maxResults, FontQueryStats *stats)
+{
+    FontQueryStats counts = {0, 0};
+    size_t found = 0;
+
+    decodeUtf8(query.text, querySpans);
+    bool ascii = true;
+    for (const CodepointSpan &span : querySpans)
+    {
+        if (span.codepoint < FIRST_PRINTABLE || span.codepoint > LAST_PRINTABLE)
+        {
+            ascii = false; // Outside the range the advance bounds cover
+            break;
+        }
+    }
+    long glyphCount = querySpans.size();
+
+    // Fonts no taller than the box form a prefix of the height order
+    auto end = std::upper_bound(entries.begin(), entries.end(), query.maxHeight,
+                                [](int height, const FontMetricsEntry &entry)
+                                { return height < entry.vertical.height; });
+    counts.candidates = end - entries.begin();
+
+    for (auto it = end; it != entries.begin();)
+    {
+        const FontMetricsEntry &entry = *--it;
+        if (entry.vertical.xHeight < query.minXHeight ||
+            (query.spacing == FontQuery::SPACING_MONOSPACE && !entry.monospace) ||
+            (query.spacing == FontQuery::SPACING_PROPORTIONAL && entry.monospace))
+        {
+            continue;
+        }
+
+        bool fits;
+        if (ascii && entry.asciiComplete && glyphCount * entry.maxAdvance <= query.maxWidth)
+        {
+            fits = true;
+        }
+        else if (ascii && glyphCount * entry.minAdvance > query.maxWidth)
+        {
+            fits = false;
+        }
+        else
+        {
+            counts.exactChecks++;
+            int width = measureText(fonts[entry.fontId]);
+            fits = width >= 0 && width <= query.maxWidth;
+        }
+
+        if (fits)
+        {
+            if (found < maxResults)
+            {
+                results[found] = entry.fontId;
+            }
+            found++;
+        }
+    }
+
+    if (stats != nullptr)
+    {
+        *stats = counts;
+    }
+    return found;
+}
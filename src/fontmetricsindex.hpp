@@ -0,0 +1,133 @@
+/**
+ * @file fontmetricsindex.hpp
+ * @brief Sorted metrics of every catalog font for "which fonts fit" queries
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. Vertical metrics and glyph advances
+ * come from caller-supplied functions, so the index can be built from
+ * lgfx::IFont on the device or any other font source. An advance of 0 or less
+ * means the font has no such glyph.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "memorytracker.hpp"
+#include "textlayout.hpp"
+
+// Vertical metrics of one font, in pixels
+struct FontVerticalMetrics
+{
+    int16_t height;  // Line height
+    int16_t ascent;  // Baseline to top of the line
+    int16_t descent; // Baseline to bottom of the line
+    int16_t xHeight; // Height of a lower-case x, 0 if the font has none
+};
+
+// Everything the index knows about one font
+struct FontMetricsEntry
+{
+    uint16_t fontId; // Catalog index
+    FontVerticalMetrics vertical;
+    int16_t minAdvance; // Over the printable ASCII glyphs the font has
+    int16_t maxAdvance;
+    int16_t avgAdvance;
+    bool monospace;     // All printable ASCII glyphs share one advance
+    bool asciiComplete; // Has every printable ASCII glyph
+};
+
+// Constraints for FontMetricsIndex::query()
+struct FontQuery
+{
+    enum Spacing
+    {
+        SPACING_ANY,
+        SPACING_MONOSPACE,
+        SPACING_PROPORTIONAL,
+    };
+
+    const char *text; // UTF-8, laid out as a single line
+    int maxWidth;     // Box the text must fit
+    int maxHeight;
+    int minXHeight; // 0 for no minimum
+    Spacing spacing;
+};
+
+// How much work a query did
+struct FontQueryStats
+{
+    size_t candidates;  // Fonts left after the height search
+    size_t exactChecks; // Candidates whose text width had to be measured
+};
+
+/**
+ * @class FontMetricsIndex
+ * @brief Per-font metrics sorted by line height
+ *
+ * A query binary-searches the height order to the fonts no taller than the
+ * box, then filters them by x-height and spacing. Text width is bounded from
+ * the ASCII advance range: a font with every ASCII glyph whose widest one
+ * still fits is accepted and one whose narrowest glyph already overflows is
+ * rejected without measuring; only the rest are measured glyph by glyph. A
+ * font missing any glyph of the text does not fit, however narrow.
+ */
+class FontMetricsIndex
+{
+public:
+    typedef bool (*VerticalFunc)(const void *font, FontVerticalMetrics &metrics);
+
+private:
+    std::vector<FontMetricsEntry, TaggedAllocator<FontMetricsEntry, MEM_FONT_METRICS>> entries; // Sorted by height
+    std::vector<const void *, TaggedAllocator<const void *, MEM_FONT_METRICS>> fonts;         // By catalog index
+    GlyphWidthTable::MeasureFunc measure;
+    SpanList querySpans;
+
+    int measureText(const void *font); // Width of the query text, -1 if a glyph is missing
+
+public:
+    /**
+     * @brief Constructor
+     */
+    FontMetricsIndex();
+
+    /**
+     * @brief Measure every font and sort the index
+     * @param fontList Fonts in catalog order
+     * @param count Number of fonts
+     * @param vertical Function returning a font's vertical metrics
+     * @param measureFunc Function returning the advance of one glyph
+     */
+    void build(const void *const *fontList, size_t count, VerticalFunc vertical,
+               GlyphWidthTable::MeasureFunc measureFunc);
+
+    /**
+     * @brief Check whether build() has run
+     * @return true once the index holds the catalog
+     */
+    bool isBuilt() const;
+
+    /**
+     * @brief Get the number of indexed fonts
+     * @return Font count
+     */
+    size_t getCount() const;
+
+    /**
+     * @brief Get the metrics of a font
+     * @param fontId Catalog index
+     * @return Metrics, or nullptr for an unknown id
+     */
+    const FontMetricsEntry *getEntry(int fontId) const;
+
+    /**
+     * @brief Find the fonts that fit a text in a box
+     * @param query Text and constraints
+     * @param results Output, matching catalog indexes, tallest first
+     * @param maxResults Capacity of results
+     * @param stats Optional, receives candidate and measurement counts
+     * @return Number of matching fonts (may exceed maxResults; only maxResults are stored)
+     */
+    size_t query(const FontQuery &query, uint16_t *results, size_t maxResults, FontQueryStats *stats = nullptr);
+};
@@ -0,0 +1,140 @@
+/**
+ * @file framepacer.cpp
+ * @brief Fixed-rate frame scheduler with frame-time statistics
+ * @date 2026-10-19
+ */
+
+#include "framepacer.hpp"
+
+FramePacer::FramePacer(int targetFps) : frameBudget(0),
+                                        nextFrameDue(0),
+                                        frameStart(0),
+                                        scheduled(false),
+                                        frameCount(0),
+                                        droppedFrames(0),
+                                        maxFrameTime(0),
+                                        histogram()
+{
+    setTargetFps(targetFps);
+}
+
+void FramePacer::setTargetFps(int targetFps)
+{
+    if (targetFps < 1)
+    {
+        targetFps = 1;
+    }
+    if (targetFps > 120)
+    {
+        targetFps = 120;
+    }
+    frameBudget = 1000000UL / targetFps;
+}
+
+uint32_t FramePacer::getFrameBudget() const
+{
+    return frameBudget;
+}
+
+void FramePacer::restart()
+{
+    scheduled = false;
+}
+
+bool FramePacer::isFrameDue(uint32_t nowMicros) const
+{
+    // Signed difference keeps this correct across micros() wrap-around
+    return !scheduled || (int32_t)(nowMicros - nextFrameDue) >= 0;
+}
+
+void FramePacer::beginFrame(uint32_t nowMicros)
+{
+    if (scheduled)
+    {
+        uint32_t late = nowMicros - nextFrameDue;
+        if ((int32_t)late >= (int32_t)frameBudget)
+        {
+            // Whole frame slots were missed: count them and re-anchor the grid
+            droppedFrames += late / frameBudget;
+            nextFrameDue = nowMicros;
+        }
+    }
+    else
+    {
+        nextFrameDue = nowMicros;
+        scheduled = true;
+    }
+
+    frameStart = nowMicros;
+    nextFrameDue += frameBudget;
+}
+
+void FramePacer::endFrame(uint32_t nowMicros)
+{
+    uint32_t frameTime = nowMicros - frameStart;
+
+    int bucket = frameTime / BUCKET_WIDTH_US;
+    if (bucket >= HISTOGRAM_BUCKETS)
+    {
+        bucket = HISTOGRAM_BUCKETS - 1;
+    }
+    histogram[bucket]++;
+
+    if (frameTime > maxFrameTime)
+    {
+        maxFrameTime = frameTime;
+    }
+    frameCount++;
+}
+
+void FramePacer::resetStats()
+{
+    frameCount = 0;
+    droppedFrames = 0;
+    maxFrameTime = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        histogram[i] = 0;
+    }
+}
+
+uint32_t FramePacer::getFrameCount() const
+{
+    return frameCount;
+}
+
+uint32_t FramePacer::getDroppedFrames() const
+{
+    return droppedFrames;
+}
+
+uint32_t FramePacer::getMaxFrameTime() const
+{
+    return maxFrameTime;
+}
+
+uint32_t FramePacer::getPercentile(int percent) const
+{
+    if (frameCount == 0)
+    {
+        return 0;
+    }
+
+    // Smallest bucket whose cumulative count reaches the requested rank
+    uint32_t rank = (frameCount * percent + 99) / 100;
+    if (rank == 0)
+    {
+        rank = 1;
+    }
+
+    uint32_t seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS - 1; i++)
+    {
+        seen += histogram[i];
+        if (seen >= rank)
+        {
+            return (i + 1) * BUCKET_WIDTH_US;
+        }
+    }
+    return maxFrameTime;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file framepacer.hpp
+ * @brief Fixed-rate frame scheduler with frame-time statistics
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies; timestamps are passed in by the
+ * caller so the pacing logic can also be driven by a simulated clock.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @class FramePacer
+ * @brief Schedules frames at a target rate and records how long they take
+ *
+ * Frames are due on a fixed grid of frame budgets. When a frame starts late
+ * the grid is re-anchored and the skipped slots are counted as dropped, so
+ * animations driven by elapsed time simply jump ahead instead of slowing down.
+ */
+class FramePacer
+{
+public:
+    static const int HISTOGRAM_BUCKETS = 16;         // Last bucket collects everything slower
+    static const uint32_t BUCKET_WIDTH_US = 2000;    // 2 ms per histogram bucket
+
+private:
+    uint32_t frameBudget;     // Microseconds per frame at the target rate
+    uint32_t nextFrameDue;    // Timestamp the next frame should start at
+    uint32_t frameStart;      // Timestamp of the frame in progress
+    bool scheduled;           // false until the first frame has started
+    uint32_t frameCount;      // Frames recorded since the last reset
+    uint32_t droppedFrames;   // Frame slots skipped because a frame ran late
+    uint32_t maxFrameTime;    // Slowest recorded frame in microseconds
+    uint32_t histogram[HISTOGRAM_BUCKETS];
+
+public:
+    /**
+     * @brief Constructor
+     * @param targetFps Frames per second to schedule at
+     */
+    FramePacer(int targetFps = 50);
+
+    /**
+     * @brief Change the target frame rate
+     * @param targetFps Frames per second (clamped to 1..120)
+     */
+    void setTargetFps(int targetFps);
+
+    /**
+     * @brief Get the time available for one frame
+     * @return Frame budget in microseconds
+     */
+    uint32_t getFrameBudget() const;
+
+    /**
+     * @brief Restart the frame grid, e.g. at the start of an animation
+     */
+    void restart();
+
+    /**
+     * @brief Check whether the next frame should be drawn
+     * @param nowMicros Current time in microseconds
+     * @return true if the next frame is due
+     */
+    bool isFrameDue(uint32_t nowMicros) const;
+
+    /**
+     * @brief Mark the start of a frame
+     * @param nowMicros Current time in microseconds
+     */
+    void beginFrame(uint32_t nowMicros);
+
+    /**
+     * @brief Mark the end of the frame started by beginFrame()
+     * @param nowMicros Current time in microseconds
+     */
+    void endFrame(uint32_t nowMicros);
+
+    /**
+     * @brief Clear all recorded statistics
+     */
+    void resetStats();
+
+    /**
+     * @brief Get the number of frames recorded
+     * @return Frame count since the last resetStats()
+     */
+    uint32_t getFrameCount() const;
+
+    /**
+     * @brief Get the number of frame slots skipped because frames ran late
+     * @return Dropped frame count since the last resetStats()
+     */
+    uint32_t getDroppedFrames() const;
+
+    /**
+     * @brief Get the slowest recorded frame
+     * @return Frame time in microseconds
+     */
+    uint32_t getMaxFrameTime() const;
+
+    /**
+     * @brief Estimate a frame-time percentile from the histogram
+     * @param percent Percentile to compute (0..100)
+     * @return Upper bound of the histogram bucket holding the percentile, in microseconds
+     */
+    uint32_t getPercentile(int percent) const;
+};
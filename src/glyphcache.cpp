@@ -0,0 +1,226 @@
+/**
+ * @file glyphcache.cpp
+ * @brief Bounded cache of rasterized glyphs keyed by face, size and codepoint
+ * @date 2026-10-19
+ */
+
+#include "glyphcache.hpp"
+
+GlyphCache::GlyphCache(size_t budget, size_t entryLimit) : byteBudget(budget),
+                                                           maxEntries(entryLimit),
+                                                           newest(NONE),
+                                                           oldest(NONE),
+                                                           freeEntries(NONE),
+                                                           bytes(0),
+                                                           count(0),
+                                                           hits(0),
+                                                           misses(0),
+                                                           evictions(0)
+{
+    if (maxEntries < 1)
+    {
+        maxEntries = 1;
+    }
+    else if (maxEntries > 0x7FFF)
+    {
+        maxEntries = 0x7FFF;
+    }
+}
+
+size_t GlyphCache::getBucket(uint8_t face, uint16_t size, uint32_t codepoint) const
+{
+    uint32_t hash = (codepoint * 2654435761u) ^ (size * 40503u) ^ (face * 0x9E3779B9u);
+    return (hash ^ (hash >> 15)) & (buckets.size() - 1);
+}
+
+void GlyphCache::unlinkRecency(int16_t index)
+{
+    Entry &entry = entries[index];
+    if (entry.newer != NONE)
+    {
+        entries[entry.newer].older = entry.older;
+    }
+    else
+    {
+        newest = entry.older;
+    }
+    if (entry.older != NONE)
+    {
+        entries[entry.older].newer = entry.newer;
+    }
+    else
+    {
+        oldest = entry.newer;
+    }
+}
+
+void GlyphCache::linkNewest(int16_t index)
+{
+    Entry &entry = entries[index];
+    entry.newer = NONE;
+    entry.older = newest;
+    if (newest != NONE)
+    {
+        entries[newest].newer = index;
+    }
+    newest = index;
+    if (oldest == NONE)
+    {
+        oldest = index;
+    }
+}
+
+void GlyphCache::evictOldest()
+{
+    int16_t index = oldest;
+    Entry &entry = entries[index];
+
+    // Unchain from its bucket
+    int16_t *link = &buckets[getBucket(entry.face, entry.size, entry.codepoint)];
+    while (*link != index)
+    {
+        link = &entries[*link].nextInBucket;
+    }
+    *link = entry.nextInBucket;
+
+    unlinkRecency(index);
+    bytes -= entry.bitmap.pixels.capacity();
+    entry.bitmap.pixels.clear();
+    entry.bitmap.pixels.shrink_to_fit();
+    entry.nextInBucket = freeEntries;
+    freeEntries = index;
+    count--;
+}
+
+const GlyphBitmap *GlyphCache::find(uint8_t face, uint16_t size, uint32_t codepoint)
+{
+    if (buckets.empty())
+    {
+        misses++;
+        return nullptr;
+    }
+
+    for (int16_t index = buckets[getBucket(face, size, codepoint)]; index != NONE;
+         index = entries[index].nextInBucket)
+    {
+        Entry &entry = entries[index];
+        if (entry.codepoint == codepoint && entry.size == size && entry.face == face)
+        {
+            if (index != newest)
+            {
+                unlinkRecency(index);
+                linkNewest(index);
+            }
+            hits++;
+            return &entry.bitmap;
+        }
+    }
+
+    misses++;
+    return nullptr;
+}
+
+const GlyphBitmap *GlyphCache::insert(uint8_t face, uint16_t size, uint32_t codepoint, GlyphBitmap &bitmap)
+{
+    if (buckets.empty())
+    {
+        // Reserved once so pointers handed out stay put while entries are added
+        entries.reserve(maxEntries);
+        size_t bucketCount = 1;
+        while (bucketCount < maxEntries)
+        {
+            bucketCount <<= 1;
+        }
+        buckets.assign(bucketCount, (int16_t)NONE);
+    }
+
+    // Make room; a glyph larger than the budget ends up alone in the cache
+    size_t needed = bitmap.pixels.capacity();
+    while (count > 0 && (count >= maxEntries || bytes + needed > byteBudget))
+    {
+        evictOldest();
+        evictions++;
+    }
+
+    int16_t index;
+    if (freeEntries != NONE)
+    {
+        index = freeEntries;
+        freeEntries = entries[index].nextInBucket;
+    }
+    else
+    {
+        index = entries.size();
+        entries.emplace_back();
+    }
+
+    Entry &entry = entries[index];
+    entry.codepoint = codepoint;
+    entry.size = size;
+    entry.face = face;
+    entry.bitmap.width = bitmap.width;
+    entry.bitmap.height = bitmap.height;
+    entry.bitmap.left = bitmap.left;
+    entry.bitmap.top = bitmap.top;
+    entry.bitmap.advance = bitmap.advance;
+    entry.bitmap.pixels.swap(bitmap.pixels);
+    bitmap.pixels.clear();
+
+    size_t bucket = getBucket(face, size, codepoint);
+    entry.nextInBucket = buckets[bucket];
+    buckets[bucket] = index;
+    linkNewest(index);
+    bytes += entry.bitmap.pixels.capacity();
+    count++;
+    return &entry.bitmap;
+}
+
+void GlyphCache::clear()
+{
+    entries.clear();
+    entries.shrink_to_fit();
+    buckets.clear();
+    buckets.shrink_to_fit();
+    newest = NONE;
+    oldest = NONE;
+    freeEntries = NONE;
+    bytes = 0;
+    count = 0;
+}
+
+void GlyphCache::clearFace(uint8_t face)
+{
+    // Walk from the oldest end, moving other faces' glyphs up so they survive
+    size_t remaining = count;
+    for (size_t i = 0; i < remaining; i++)
+    {
+        int16_t index = oldest;
+        if (entries[index].face == face)
+        {
+            evictOldest();
+        }
+        else
+        {
+            unlinkRecency(index);
+            linkNewest(index);
+        }
+    }
+}
+
+GlyphCache::Stats GlyphCache::getStats() const
+{
+    Stats stats;
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.evictions = evictions;
+    stats.entries = count;
+    stats.bytes = bytes;
+    return stats;
+}
+
+void GlyphCache::resetStats()
+{
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file glyphcache.hpp
+ * @brief Bounded cache of rasterized glyphs keyed by face, size and codepoint
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "memorytracker.hpp"
+#include "truetype.hpp"
+
+/**
+ * @class GlyphCache
+ * @brief Least-recently-used glyph bitmaps within a byte budget
+ *
+ * Entries live in one array reserved up front, chained into hash buckets and
+ * into a recency list by index. Inserting evicts the least recently used
+ * glyphs until both the byte budget and the entry limit hold; a single glyph
+ * larger than the budget is still kept, alone.
+ */
+class GlyphCache
+{
+public:
+    static const size_t DEFAULT_BYTE_BUDGET = 32 * 1024;
+    static const size_t DEFAULT_MAX_ENTRIES = 512;
+
+    // Counters since construction or the last resetStats()
+    struct Stats
+    {
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t evictions;
+        size_t entries; // Glyphs held now
+        size_t bytes;   // Pixel bytes held now
+    };
+
+private:
+    static const int16_t NONE = -1;
+
+    struct Entry
+    {
+        uint32_t codepoint;
+        uint16_t size;
+        uint8_t face;
+        int16_t newer;        // Recency list, towards newest
+        int16_t older;        // Recency list, towards oldest
+        int16_t nextInBucket; // Hash chain, or the free list for unused entries
+        GlyphBitmap bitmap;
+    };
+
+    size_t byteBudget;
+    size_t maxEntries;
+    std::vector<Entry, TaggedAllocator<Entry, MEM_TRUETYPE>> entries;
+    std::vector<int16_t, TaggedAllocator<int16_t, MEM_TRUETYPE>> buckets;
+    int16_t newest;
+    int16_t oldest;
+    int16_t freeEntries;
+    size_t bytes;
+    size_t count;
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+
+    size_t getBucket(uint8_t face, uint16_t size, uint32_t codepoint) const;
+    void unlinkRecency(int16_t index);
+    void linkNewest(int16_t index);
+    void evictOldest();
+
+public:
+    /**
+     * @brief Constructor
+     * @param budget Pixel bytes to hold at most
+     * @param entryLimit Glyphs to hold at most (up to 32767)
+     *
+     * Nothing is allocated until the first insert().
+     */
+    GlyphCache(size_t budget = DEFAULT_BYTE_BUDGET, size_t entryLimit = DEFAULT_MAX_ENTRIES);
+
+    GlyphCache(const GlyphCache &) = delete;
+    GlyphCache &operator=(const GlyphCache &) = delete;
+
+    /**
+     * @brief Look up a glyph and mark it most recently used
+     * @param face Face identifier
+     * @param size Pixels per em
+     * @param codepoint Unicode codepoint
+     * @return Cached bitmap, valid until the next insert() or clear(); nullptr on a miss
+     */
+    const GlyphBitmap *find(uint8_t face, uint16_t size, uint32_t codepoint);
+
+    /**
+     * @brief Add a glyph, evicting old ones as needed
+     * @param face Face identifier
+     * @param size Pixels per em
+     * @param codepoint Unicode codepoint, not already cached
+     * @param bitmap Rasterized glyph; its pixels are moved into the cache
+     * @return Cached bitmap, valid until the next insert() or clear()
+     */
+    const GlyphBitmap *insert(uint8_t face, uint16_t size, uint32_t codepoint, GlyphBitmap &bitmap);
+
+    /**
+     * @brief Drop every glyph and free the cache's memory
+     */
+    void clear();
+
+    /**
+     * @brief Drop every glyph of one face
+     * @param face Face identifier, e.g. of a face being unloaded
+     */
+    void clearFace(uint8_t face);
+
+    /**
+     * @brief Get hit, miss and eviction counts and the current fill
+     * @return Statistics
+     */
+    Stats getStats() const;
+
+    /**
+     * @brief Reset the hit, miss and eviction counters
+     */
+    void resetStats();
+};
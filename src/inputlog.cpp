@@ -0,0 +1,341 @@
+/**
+ * @file inputlog.cpp
+ * @brief Compact input recording, virtual-clock replay and latency percentiles
+ * @date 2026-10-19
+ */
+
+#include "inputlog.hpp"
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+static const size_t MAX_PENDING = 32; // Inputs awaiting one frame during replay
+
+// Flags in the last header byte
+static const uint8_t START_OVERVIEW = 0x01;
+static const uint8_t START_TRANSITIONS = 0x02;
+
+InputLog::InputLog() : data(),
+                       size(HEADER_SIZE),
+                       count(0),
+                       lastTime(0),
+                       recording(false),
+                       overflowed(false)
+{
+}
+
+void InputLog::start(uint32_t now, const InputLogStart &state)
+{
+    data[0] = state.fontId & 0xFF;
+    data[1] = state.fontId >> 8;
+    data[2] = state.textIndex & 0xFF;
+    data[3] = state.textIndex >> 8;
+    data[4] = (state.overview ? START_OVERVIEW : 0) | (state.transitions ? START_TRANSITIONS : 0);
+    size = HEADER_SIZE;
+    count = 0;
+    lastTime = now;
+    overflowed = false;
+    recording = true;
+}
+
+void InputLog::stop()
+{
+    recording = false;
+}
+
+bool InputLog::isRecording() const
+{
+    return recording;
+}
+
+bool InputLog::putVarint(uint32_t value)
+{
+    do
+    {
+        if (size >= CAPACITY)
+        {
+            return false;
+        }
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        data[size++] = byte | (value != 0 ? 0x80 : 0);
+    } while (value != 0);
+    return true;
+}
+
+bool InputLog::getVarint(const uint8_t *bytes, size_t size, size_t &offset, uint32_t &value)
+{
+    value = 0;
+    for (int shift = 0; shift < 32; shift += 7)
+    {
+        if (offset >= size)
+        {
+            return false;
+        }
+        uint8_t byte = bytes[offset++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool InputLog::record(InputKind kind, int32_t value, uint32_t now)
+{
+    if (!recording || overflowed)
+    {
+        return false;
+    }
+
+    // Roll back a record that does not fit, so the log stays decodable
+    size_t recordStart = size;
+    uint32_t elapsed = now - lastTime;
+    bool fits = elapsed < (1UL << 30) && putVarint(elapsed << 2 | kind);
+    if (fits && kind == INPUT_ENCODER)
+    {
+        fits = putVarint(((uint32_t)value << 1) ^ (uint32_t)(value >> 31)); // Zigzag
+    }
+    if (!fits)
+    {
+        size = recordStart;
+        overflowed = true;
+        return false;
+    }
+
+    lastTime = now;
+    count++;
+    return true;
+}
+
+bool InputLog::load(const uint8_t *bytes, size_t length)
+{
+    if (length < HEADER_SIZE || length > CAPACITY)
+    {
+        return false;
+    }
+
+    // Validate before replacing the current log
+    size_t records = 0;
+    size_t offset = HEADER_SIZE;
+    while (offset < length)
+    {
+        uint32_t header;
+        uint32_t value;
+        if (!getVarint(bytes, length, offset, header) || (header & 3) > INPUT_HOLD ||
+            ((header & 3) == INPUT_ENCODER && !getVarint(bytes, length, offset, value)))
+        {
+            return false;
+        }
+        records++;
+    }
+
+    memcpy(data, bytes, length);
+    size = length;
+    count = records;
+    recording = false;
+    overflowed = false;
+    return true;
+}
+
+const uint8_t *InputLog::getData() const
+{
+    return data;
+}
+
+size_t InputLog::getSize() const
+{
+    return size;
+}
+
+size_t InputLog::getCount() const
+{
+    return count;
+}
+
+bool InputLog::wasOverflowed() const
+{
+    return overflowed;
+}
+
+InputLogStart InputLog::getStart() const
+{
+    InputLogStart state;
+    state.fontId = data[0] | (data[1] << 8);
+    state.textIndex = data[2] | (data[3] << 8);
+    state.overview = (data[4] & START_OVERVIEW) != 0;
+    state.transitions = (data[4] & START_TRANSITIONS) != 0;
+    return state;
+}
+
+InputLog::Cursor InputLog::begin() const
+{
+    return {HEADER_SIZE, 0};
+}
+
+bool InputLog::next(Cursor &cursor, InputRecord &record) const
+{
+    uint32_t header;
+    if (!getVarint(data, size, cursor.offset, header))
+    {
+        return false;
+    }
+
+    cursor.time += header >> 2;
+    record.time = cursor.time;
+    record.kind = (InputKind)(header & 3);
+    record.value = 0;
+    if (record.kind == INPUT_ENCODER)
+    {
+        uint32_t zigzag;
+        if (!getVarint(data, size, cursor.offset, zigzag))
+        {
+            return false;
+        }
+        record.value = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+    }
+    return true;
+}
+
+// LatencyStats
+
+LatencyStats::LatencyStats() : samples(),
+                               count(0),
+                               dropped(0),
+                               sorted(true)
+{
+}
+
+void LatencyStats::clear()
+{
+    count = 0;
+    dropped = 0;
+    sorted = true;
+}
+
+void LatencyStats::add(uint32_t micros)
+{
+    if (count >= MAX_SAMPLES)
+    {
+        dropped++;
+        return;
+    }
+    samples[count++] = micros;
+    sorted = false;
+}
+
+size_t LatencyStats::getCount() const
+{
+    return count;
+}
+
+uint32_t LatencyStats::getDropped() const
+{
+    return dropped;
+}
+
+uint32_t LatencyStats::getPercentile(int percent)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+    if (!sorted)
+    {
+        std::sort(samples, samples + count);
+        sorted = true;
+    }
+
+    // Nearest rank: the smallest sample with at least percent% of samples at or below it
+    size_t rank = (count * (size_t)percent + 99) / 100;
+    return samples[rank > 0 ? rank - 1 : 0];
+}
+
+void LatencyStats::format(char *buffer, size_t size)
+{
+    snprintf(buffer, size, "n=%u p50=%lu p95=%lu p99=%lu max=%lu", (unsigned)count,
+             (unsigned long)getPercentile(50), (unsigned long)getPercentile(95),
+             (unsigned long)getPercentile(99), (unsigned long)getPercentile(100));
+}
+
+// Replay
+
+ReplayResult replayInputLog(const InputLog &log, const ReplayHooks &hooks, LatencyStats &latency)
+{
+    ReplayResult result = {0, 0, 0};
+    uint64_t now = 0; // Virtual clock in microseconds
+    uint64_t pending[MAX_PENDING]; // Arrival times of inputs not yet on screen
+    uint32_t pendingInputs[MAX_PENDING];
+    size_t pendingCount = 0;
+    bool animating = false;
+
+    InputLog::Cursor cursor = log.begin();
+    InputRecord record;
+    bool haveRecord = log.next(cursor, record);
+
+    while (haveRecord || animating)
+    {
+        if (!animating && now < (uint64_t)record.time * 1000)
+        {
+            now = (uint64_t)record.time * 1000; // Idle until the next input
+        }
+
+        uint64_t frameStart = now;
+        uint32_t workStart = hooks.clockMicros();
+
+        // Deliver every input that has arrived by now
+        while (haveRecord && (uint64_t)record.time * 1000 <= now)
+        {
+            hooks.apply(record, hooks.context);
+            if (pendingCount < MAX_PENDING)
+            {
+                pending[pendingCount] = (uint64_t)record.time * 1000;
+                pendingInputs[pendingCount++] = 1;
+            }
+            else
+            {
+                pendingInputs[MAX_PENDING - 1]++; // Charged the latency of the slightly older last slot
+            }
+            result.inputs++;
+            haveRecord = log.next(cursor, record);
+        }
+
+        animating = hooks.step((uint32_t)(now / 1000), hooks.context);
+        result.frames++;
+        now += (uint32_t)(hooks.clockMicros() - workStart);
+
+        if (!animating)
+        {
+            for (size_t i = 0; i < pendingCount; i++)
+            {
+                for (uint32_t n = 0; n < pendingInputs[i]; n++)
+                {
+                    latency.add((uint32_t)(now - pending[i]));
+                }
+            }
+            pendingCount = 0;
+        }
+        else
+        {
+            // The next animation frame starts on the frame grid (at once if this one ran
+            // late), or earlier if an input arrives first
+            uint64_t wake = frameStart + hooks.frameIntervalUs;
+            if (haveRecord && (uint64_t)record.time * 1000 < wake)
+            {
+                wake = (uint64_t)record.time * 1000;
+            }
+            if (wake > now)
+            {
+                if (hooks.wait != nullptr)
+                {
+                    hooks.wait((uint32_t)(wake - now), hooks.context);
+                }
+                now = wake;
+            }
+        }
+    }
+
+    result.virtualTimeMs = (uint32_t)(now / 1000);
+    return result;
+}
@@ -0,0 +1,257 @@
+/**
+ * @file inputlog.hpp
+ * @brief Compact input recording, virtual-clock replay and latency percentiles
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. The replayer drives the display
+ * through caller-supplied functions, so a recorded session can be replayed
+ * on the device or by a headless host program with the same timing rules.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum InputKind : uint8_t
+{
+    INPUT_ENCODER = 0, // value is the change in detents
+    INPUT_CLICK,
+    INPUT_HOLD,
+};
+
+struct InputRecord
+{
+    uint32_t time; // Milliseconds since recording started
+    InputKind kind;
+    int32_t value;
+};
+
+// State the display was in when recording started, restored before a replay
+struct InputLogStart
+{
+    uint16_t fontId;    // Catalog index
+    uint16_t textIndex; // Sample text index
+    bool overview;      // Overview pages instead of a single font
+    bool transitions;   // Font changes slid in with animated transitions
+};
+
+/**
+ * @class InputLog
+ * @brief Timestamped inputs packed into a fixed buffer
+ *
+ * Each record is a varint of (milliseconds since the previous record << 2 |
+ * kind), followed for encoder records by a zigzag varint of the detent
+ * change, so a typical input takes two bytes. The serialized form (see
+ * getData()) starts with a 5-byte header holding the InputLogStart.
+ */
+class InputLog
+{
+public:
+    static const size_t CAPACITY = 4096;  // Bytes, header included
+    static const size_t HEADER_SIZE = 5;
+
+    // Read position for next()
+    struct Cursor
+    {
+        size_t offset;
+        uint32_t time;
+    };
+
+private:
+    uint8_t data[CAPACITY];
+    size_t size;
+    size_t count;
+    uint32_t lastTime;
+    bool recording;
+    bool overflowed;
+
+    bool putVarint(uint32_t value);
+    static bool getVarint(const uint8_t *bytes, size_t size, size_t &offset, uint32_t &value);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    InputLog();
+
+    /**
+     * @brief Discard the log and start recording
+     * @param now Current time in milliseconds
+     * @param state Display state to restore before replaying
+     */
+    void start(uint32_t now, const InputLogStart &state);
+
+    /**
+     * @brief Stop recording; the log is kept for replay
+     */
+    void stop();
+
+    /**
+     * @brief Check whether inputs are being recorded
+     * @return true between start() and stop()
+     */
+    bool isRecording() const;
+
+    /**
+     * @brief Append an input while recording
+     * @param kind Input kind
+     * @param value Detent change for INPUT_ENCODER, ignored otherwise
+     * @param now Current time in milliseconds
+     * @return false if not recording or the log is full
+     */
+    bool record(InputKind kind, int32_t value, uint32_t now);
+
+    /**
+     * @brief Replace the log with a serialized one, e.g. read from a file
+     * @param bytes Serialized log as returned by getData()
+     * @param length Number of bytes
+     * @return false if the data is truncated or malformed
+     */
+    bool load(const uint8_t *bytes, size_t length);
+
+    /**
+     * @brief Get the serialized log
+     * @return Header followed by the records
+     */
+    const uint8_t *getData() const;
+
+    /**
+     * @brief Get the size of the serialized log
+     * @return Bytes
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Get the number of recorded inputs
+     * @return Input count
+     */
+    size_t getCount() const;
+
+    /**
+     * @brief Check whether inputs were dropped because the log was full
+     * @return true if the recording is incomplete
+     */
+    bool wasOverflowed() const;
+
+    /**
+     * @brief Get the display state recorded at start()
+     * @return Start state
+     */
+    InputLogStart getStart() const;
+
+    /**
+     * @brief Get a cursor at the first record
+     * @return Cursor for next()
+     */
+    Cursor begin() const;
+
+    /**
+     * @brief Decode the record at a cursor and advance it
+     * @param cursor Read position
+     * @param record Output, decoded input
+     * @return false at the end of the log
+     */
+    bool next(Cursor &cursor, InputRecord &record) const;
+};
+
+/**
+ * @class LatencyStats
+ * @brief Latency samples with exact nearest-rank percentiles
+ */
+class LatencyStats
+{
+public:
+    static const size_t MAX_SAMPLES = 1024;
+
+private:
+    uint32_t samples[MAX_SAMPLES];
+    size_t count;
+    uint32_t dropped;
+    bool sorted;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    LatencyStats();
+
+    /**
+     * @brief Discard all samples
+     */
+    void clear();
+
+    /**
+     * @brief Add a sample
+     * @param micros Latency in microseconds
+     */
+    void add(uint32_t micros);
+
+    /**
+     * @brief Get the number of samples kept
+     * @return Sample count
+     */
+    size_t getCount() const;
+
+    /**
+     * @brief Get the number of samples dropped once MAX_SAMPLES was reached
+     * @return Dropped sample count
+     */
+    uint32_t getDropped() const;
+
+    /**
+     * @brief Get a percentile
+     * @param percent Percentile to compute (0..100)
+     * @return Latency in microseconds, 0 without samples
+     */
+    uint32_t getPercentile(int percent);
+
+    /**
+     * @brief Write "n=<count> p50=<us> p95=<us> p99=<us> max=<us>"
+     * @param buffer Destination buffer
+     * @param size Size of buffer in bytes
+     */
+    void format(char *buffer, size_t size);
+};
+
+// Functions through which replayInputLog() drives the display
+struct ReplayHooks
+{
+    void (*apply)(const InputRecord &record, void *context); // Deliver one input
+    bool (*step)(uint32_t nowMs, void *context);             // Draw; true while a frame still animates
+    uint32_t (*clockMicros)();                               // Measures the work done by apply and step
+    void (*wait)(uint32_t micros, void *context);            // Idle between animation frames, or nullptr
+    uint32_t frameIntervalUs;                                // Pacing of animation frames
+    void *context;
+};
+
+// Totals of one replay
+struct ReplayResult
+{
+    size_t inputs;
+    size_t frames;          // step() calls
+    uint32_t virtualTimeMs; // Replayed session length, including render time
+};
+
+/**
+ * @brief Replay a log against a virtual clock and measure input-to-frame latency
+ * @param log Recorded inputs
+ * @param hooks Display functions
+ * @param latency Output, one sample per input: microseconds from the input to
+ *                the end of the first step() that finished with no animation left
+ * @return Replay totals
+ *
+ * The clock starts at zero and jumps to each input's recorded time, but
+ * never backwards: work measured with clockMicros is added to it, so inputs
+ * that arrive while a frame is still drawing wait for it, exactly as in the
+ * live loop. Inputs that are due by the time a frame ends are delivered
+ * together before the next step(), like the live event queue coalesces them.
+ * The result depends only on the log and the measured work, not on how long
+ * the replay takes in real time.
+ *
+ * Between the frames of an animation the clock skips ahead to the next frame.
+ * Displays that animate on their own clock get the same gap through wait(),
+ * so an animation takes as many frames as it would live; that time is idle
+ * and not measured.
+ */
+ReplayResult replayInputLog(const InputLog &log, const ReplayHooks &hooks, LatencyStats &latency);
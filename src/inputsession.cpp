@@ -0,0 +1,149 @@
+/**
+ * @file inputsession.cpp
+ * @brief Records dial input and replays it through the font manager
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#include "inputsession.hpp"
+#include "encoder.hpp"
+#include "fontmanager.hpp"
+#include "layoutstore.hpp"
+#include "sampletexts.hpp"
+
+static const uint32_t REPLAY_FRAME_US = 20000; // Matches the 50 fps transition pacing
+
+InputSession::InputSession() : lastPosition(0),
+                               replayPosition(0),
+                               transitionsReplayed(false)
+{
+}
+
+void InputSession::startRecording(uint32_t now)
+{
+    InputLogStart state;
+    state.fontId = fontManager.getCurrentCatalogIndex();
+    state.textIndex = sampleTextStore.getCurrentIndex();
+    state.overview = fontManager.isOverviewMode();
+    state.transitions = fontManager.areTransitionsEnabled();
+    lastPosition = encoder.getPosition();
+    log.start(now, state);
+}
+
+void InputSession::stopRecording()
+{
+    log.stop();
+}
+
+void InputSession::onEncoder(long position, uint32_t now)
+{
+    log.record(INPUT_ENCODER, position - lastPosition, now);
+    lastPosition = position;
+}
+
+void InputSession::onButton(InputKind kind, uint32_t now)
+{
+    log.record(kind, 0, now);
+}
+
+void InputSession::applyReplayInput(const InputRecord &record, void *context)
+{
+    InputSession *session = static_cast<InputSession *>(context);
+    switch (record.kind)
+    {
+    case INPUT_ENCODER:
+        session->replayPosition += record.value;
+        break;
+    case INPUT_CLICK:
+        fontManager.setSampleText(sampleTextStore.selectNext());
+        break;
+    case INPUT_HOLD:
+        fontManager.setOverviewMode(!fontManager.isOverviewMode());
+        break;
+    }
+}
+
+bool InputSession::stepReplay(uint32_t nowMs, void *context)
+{
+    InputSession *session = static_cast<InputSession *>(context);
+    return fontManager.update(session->replayPosition, nowMs);
+}
+
+uint32_t InputSession::replayClock()
+{
+    return micros();
+}
+
+void InputSession::waitReplay(uint32_t intervalUs, void *context)
+{
+    (void)context;
+    delayMicroseconds(intervalUs);
+}
+
+bool InputSession::replay(ReplayResult &result)
+{
+    if (log.isRecording() || log.getCount() == 0 || !layoutStore.isReady())
+    {
+        return false;
+    }
+
+    // Settle on the live position first, so re-basing below starts from it
+    long livePosition = encoder.getPosition();
+    fontManager.update(livePosition, millis());
+    int liveFont = fontManager.getCurrentCatalogIndex();
+    size_t liveText = sampleTextStore.getCurrentIndex();
+    bool liveOverview = fontManager.isOverviewMode();
+    bool transitions = fontManager.areTransitionsEnabled();
+
+    // Start from the recorded state; the starting frame is not measured
+    InputLogStart start = log.getStart();
+    fontManager.setTransitionsEnabled(start.transitions);
+    fontManager.selectFont(start.fontId);
+    fontManager.setOverviewMode(start.overview);
+    fontManager.setSampleText(sampleTextStore.select(start.textIndex));
+    fontManager.render();
+
+    replayPosition = livePosition;
+    ReplayHooks hooks;
+    hooks.apply = applyReplayInput;
+    hooks.step = stepReplay;
+    hooks.clockMicros = replayClock;
+    hooks.wait = start.transitions ? waitReplay : nullptr; // Transitions animate on micros()
+    hooks.frameIntervalUs = REPLAY_FRAME_US;
+    hooks.context = this;
+    latency.clear();
+    result = replayInputLog(log, hooks, latency);
+    transitionsReplayed = start.transitions;
+
+    // Back to the live state, re-based on the real encoder position
+    fontManager.update(livePosition, millis());
+    fontManager.selectFont(liveFont);
+    fontManager.setOverviewMode(liveOverview);
+    fontManager.setSampleText(sampleTextStore.select(liveText));
+    fontManager.setTransitionsEnabled(transitions);
+    fontManager.render();
+    return true;
+}
+
+const InputLog &InputSession::getLog() const
+{
+    return log;
+}
+
+LatencyStats &InputSession::getLatency()
+{
+    return latency;
+}
+
+bool InputSession::wereTransitionsReplayed() const
+{
+    return transitionsReplayed;
+}
+
+// Global instance for easy access
+InputSession inputSession;
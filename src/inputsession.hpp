@@ -0,0 +1,103 @@
+/**
+ * @file inputsession.hpp
+ * @brief Records dial input and replays it through the font manager
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "inputlog.hpp"
+
+/**
+ * @class InputSession
+ * @brief Connects an InputLog to the live inputs and to FontDisplayManager
+ *
+ * The main loop reports every handled encoder change and button press; they
+ * are logged while recording. replay() restores the font, text, mode and
+ * transition setting the recording started from, feeds the log through FontDisplayManager::update()
+ * on a virtual clock, and afterwards returns the display to where it was.
+ */
+class InputSession
+{
+private:
+    InputLog log;
+    LatencyStats latency;
+    long lastPosition; // Encoder position of the last reported change
+    long replayPosition;
+    bool transitionsReplayed;
+
+    static void applyReplayInput(const InputRecord &record, void *context);
+    static bool stepReplay(uint32_t nowMs, void *context);
+    static uint32_t replayClock();
+    static void waitReplay(uint32_t intervalUs, void *context);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    InputSession();
+
+    /**
+     * @brief Discard the log and record from now on
+     * @param now Current time in milliseconds
+     */
+    void startRecording(uint32_t now);
+
+    /**
+     * @brief Stop recording
+     */
+    void stopRecording();
+
+    /**
+     * @brief Report a handled encoder change
+     * @param position New encoder position
+     * @param now Time of the change in milliseconds
+     */
+    void onEncoder(long position, uint32_t now);
+
+    /**
+     * @brief Report a handled button press
+     * @param kind INPUT_CLICK or INPUT_HOLD
+     * @param now Time of the press in milliseconds
+     */
+    void onButton(InputKind kind, uint32_t now);
+
+    /**
+     * @brief Replay the log and measure input-to-frame latency
+     * @param result Output, replay totals
+     * @return false if there is nothing to replay or the sample texts are still loading
+     *
+     * Transitions are on if they were while recording. They animate on wall
+     * time, so the replay then really waits between their frames; the latency
+     * is queueing behind earlier frames plus render and animation time.
+     */
+    bool replay(ReplayResult &result);
+
+    /**
+     * @brief Get the log
+     * @return Recorded (or last replayed) inputs
+     */
+    const InputLog &getLog() const;
+
+    /**
+     * @brief Get the latencies of the last replay
+     * @return Latency samples
+     */
+    LatencyStats &getLatency();
+
+    /**
+     * @brief Check whether the last replay ran with transitions
+     * @return The transition setting of the replayed recording
+     */
+    bool wereTransitionsReplayed() const;
+};
+
+// Global instance declaration
+extern InputSession inputSession;
@@ -0,0 +1,205 @@
+/**
+ * @file layoutstore.cpp
+ * @brief Precomputed sample text layouts for every catalog font, persisted to flash
+ * @date 2026-10-19
+ */
+
+#include "layoutstore.hpp"
+#include <stdio.h>
+#include <string.h>
+
+static const uint32_t LAYOUT_FILE_MAGIC = 0x5459414C; // "LAYT"
+static const uint16_t LAYOUT_FILE_VERSION = 2; // 2: 32-bit line indexes
+
+struct LayoutFileHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t maxWidth;
+    uint32_t catalogHash;
+    uint32_t textsHash;
+    uint16_t fontCount;
+    uint16_t textCount;
+    uint32_t lineCount;
+};
+
+LayoutStore::LayoutStore() : maxWidth(0),
+                             ready(false)
+{
+}
+
+void LayoutStore::bind(const void *const *fontList, size_t fontCount,
+                       const char *const *textList, size_t textCount, int wrapWidth)
+{
+    fonts.assign(fontList, fontList + fontCount);
+    texts.assign(textList, textList + textCount);
+    maxWidth = wrapWidth;
+    firstLine.clear();
+    lines.clear();
+    ready = false;
+}
+
+bool LayoutStore::load(const char *path, uint32_t catalogHash, uint32_t textsHash)
+{
+    ready = false;
+
+    FILE *file = (path != nullptr) ? fopen(path, "rb") : nullptr;
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    LayoutFileHeader header;
+    size_t entries = fonts.size() * texts.size();
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 &&
+                 header.magic == LAYOUT_FILE_MAGIC &&
+                 header.version == LAYOUT_FILE_VERSION &&
+                 header.maxWidth == maxWidth &&
+                 header.catalogHash == catalogHash &&
+                 header.textsHash == textsHash &&
+                 header.fontCount == fonts.size() &&
+                 header.textCount == texts.size();
+
+    if (valid)
+    {
+        firstLine.resize(entries + 1);
+        lines.resize(header.lineCount);
+        valid = fread(firstLine.data(), sizeof(uint32_t), firstLine.size(), file) == firstLine.size() &&
+                fread(lines.data(), sizeof(LayoutLine), lines.size(), file) == lines.size() &&
+                firstLine[entries] == header.lineCount;
+    }
+    fclose(file);
+
+    if (!valid)
+    {
+        firstLine.clear();
+        lines.clear();
+        return false;
+    }
+
+    ready = true;
+    return true;
+}
+
+void LayoutStore::build(GlyphWidthTable::MeasureFunc measure)
+{
+    firstLine.clear();
+    lines.clear();
+
+    GlyphWidthTable widths;
+    TextLayout layout;
+    for (size_t fontIdx = 0; fontIdx < fonts.size(); fontIdx++)
+    {
+        widths.reset(fonts[fontIdx], measure);
+        for (size_t textIdx = 0; textIdx < texts.size(); textIdx++)
+        {
+            layout.setText(texts[textIdx]);
+            layout.layout(widths, maxWidth);
+
+            firstLine.push_back(lines.size());
+            for (size_t i = 0; i < layout.getLineCount(); i++)
+            {
+                lines.push_back(layout.getLine(i));
+            }
+        }
+    }
+    firstLine.push_back(lines.size());
+    ready = true;
+}
+
+bool LayoutStore::save(const char *path, uint32_t catalogHash, uint32_t textsHash) const
+{
+    if (!ready || path == nullptr)
+    {
+        return false;
+    }
+
+    FILE *file = fopen(path, "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    LayoutFileHeader header;
+    header.magic = LAYOUT_FILE_MAGIC;
+    header.version = LAYOUT_FILE_VERSION;
+    header.maxWidth = maxWidth;
+    header.catalogHash = catalogHash;
+    header.textsHash = textsHash;
+    header.fontCount = fonts.size();
+    header.textCount = texts.size();
+    header.lineCount = lines.size();
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(firstLine.data(), sizeof(uint32_t), firstLine.size(), file) == firstLine.size() &&
+              fwrite(lines.data(), sizeof(LayoutLine), lines.size(), file) == lines.size();
+    fclose(file);
+    return ok;
+}
+
+int LayoutStore::findFont(const void *font) const
+{
+    for (size_t i = 0; i < fonts.size(); i++)
+    {
+        if (fonts[i] == font)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int LayoutStore::findText(const char *text) const
+{
+    for (size_t i = 0; i < texts.size(); i++)
+    {
+        if (texts[i] == text)
+        {
+            return i;
+        }
+    }
+
+    // Same content from another buffer
+    for (size_t i = 0; i < texts.size(); i++)
+    {
+        if (strcmp(texts[i], text) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+const LayoutLine *LayoutStore::find(const void *font, const char *text, int wrapWidth, size_t &lineCount) const
+{
+    lineCount = 0;
+    if (!ready || text == nullptr || wrapWidth != maxWidth)
+    {
+        return nullptr;
+    }
+
+    int fontIdx = findFont(font);
+    int textIdx = (fontIdx >= 0) ? findText(text) : -1;
+    if (textIdx < 0)
+    {
+        return nullptr;
+    }
+
+    size_t entry = fontIdx * texts.size() + textIdx;
+    lineCount = firstLine[entry + 1] - firstLine[entry];
+    return lines.data() + firstLine[entry];
+}
+
+bool LayoutStore::isReady() const
+{
+    return ready;
+}
+
+size_t LayoutStore::getMemoryUse() const
+{
+    return firstLine.capacity() * sizeof(uint32_t) + lines.capacity() * sizeof(LayoutLine) +
+           fonts.capacity() * sizeof(const void *) + texts.capacity() * sizeof(const char *);
+}
+
+// Global instance for easy access
+LayoutStore layoutStore;
@@ -0,0 +1,104 @@
+/**
+ * @file layoutstore.hpp
+ * @brief Precomputed sample text layouts for every catalog font, persisted to flash
+ * @date 2026-10-19
+ *
+ * Plain C++ using stdio for persistence, like sampletexts.hpp.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+#include "textlayout.hpp"
+
+/**
+ * @class LayoutStore
+ * @brief Line breaks and widths of every sample text in every font
+ *
+ * The file records the font-catalog hash, the sample-text hash and the wrap
+ * width it was built for; load() rejects it if any of them differ, so a
+ * changed catalog or text file rebuilds the layouts on the next boot.
+ */
+class LayoutStore
+{
+private:
+    std::vector<const void *, TaggedAllocator<const void *, MEM_LAYOUT_STORE>> fonts;
+    std::vector<const char *, TaggedAllocator<const char *, MEM_LAYOUT_STORE>> texts;
+    int maxWidth;
+    // Per (font, text) entry, index into lines
+    std::vector<uint32_t, TaggedAllocator<uint32_t, MEM_LAYOUT_STORE>> firstLine;
+    std::vector<LayoutLine, TaggedAllocator<LayoutLine, MEM_LAYOUT_STORE>> lines;
+    std::atomic<bool> ready; // Set last, so find() may run while another task builds
+
+    int findFont(const void *font) const;
+    int findText(const char *text) const;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    LayoutStore();
+
+    /**
+     * @brief Set the fonts, texts and width that layouts are kept for
+     * @param fontList Font identities in catalog order
+     * @param fontCount Number of fonts
+     * @param textList Sample texts; must stay valid while the store is used
+     * @param textCount Number of texts
+     * @param wrapWidth Maximum line width in pixels
+     */
+    void bind(const void *const *fontList, size_t fontCount,
+              const char *const *textList, size_t textCount, int wrapWidth);
+
+    /**
+     * @brief Load layouts saved by save()
+     * @param path File to read
+     * @param catalogHash Hash of the current font catalog
+     * @param textsHash Hash of the current sample texts
+     * @return true if the file matched the bound fonts, texts and width
+     */
+    bool load(const char *path, uint32_t catalogHash, uint32_t textsHash);
+
+    /**
+     * @brief Lay out every text in every bound font
+     * @param measure Function returning the advance of one glyph
+     */
+    void build(GlyphWidthTable::MeasureFunc measure);
+
+    /**
+     * @brief Save the layouts for the next boot
+     * @param path File to write
+     * @param catalogHash Hash of the current font catalog
+     * @param textsHash Hash of the current sample texts
+     * @return true on success
+     */
+    bool save(const char *path, uint32_t catalogHash, uint32_t textsHash) const;
+
+    /**
+     * @brief Look up the layout of a text in a font
+     * @param font Font identity
+     * @param text Sample text (matched by pointer, then by content)
+     * @param wrapWidth Width the caller wraps to
+     * @param lineCount Output, number of lines
+     * @return Lines of the layout, or nullptr if not stored
+     */
+    const LayoutLine *find(const void *font, const char *text, int wrapWidth, size_t &lineCount) const;
+
+    /**
+     * @brief Check whether layouts are available
+     * @return true after a successful load() or build()
+     */
+    bool isReady() const;
+
+    /**
+     * @brief Get the RAM used by the stored layouts
+     * @return Size in bytes
+     */
+    size_t getMemoryUse() const;
+};
+
+// Global instance declaration
+extern LayoutStore layoutStore;
@@ -0,0 +1,102 @@
+/**
+ * @file lgfxfonts.cpp
+ * @brief The LovyanGFX font objects of the catalog and the specimen labels, and measuring them
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ *
+ * Kept apart from fontmanager.cpp and specimen.cpp, which only pass the
+ * fonts on; the host tests define these for synthetic fonts.
+ */
+
+#include "fontmanager.hpp"
+#include "specimen.hpp"
+#include "scalablefont.hpp"
+#include <M5Unified.h> // For font definitions
+
+// Fonts of the selected FONT_PROFILE, generated from font_manifest.json (see fontcatalog.hpp)
+FONT_CATALOG_OBJECTS
+static const FontInfo catalogFonts[FONT_CATALOG_FONT_COUNT] = {FONT_CATALOG_ENTRIES};
+const FontInfo *const fontCatalog = catalogFonts;
+
+const void *const specimenSmallFont = &fonts::Font0;
+const void *const specimenLabelFont = &fonts::Font2;
+
+int measureGlyphAdvance(const void *font, uint32_t codepoint)
+{
+    const lgfx::IFont *fontPtr = static_cast<const lgfx::IFont *>(font);
+    if (fontPtr == nullptr || codepoint > 0xFFFF)
+    {
+        return 0;
+    }
+
+    lgfx::FontMetrics metrics;
+    fontPtr->getDefaultMetric(&metrics);
+    if (!fontPtr->updateFontMetric(&metrics, codepoint))
+    {
+        return 0; // Glyph not in this font, nothing is drawn for it
+    }
+    return metrics.x_advance;
+}
+
+int measureFontHeight(const void *font)
+{
+    const lgfx::IFont *fontPtr = static_cast<const lgfx::IFont *>(font);
+    if (fontPtr == nullptr)
+    {
+        return 0;
+    }
+
+    lgfx::FontMetrics metrics;
+    fontPtr->getDefaultMetric(&metrics);
+    return metrics.height;
+}
+
+bool measureFontVertical(const void *font, FontVerticalMetrics &metrics)
+{
+    const lgfx::IFont *fontPtr = static_cast<const lgfx::IFont *>(font);
+    if (fontPtr == nullptr)
+    {
+        return false;
+    }
+
+    lgfx::FontMetrics fontMetrics;
+    fontPtr->getDefaultMetric(&fontMetrics);
+    metrics.height = fontMetrics.height;
+    metrics.ascent = fontMetrics.baseline;
+    metrics.descent = fontMetrics.height - fontMetrics.baseline;
+    metrics.xHeight = 0;
+
+    // Draw "x" on its baseline and find the topmost inked row
+    const int margin = 4;
+    LGFX_Sprite probe;
+    probe.setColorDepth(1);
+    if (probe.createSprite(measureGlyphAdvance(font, 'x') + margin * 2, fontMetrics.height + margin * 2) == nullptr)
+    {
+        return true;
+    }
+    probe.fillSprite(BLACK);
+    probe.setFont(fontPtr);
+    probe.setTextColor(WHITE);
+    probe.setTextDatum(baseline_left);
+    const int baselineY = margin + fontMetrics.baseline;
+    probe.drawString("x", margin, baselineY);
+
+    for (int y = 0; y < baselineY && metrics.xHeight == 0; y++)
+    {
+        for (int x = 0; x < probe.width(); x++)
+        {
+            if (probe.readPixel(x, y) != 0)
+            {
+                metrics.xHeight = baselineY - y;
+                break;
+            }
+        }
+    }
+    probe.deleteSprite();
+    return true;
+}
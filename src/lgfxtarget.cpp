@@ -0,0 +1,135 @@
+/**
+ * @file lgfxtarget.cpp
+ * @brief DisplayTarget drawing display lists on a LovyanGFX panel or sprite
+ * @date 2026-10-19
+ *
+ * @Hardwares: Any LovyanGFX panel or sprite
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#include "lgfxtarget.hpp"
+
+// Lists built without LovyanGFX name the datums by value
+static_assert(DATUM_TOP_LEFT == (uint8_t)top_left && DATUM_TOP_CENTER == (uint8_t)top_center &&
+                  DATUM_MIDDLE_LEFT == (uint8_t)middle_left && DATUM_MIDDLE_CENTER == (uint8_t)middle_center &&
+                  DATUM_BOTTOM_CENTER == (uint8_t)bottom_center,
+              "TextDatum must match textdatum_t");
+
+LgfxDisplayTarget::LgfxDisplayTarget(const char *targetName, lgfx::LovyanGFX &display, const uint16_t *spritePalette,
+                                     int spritePaletteSize) : name(targetName),
+                                                              gfx(display),
+                                                              palette(spritePalette),
+                                                              paletteSize(spritePaletteSize),
+                                                              lock(nullptr),
+                                                              unlock(nullptr)
+{
+}
+
+void LgfxDisplayTarget::setLock(LockFunc lockFunc, LockFunc unlockFunc)
+{
+    lock = lockFunc;
+    unlock = unlockFunc;
+}
+
+/**
+ * @brief Translate an RGB565 color for the target
+ * @return The color itself, or its nearest palette index on a palette sprite
+ *
+ * The result is an int because LovyanGFX reads int colors as RGB565 but
+ * uint32_t ones as RGB888.
+ */
+int LgfxDisplayTarget::toColor(uint16_t rgb565) const
+{
+    if (palette == nullptr || !gfx.hasPalette())
+    {
+        return rgb565;
+    }
+
+    int best = 0;
+    int bestDistance = 0x7FFFFFFF;
+    for (int i = 0; i < paletteSize; i++)
+    {
+        int dr = ((rgb565 >> 11) & 0x1F) - ((palette[i] >> 11) & 0x1F);
+        int dg = ((rgb565 >> 5) & 0x3F) - ((palette[i] >> 5) & 0x3F);
+        int db = (rgb565 & 0x1F) - (palette[i] & 0x1F);
+        int distance = 4 * dr * dr + dg * dg + 4 * db * db; // Green has one more bit
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+const char *LgfxDisplayTarget::getName() const
+{
+    return name;
+}
+
+int LgfxDisplayTarget::getWidth() const
+{
+    return gfx.width();
+}
+
+int LgfxDisplayTarget::getHeight() const
+{
+    return gfx.height();
+}
+
+void LgfxDisplayTarget::beginFrame()
+{
+    if (lock != nullptr)
+    {
+        lock();
+    }
+    gfx.startWrite();
+}
+
+void LgfxDisplayTarget::endFrame()
+{
+    gfx.clearClipRect();
+    gfx.endWrite();
+    if (unlock != nullptr)
+    {
+        unlock();
+    }
+}
+
+void LgfxDisplayTarget::fill(uint16_t color)
+{
+    gfx.fillScreen(toColor(color));
+}
+
+void LgfxDisplayTarget::fillRect(int x, int y, int w, int h, uint16_t color)
+{
+    gfx.fillRect(x, y, w, h, toColor(color));
+}
+
+void LgfxDisplayTarget::drawHLine(int x, int y, int w, uint16_t color)
+{
+    gfx.drawFastHLine(x, y, w, toColor(color));
+}
+
+void LgfxDisplayTarget::drawText(const void *font, const char *text, int x, int y, uint8_t datum, uint16_t color,
+                                 float scale)
+{
+    gfx.setFont(static_cast<const lgfx::IFont *>(font));
+    gfx.setTextSize(scale);
+    gfx.setTextDatum((textdatum_t)datum);
+    gfx.setTextColor(toColor(color));
+    gfx.drawString(text, x, y);
+}
+
+void LgfxDisplayTarget::setClip(int x, int y, int w, int h)
+{
+    gfx.setClipRect(x, y, w, h);
+}
+
+void LgfxDisplayTarget::clearClip()
+{
+    gfx.clearClipRect();
+}
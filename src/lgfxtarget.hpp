@@ -0,0 +1,74 @@
+/**
+ * @file lgfxtarget.hpp
+ * @brief DisplayTarget drawing display lists on a LovyanGFX panel or sprite
+ * @date 2026-10-19
+ *
+ * @Hardwares: Any LovyanGFX panel or sprite
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <M5Unified.h>
+#include "displaylist.hpp"
+
+/**
+ * @class LgfxDisplayTarget
+ * @brief DisplayTarget drawing on a LovyanGFX panel or sprite
+ *
+ * Text is enlarged with setTextSize(), so bitmap fonts keep their glyphs and
+ * only grow on panels larger than the frame. On a palette sprite, colors are
+ * drawn as the index of the nearest entry of the palette given. A panel
+ * other tasks use too is drawn holding the lock given to setLock().
+ */
+class LgfxDisplayTarget : public DisplayTarget
+{
+public:
+    typedef void (*LockFunc)();
+
+private:
+    const char *name;
+    lgfx::LovyanGFX &gfx;
+    const uint16_t *palette;
+    int paletteSize;
+    LockFunc lock;
+    LockFunc unlock;
+
+    int toColor(uint16_t rgb565) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @param targetName Name for reports
+     * @param display Panel or sprite to draw on; must outlive the target
+     * @param spritePalette RGB565 palette the sprite was created with, or nullptr
+     * @param spritePaletteSize Entries of spritePalette
+     */
+    LgfxDisplayTarget(const char *targetName, lgfx::LovyanGFX &display, const uint16_t *spritePalette = nullptr,
+                      int spritePaletteSize = 0);
+
+    /**
+     * @brief Draw every frame holding a lock, for a panel other tasks draw on or read
+     * @param lockFunc Called before the first operation of a frame
+     * @param unlockFunc Called after the last
+     */
+    void setLock(LockFunc lockFunc, LockFunc unlockFunc);
+
+    // DisplayTarget implementation
+    const char *getName() const override;
+    int getWidth() const override;
+    int getHeight() const override;
+    void beginFrame() override;
+    void endFrame() override;
+    void fill(uint16_t color) override;
+    void fillRect(int x, int y, int w, int h, uint16_t color) override;
+    void drawHLine(int x, int y, int w, uint16_t color) override;
+    void drawText(const void *font, const char *text, int x, int y, uint8_t datum, uint16_t color,
+                  float scale) override;
+    void setClip(int x, int y, int w, int h) override;
+    void clearClip() override;
+};
@@ -0,0 +1,87 @@
+/**
+ * @file logqueue.cpp
+ * @brief Log lines of background tasks, held until the main loop writes them
+ * @date 2026-10-19
+ */
+
+#include "logqueue.hpp"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+LogQueue::LogQueue() : text(),
+                       length(0),
+                       droppedLines(0)
+{
+}
+
+bool LogQueue::append(const char *line, size_t lineLength)
+{
+    if (length + lineLength > CAPACITY)
+    {
+        return false;
+    }
+    memcpy(text + length, line, lineLength);
+    length += lineLength;
+    return true;
+}
+
+void LogQueue::printf(const char *format, ...)
+{
+    char line[MAX_LINE];
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (written < 0)
+    {
+        return;
+    }
+    size_t lineLength = ((size_t)written < sizeof(line)) ? written : sizeof(line) - 1;
+    if (lineLength == 0 || line[lineLength - 1] != '\n')
+    {
+        if (lineLength == sizeof(line) - 1)
+        {
+            lineLength--; // Cut off: make room for the newline
+        }
+        line[lineLength++] = '\n';
+    }
+
+    std::lock_guard<std::mutex> guard(lock);
+    if (droppedLines > 0)
+    {
+        // The reader has caught up once there is room for the note and the line
+        char note[48];
+        int noteLength = snprintf(note, sizeof(note), "(%lu log lines dropped)\n", (unsigned long)droppedLines);
+        if (length + noteLength + lineLength > CAPACITY)
+        {
+            droppedLines++;
+            return;
+        }
+        append(note, noteLength);
+        droppedLines = 0;
+    }
+    if (!append(line, lineLength))
+    {
+        droppedLines++;
+    }
+}
+
+size_t LogQueue::read(char *buffer, size_t size)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    size_t count = (length < size) ? length : size;
+    memcpy(buffer, text, count);
+    memmove(text, text + count, length - count);
+    length -= count;
+    return count;
+}
+
+uint32_t LogQueue::getDroppedLines()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return droppedLines;
+}
+
+// Global instance for easy access
+LogQueue backgroundLog;
@@ -0,0 +1,67 @@
+/**
+ * @file logqueue.hpp
+ * @brief Log lines of background tasks, held until the main loop writes them
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. The serial port carries command
+ * replies as well as log lines; a task printing while the loop is halfway
+ * through a reply would split it. Tasks queue their lines here instead, and
+ * the loop writes them out between commands.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <mutex>
+
+/**
+ * @class LogQueue
+ * @brief Bounded buffer of whole text lines, written by any task and read by one
+ *
+ * A line that does not fit is dropped whole and counted; the count is
+ * reported, as a line of its own, once there is room again.
+ */
+class LogQueue
+{
+public:
+    static const size_t CAPACITY = 1024;  // Bytes of queued text
+    static const size_t MAX_LINE = 160;   // Longer lines are cut off
+
+private:
+    char text[CAPACITY];
+    size_t length;
+    uint32_t droppedLines;
+    std::mutex lock;
+
+    bool append(const char *line, size_t lineLength);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    LogQueue();
+
+    /**
+     * @brief Queue one formatted line; a missing final newline is added
+     * @param format printf format
+     */
+    void printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+    /**
+     * @brief Take queued text, oldest first
+     * @param buffer Output, not terminated
+     * @param size Size of buffer in bytes
+     * @return Bytes copied; 0 once the queue is empty
+     */
+    size_t read(char *buffer, size_t size);
+
+    /**
+     * @brief Get the number of lines dropped because the queue was full
+     * @return Lines dropped that no note in the queue reports yet
+     */
+    uint32_t getDroppedLines();
+};
+
+// Global instance declaration
+extern LogQueue backgroundLog;
@@ -11,10 +11,90 @@
  */
 
 #include "m5dial.hpp"
+#include "fnv1a.hpp"
+#include "layoutstore.hpp"
+#include "lgfxtarget.hpp"
+#include "logqueue.hpp"
+#include "thumbnailstore.hpp"
 #include "version.h"
-#include <vector>
+#include "encoder.hpp"
+#include "memorytracker.hpp"
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <stdio.h>
+#include <string.h>
+
+// Slide transitions use the GC9A01 vertical scroll commands so only newly
+// revealed rows are sent; set to 0 to always use the sprite pair instead
+#ifndef TRANSITION_HW_SCROLL
+#define TRANSITION_HW_SCROLL 1
+#endif
+
+// Frames per second slide transitions are paced at
+#ifndef TRANSITION_FPS
+#define TRANSITION_FPS 50
+#endif
+
+// Frame sprite color depth: 16 for RGB565, or 4 for a 16-color palette that
+// needs a quarter of the memory and is expanded to RGB565 line by line as
+// pushSprite() streams it to the panel
+#ifndef FRAME_COLOR_DEPTH
+#define FRAME_COLOR_DEPTH 16
+#endif
+
+static const uint8_t CMD_VSCRDEF = 0x33;   // Vertical scrolling definition
+static const uint8_t CMD_VSCRSADD = 0x37;  // Vertical scroll start address
+
+static const uint8_t DIMMED_BRIGHTNESS = 16;
+
+// Task blocked in waitForEvent(), woken by input interrupts
+static volatile TaskHandle_t waitingTask = nullptr;
+static unsigned long wakeMicros = 0; // When light sleep last ended, 0 once reported
+
+// Held while one task uses M5.Display, see lockDisplay(); created in begin()
+static SemaphoreHandle_t displayLock = nullptr;
+
+#if FRAME_COLOR_DEPTH == 4
+static constexpr uint16_t gray565(uint8_t level)
+{
+    return ((level >> 3) << 11) | ((level >> 2) << 5) | (level >> 3);
+}
 
-M5DialDevice::M5DialDevice()
+// Every color the frame renderers use, then a gray ramp for shaded pixels
+static const uint16_t FRAME_PALETTE[16] = {
+    BLACK, WHITE, GREEN, CYAN, YELLOW, VIOLET, DARKGREY,
+    gray565(28), gray565(56), gray565(84), gray565(112), gray565(140),
+    gray565(168), gray565(196), gray565(216), gray565(236)};
+#else
+// RGB565 frames have no palette; only thumbnail sprites use these
+static const uint16_t FRAME_PALETTE[3] = {BLACK, WHITE, GREEN};
+#endif
+static const int FRAME_PALETTE_SIZE = sizeof(FRAME_PALETTE) / sizeof(FRAME_PALETTE[0]);
+
+// Thumbnails are drawn with the first palette entries only, so a 4-bit frame
+// sprite takes their rows as they are
+static const int THUMBNAIL_COLORS = 3;
+
+static const uint32_t TRANSITION_MAX_US = 300000; // Slow turns take 300 ms
+static const uint32_t TRANSITION_MIN_US = 80000;  // Fast spins still show motion
+
+M5DialDevice::M5DialDevice() : frameCanvas{M5Canvas(&M5.Display), M5Canvas(&M5.Display)},
+                               frameCanvasReady{false, false},
+                               frontCanvas(0),
+                               frontCanvasValid(false),
+                               thumbnailCanvas(&M5.Display),
+                               thumbnailCanvasReady(false),
+                               powerState(EventScheduler::POWER_ACTIVE),
+                               activeBrightness(0),
+                               framePacer(TRANSITION_FPS),
+                               transitionPending(false),
+                               transitionActive(false),
+                               transitionHardwareScroll(false),
+                               transitionDirection(0),
+                               transitionVelocity(0),
+                               transitionStart(0),
+                               transitionDuration(0),
+                               transitionRows(0)
 {
 }
 
@@ -22,11 +102,13 @@ void M5DialDevice::begin()
 {
     auto cfg = M5.config();
     M5.begin(cfg);
+    displayLock = xSemaphoreCreateRecursiveMutex();
 }
 
 void M5DialDevice::clearDisplay()
 {
     M5.Display.fillScreen(BLACK);
+    frontCanvasValid = false;
 }
 
 int M5DialDevice::getDisplayWidth() const
@@ -39,127 +121,259 @@ int M5DialDevice::getDisplayHeight() const
     return M5.Display.height();
 }
 
-void M5DialDevice::drawWrappedText(const char *text, int centerX, int centerY)
+int M5DialDevice::getWrapWidth() const
 {
-    String sampleText = String(text);
-
-    int textWidth = M5.Display.textWidth(sampleText);
-    int maxWidth = getDisplayWidth() - 20;
+    return getDisplayWidth() - 20;
+}
 
-    if (textWidth <= maxWidth)
+void M5DialDevice::warmFontCache(const void *fontPtr, const char *text)
+{
+    if (fontPtr == nullptr || text == nullptr)
     {
-        // Fits on one line
-        M5.Display.drawString(sampleText, centerX, centerY);
         return;
     }
 
-    // Need to wrap - build lines that fit
-    std::vector<String> lines;
-    String currentLine = "";
-    int currentWidth = 0;
+    renderer.warm(fontPtr, text, getDisplayWidth());
+}
 
-    for (unsigned int i = 0; i < sampleText.length(); i++)
-    {
-        char c = sampleText.charAt(i);
-        int charWidth = M5.Display.textWidth(String(c));
+void M5DialDevice::drawList(lgfx::LovyanGFX &gfx, const DisplayList &list)
+{
+    // Palette sprites get the nearest palette index of each color
+    LgfxDisplayTarget target("dial", gfx, FRAME_PALETTE, FRAME_PALETTE_SIZE);
+    replayDisplayList(list, target);
+}
 
-        // Check if adding this character would exceed width
-        if (currentWidth + charWidth > maxWidth && currentLine.length() > 0)
-        {
-            // Try to break at last space
-            int lastSpace = currentLine.lastIndexOf(' ');
-            if (lastSpace > 0 && lastSpace < currentLine.length() - 1)
-            {
-                // Break at space
-                lines.push_back(currentLine.substring(0, lastSpace));
-                currentLine = currentLine.substring(lastSpace + 1) + c;
-                currentWidth = M5.Display.textWidth(currentLine);
-            }
-            else
-            {
-                // No space found, force break
-                lines.push_back(currentLine);
-                currentLine = String(c);
-                currentWidth = charWidth;
-            }
-        }
-        else
+void M5DialDevice::displayFont(const char *familyName, const char *fontName,
+                               int fontSize, const void *fontPtr, const char *sampleText)
+{
+    frameList.reset(getDisplayWidth(), getDisplayHeight());
+    renderer.renderFont(frameList, DIAL_STYLE, familyName, fontName, fontSize, fontPtr, sampleText);
+
+    int back = 1 - frontCanvas;
+    bool animate = transitionPending;
+    transitionPending = false;
+
+    if (ensureFrameCanvas(back))
+    {
+        // Compose off-screen, then either slide it in or push it in one transfer
+        drawList(frameCanvas[back], frameList);
+        if (animate && startTransition())
         {
-            currentLine += c;
-            currentWidth += charWidth;
+            return;
         }
+
+        frameCanvas[back].pushSprite(0, 0);
+        frontCanvas = back;
+        frontCanvasValid = true;
+    }
+    else
+    {
+        drawList(M5.Display, frameList);
+        frontCanvasValid = false;
     }
+}
 
-    // Add last line
-    if (currentLine.length() > 0)
+bool M5DialDevice::displayPreview(int fontId, const char *sampleText)
+{
+    // Thumbnails only stand in for frames composed in a sprite
+    int back = 1 - frontCanvas;
+    if (!thumbnailStore.isReady() || sampleText == nullptr ||
+        fnv1aString(sampleText) != thumbnailStore.getTextHash() || !ensureFrameCanvas(back))
     {
-        lines.push_back(currentLine);
+        return false;
     }
 
-    // Calculate line height and draw centered
-    int lineHeight = M5.Display.fontHeight();
-    int totalHeight = lineHeight * lines.size();
-    int startY = centerY - (totalHeight / 2);
+    const int width = getDisplayWidth();
+    int height = 0;
+#if FRAME_COLOR_DEPTH == 4
+    // Same palette indexes, so rows decode straight into the frame sprite
+    frameCanvas[back].fillSprite(0);
+    if (!thumbnailStore.read(fontId, static_cast<uint8_t *>(frameCanvas[back].getBuffer()), (width + 1) / 2,
+                             getDisplayHeight(), height))
+    {
+        return false;
+    }
+#else
+    if (!ensureThumbnailCanvas())
+    {
+        return false;
+    }
+    thumbnailCanvas.fillSprite(0);
+    if (!thumbnailStore.read(fontId, static_cast<uint8_t *>(thumbnailCanvas.getBuffer()), (width + 1) / 2,
+                             getDisplayHeight(), height))
+    {
+        return false;
+    }
+    thumbnailCanvas.pushSprite(&frameCanvas[back], 0, 0); // Expanded through the palette
+#endif
 
-    for (size_t i = 0; i < lines.size(); i++)
+    bool animate = transitionPending;
+    transitionPending = false;
+    if (animate && startTransition())
     {
-        M5.Display.drawString(lines[i], centerX, startY + (i * lineHeight));
+        return true;
     }
+
+    frameCanvas[back].pushSprite(0, 0);
+    frontCanvas = back;
+    frontCanvasValid = true;
+    return true;
 }
 
-void M5DialDevice::displayFont(const String &familyName, const String &fontName,
-                               int fontSize, const lgfx::IFont *fontPtr, const char *sampleText)
+bool M5DialDevice::buildThumbnails(const char *path, const FontInfo *fonts, size_t fontCount,
+                                   uint32_t catalogHash, const char *sampleText, const std::atomic<bool> &cancel)
 {
-    clearDisplay();
+    const int width = getDisplayWidth();
+    const int height = getDisplayHeight();
 
-    const int center_x = getDisplayWidth() / 2;
+    M5Canvas canvas(&M5.Display);
+    canvas.setColorDepth(4);
+    canvas.setPsram(true);
+    if (canvas.createSprite(width, height) == nullptr)
+    {
+        return false;
+    }
+    canvas.createPalette(FRAME_PALETTE, THUMBNAIL_COLORS);
+    memoryTracker.recordAlloc(MEM_THUMBNAILS, canvas.getBuffer(), canvas.bufferLength());
+
+    ThumbnailWriter writer;
+    bool ok = writer.begin(path, catalogHash, fnv1aString(sampleText), width, fontCount);
+    const uint8_t *pixels = static_cast<const uint8_t *>(canvas.getBuffer());
+    const size_t stride = (width + 1) / 2;
+    for (size_t i = 0; ok && i < fontCount; i++)
+    {
+        if (cancel.load())
+        {
+            ok = false;
+            break;
+        }
 
-    // Display family name at top - use built-in font for info display
-    M5.Display.setFont(&fonts::Font2);
-    M5.Display.setTextColor(GREEN);
-    M5.Display.setTextDatum(top_left);
-    M5.Display.setTextSize(1);
+        const FontInfo *font = &fonts[i];
+        thumbnailList.reset(width, height);
+        thumbnailRenderer.renderSpecimen(thumbnailList, DIAL_STYLE, font->family, font->name, font->size,
+                                         font->fontPtr, sampleText);
+        drawList(canvas, thumbnailList);
 
-    String sizeStr = "Size: " + String(fontSize);
-    M5.Display.drawString(sizeStr, center_x - (M5.Display.textWidth(sizeStr) / 2), 12);
+        // Blank rows below the text are left out; displayPreview() clears them
+        int rows = height;
+        while (rows > 0)
+        {
+            const uint8_t *row = pixels + (rows - 1) * stride;
+            size_t x = 0;
+            while (x < stride && row[x] == 0)
+            {
+                x++;
+            }
+            if (x < stride)
+            {
+                break;
+            }
+            rows--;
+        }
+        ok = writer.add(pixels, stride, rows);
+    }
 
-    String familyStr = "Family: " + familyName;
-    M5.Display.drawString(familyStr, center_x - (M5.Display.textWidth(familyStr) / 2), 28);
+    size_t bytes = writer.getSize();
+    if (ok)
+    {
+        ok = writer.finish();
+    }
+    else
+    {
+        writer.abort();
+    }
+    memoryTracker.recordFree(MEM_THUMBNAILS, canvas.getBuffer(), canvas.bufferLength());
+    canvas.deleteSprite();
 
-    String fontStr = "Font: " + fontName;
-    M5.Display.drawString(fontStr, center_x - (M5.Display.textWidth(fontStr) / 2), 44);
+    if (ok)
+    {
+        // Runs on the thumbnail task, which must not write to Serial mid-reply
+        backgroundLog.printf("Thumbnails: %u fonts, %u bytes (%u raw)\n", (unsigned)fontCount, (unsigned)bytes,
+                             (unsigned)(fontCount * stride * height));
+    }
+    return ok;
+}
 
-    // Set the actual font for sample text display using font pointer
-    if (fontPtr != nullptr)
+bool M5DialDevice::readFrameRow(int y, uint16_t *pixels)
+{
+    const int width = getDisplayWidth();
+    if (frontCanvasValid && !transitionActive)
     {
-        M5.Display.setFont(fontPtr);
+#if FRAME_COLOR_DEPTH == 4
+        // Expanded through the palette, as pushSprite() does
+        frameCanvas[frontCanvas].readRect(0, y, width, 1, pixels);
+#else
+        // The sprite holds exactly what was pushed, already byte-swapped
+        const uint16_t *buffer = static_cast<const uint16_t *>(frameCanvas[frontCanvas].getBuffer());
+        memcpy(pixels, buffer + y * width, width * sizeof(uint16_t));
+#endif
     }
     else
     {
-        M5.Display.setFont(&fonts::Font2); // Fallback font
+        lockDisplay();
+        M5.Display.readRect(0, y, width, 1, pixels);
+        unlockDisplay();
     }
-    M5.Display.setTextColor(WHITE);
-    M5.Display.setTextDatum(middle_center);
+    return true;
+}
 
-    int centerY = getDisplayHeight() / 2;
-    drawWrappedText(sampleText, center_x, centerY);
+void M5DialDevice::beginFrameRead()
+{
+    lockDisplay();
+}
 
-    displayFontMetrics(fontPtr, sampleText, getDisplayHeight() - 70);
+void M5DialDevice::endFrameRead()
+{
+    unlockDisplay();
+}
 
-    M5.Display.setFont(&fonts::Font0);
-    M5.Display.setTextColor(YELLOW);
-    M5.Display.setTextDatum(middle_center);
-    M5.Display.drawString("H=height B=baseline C=char", getDisplayWidth() / 2, getDisplayHeight() - 58);
-    M5.Display.drawString("A=asc D=desc TW=width", getDisplayWidth() / 2, getDisplayHeight() - 48);
+bool M5DialDevice::measurePush(int repeats, PushTiming &frame, PushTiming &rgb565)
+{
+    if (!frontCanvasValid || transitionActive || repeats <= 0)
+    {
+        return false;
+    }
 
-    // Display navigation info at bottom with wrapping
-    M5.Display.setFont(&fonts::Font0);
-    M5.Display.setTextColor(YELLOW);
-    M5.Display.setTextDatum(bottom_center);
+    M5Canvas &front = frameCanvas[frontCanvas];
+    const int width = getDisplayWidth();
+    const int height = getDisplayHeight();
 
-    // User instructions moved up 5 pixels
-    M5.Display.drawString("Rotate dial: change font", getDisplayWidth() / 2, getDisplayHeight() - 35);
-    M5.Display.drawString("Press button: change text", getDisplayWidth() / 2, getDisplayHeight() - 25);
+    uint32_t start = micros();
+    for (int i = 0; i < repeats; i++)
+    {
+        front.pushSprite(0, 0);
+    }
+    frame.colorDepth = FRAME_COLOR_DEPTH;
+    frame.bufferBytes = front.bufferLength();
+    frame.frameMicros = (micros() - start) / repeats;
+
+    if (FRAME_COLOR_DEPTH == 16)
+    {
+        rgb565 = frame;
+        return true;
+    }
+
+    // The same frame as a plain RGB565 sprite, for comparison
+    M5Canvas reference(&M5.Display);
+    reference.setColorDepth(16);
+    reference.setPsram(true);
+    if (reference.createSprite(width, height) == nullptr)
+    {
+        rgb565 = {16, (uint32_t)(width * height * 2), 0};
+        return true;
+    }
+    front.pushSprite(&reference, 0, 0);
+
+    start = micros();
+    for (int i = 0; i < repeats; i++)
+    {
+        reference.pushSprite(0, 0);
+    }
+    rgb565.colorDepth = 16;
+    rgb565.bufferBytes = reference.bufferLength();
+    rgb565.frameMicros = (micros() - start) / repeats;
+    reference.deleteSprite();
+    return true;
 }
 
 bool M5DialDevice::wasButtonPressed()
@@ -178,56 +392,364 @@ void M5DialDevice::showStartupMessage(const char *message)
     const int offsetY = getDisplayHeight() / 2;
 
     clearDisplay();
+    frameList.reset(getDisplayWidth(), getDisplayHeight());
 
-    M5.Display.setTextColor(GREEN);
-    M5.Display.setTextDatum(middle_center);
-    M5.Display.setTextSize(1);
-    M5.Display.setFont(&fonts::Satisfy_24);
+    char titleWithVersion[TextLayout::MAX_LINE_BYTES];
+    snprintf(titleWithVersion, sizeof(titleWithVersion), "%s %s", message, PROJECT_VERSION);
+    renderer.addWrappedText(frameList, &fonts::Satisfy_24, titleWithVersion, centerX, offsetY - 40, GREEN);
 
-    String titleWithVersion = String(message) + " " + PROJECT_VERSION;
-    drawWrappedText(titleWithVersion.c_str(), centerX, offsetY - 40);
+    frameList.hline(0, offsetY - 20, getDisplayWidth(), WHITE);
 
-    M5.Display.drawLine(0, offsetY - 20, getDisplayWidth(), offsetY - 20, WHITE);
+    renderer.addWrappedText(frameList, &fonts::DejaVu12, "https://github.com/VashJuan/ LovyanGFX_font_display",
+                            centerX, offsetY + 15, CYAN);
+    renderer.addWrappedText(frameList, &fonts::FreeMono12pt7b, "Rotate dial to scroll thru fonts", centerX,
+                            offsetY + 75, VIOLET);
+    drawList(M5.Display, frameList);
+}
 
-    M5.Display.setTextColor(CYAN);
-    M5.Display.setTextDatum(middle_center);
-    M5.Display.setTextSize(1);
+bool M5DialDevice::ensureFrameCanvas(int index)
+{
+    if (frameCanvasReady[index])
+    {
+        return true;
+    }
+
+    // A full RGB565 frame is 115KB (a 4-bit one 29KB); prefer PSRAM and fall back to direct drawing
+    frameCanvas[index].setColorDepth(FRAME_COLOR_DEPTH);
+    frameCanvas[index].setPsram(true);
+    frameCanvasReady[index] = frameCanvas[index].createSprite(getDisplayWidth(), getDisplayHeight()) != nullptr;
+    if (!frameCanvasReady[index])
+    {
+        Serial.printf("No memory for frame sprite %d, drawing directly\n", index);
+        return false;
+    }
+
+#if FRAME_COLOR_DEPTH == 4
+    frameCanvas[index].createPalette(FRAME_PALETTE, 16);
+#endif
+    uint32_t bytes = frameCanvas[index].bufferLength();
+    memoryTracker.recordAlloc(MEM_SPRITES, frameCanvas[index].getBuffer(), bytes);
+    Serial.printf("Frame sprite %d: %lu bytes at %d bpp, %lu saved against RGB565\n", index, (unsigned long)bytes,
+                  FRAME_COLOR_DEPTH, (unsigned long)(getDisplayWidth() * getDisplayHeight() * 2 - bytes));
+    return true;
+}
+
+bool M5DialDevice::ensureThumbnailCanvas()
+{
+    if (thumbnailCanvasReady)
+    {
+        return true;
+    }
+
+    // A full 4-bit frame is 29KB; thumbnails are skipped if it cannot be had
+    thumbnailCanvas.setColorDepth(4);
+    thumbnailCanvas.setPsram(true);
+    thumbnailCanvasReady = thumbnailCanvas.createSprite(getDisplayWidth(), getDisplayHeight()) != nullptr;
+    if (thumbnailCanvasReady)
+    {
+        thumbnailCanvas.createPalette(FRAME_PALETTE, THUMBNAIL_COLORS);
+        memoryTracker.recordAlloc(MEM_SPRITES, thumbnailCanvas.getBuffer(), thumbnailCanvas.bufferLength());
+    }
+    return thumbnailCanvasReady;
+}
+
+void M5DialDevice::displayFontPage(const FontInfo *pageFonts, int count, int slots,
+                                   const char *sampleText, int pageIndex, int pageCount)
+{
+    frameList.reset(getDisplayWidth(), getDisplayHeight());
+    renderer.renderFontPage(frameList, DIAL_STYLE, pageFonts, count, slots, sampleText, pageIndex, pageCount);
+
+    int back = 1 - frontCanvas;
+    transitionPending = false;
 
-    M5.Display.setFont(&fonts::DejaVu12);
-    drawWrappedText("https://github.com/VashJuan/ LovyanGFX_font_display", centerX, offsetY + 15);
-    M5.Display.setFont(&fonts::FreeMono12pt7b);
-    M5.Display.setTextColor(VIOLET);
-    drawWrappedText("Rotate dial to scroll thru fonts", centerX, offsetY + 75);
+    if (ensureFrameCanvas(back))
+    {
+        // Compose off-screen, then push the finished page in one transfer
+        drawList(frameCanvas[back], frameList);
+        frameCanvas[back].pushSprite(0, 0);
+        frontCanvas = back;
+        frontCanvasValid = true;
+    }
+    else
+    {
+        drawList(M5.Display, frameList);
+        frontCanvasValid = false;
+    }
 }
 
-void M5DialDevice::displayFontMetrics(const lgfx::IFont *fontPtr, const char *sampleText, int yPosition)
+void M5DialDevice::setTransition(int direction, float velocity)
 {
-    if (fontPtr == nullptr)
+    transitionPending = (direction != 0);
+    transitionDirection = (direction < 0) ? -1 : 1;
+    transitionVelocity = velocity;
+}
+
+bool M5DialDevice::startTransition()
+{
+#if TRANSITION_HW_SCROLL
+    // Scroll addresses are panel memory rows, which only match screen rows unrotated
+    transitionHardwareScroll = (M5.Display.getRotation() == 0);
+#else
+    transitionHardwareScroll = false;
+#endif
+
+    // Without panel scrolling both frames must be in sprites
+    if (!transitionHardwareScroll && !frontCanvasValid)
+    {
+        return false;
+    }
+
+    // Faster turns give shorter slides so the dial never feels sluggish
+    float duration = TRANSITION_MAX_US / (1.0f + transitionVelocity / 3.0f);
+    transitionDuration = (duration < TRANSITION_MIN_US) ? TRANSITION_MIN_US : (uint32_t)duration;
+    transitionRows = 0;
+    transitionActive = true;
+    transitionStart = micros();
+    framePacer.restart();
+    framePacer.resetStats(); // finishTransition() reports this transition alone
+
+    if (transitionHardwareScroll)
+    {
+        const int height = getDisplayHeight();
+        M5.Display.startWrite();
+        M5.Display.writeCommand(CMD_VSCRDEF);
+        M5.Display.writeData(0); // No fixed top area
+        M5.Display.writeData(0);
+        M5.Display.writeData(height >> 8);
+        M5.Display.writeData(height & 0xFF);
+        M5.Display.writeData(0); // No fixed bottom area
+        M5.Display.writeData(0);
+        M5.Display.endWrite();
+    }
+
+    updateTransition(false);
+    return true;
+}
+
+bool M5DialDevice::updateTransition(bool hurry)
+{
+    if (!transitionActive)
+    {
+        return false;
+    }
+
+    uint32_t now = micros();
+    if (!hurry && !framePacer.isFrameDue(now))
+    {
+        return true;
+    }
+
+    framePacer.beginFrame(now);
+
+    // Progress follows wall time, so late frames jump ahead instead of slowing down
+    float t = hurry ? 1.0f : (float)(now - transitionStart) / transitionDuration;
+    if (t > 1.0f)
+    {
+        t = 1.0f;
+    }
+    float eased = 1.0f - (1.0f - t) * (1.0f - t) * (1.0f - t); // Ease-out cubic
+    int rows = (int)(eased * getDisplayHeight() + 0.5f);
+
+    drawTransitionFrame(rows);
+    framePacer.endFrame(micros());
+
+    if (t >= 1.0f)
+    {
+        finishTransition();
+    }
+    return transitionActive;
+}
+
+void M5DialDevice::drawTransitionFrame(int rows)
+{
+    const int height = getDisplayHeight();
+    M5Canvas &incoming = frameCanvas[1 - frontCanvas];
+
+    M5.Display.startWrite();
+    if (transitionHardwareScroll)
+    {
+        // Panel memory row r shows at screen row (r - scroll) mod height, so the
+        // incoming frame's row r always belongs in memory row r: only the rows
+        // revealed since the last frame are sent, the outgoing ones stay put
+        int firstRow = (transitionDirection > 0) ? transitionRows : height - rows;
+        int rowCount = rows - transitionRows;
+        if (rowCount > 0)
+        {
+            M5.Display.setClipRect(0, firstRow, getDisplayWidth(), rowCount);
+            incoming.pushSprite(0, 0);
+            M5.Display.clearClipRect();
+        }
+        setHardwareScroll((transitionDirection > 0) ? rows % height : (height - rows) % height);
+    }
+    else
+    {
+        // Sprite pair: both frames move, every visible row is pushed
+        M5Canvas &outgoing = frameCanvas[frontCanvas];
+        outgoing.pushSprite(0, -transitionDirection * rows);
+        incoming.pushSprite(0, transitionDirection * (height - rows));
+    }
+    M5.Display.endWrite();
+
+    transitionRows = rows;
+}
+
+void M5DialDevice::finishTransition()
+{
+    transitionActive = false;
+    frontCanvas = 1 - frontCanvas;
+    frontCanvasValid = true;
+
+    Serial.printf("Transition: %lu frames, %lu dropped, p50 %lu us, p95 %lu us, max %lu us\n",
+                  (unsigned long)framePacer.getFrameCount(), (unsigned long)framePacer.getDroppedFrames(),
+                  (unsigned long)framePacer.getPercentile(50), (unsigned long)framePacer.getPercentile(95),
+                  (unsigned long)framePacer.getMaxFrameTime());
+}
+
+void M5DialDevice::setHardwareScroll(int firstRow)
+{
+    M5.Display.startWrite();
+    M5.Display.writeCommand(CMD_VSCRSADD);
+    M5.Display.writeData(firstRow >> 8);
+    M5.Display.writeData(firstRow & 0xFF);
+    M5.Display.endWrite();
+}
+
+void M5DialDevice::beginEventWait()
+{
+    waitingTask = xTaskGetCurrentTaskHandle();
+    attachInterrupt(digitalPinToInterrupt(BUTTON_PIN), notifyFromISR, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(TOUCH_INT_PIN), notifyFromISR, CHANGE);
+}
+
+void IRAM_ATTR M5DialDevice::notifyFromISR()
+{
+    TaskHandle_t task = waitingTask;
+    if (task == nullptr)
+    {
         return;
+    }
 
-    // Set font to get accurate metrics
-    M5.Display.setFont(fontPtr);
+    BaseType_t higherPriorityWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(task, &higherPriorityWoken);
+    if (higherPriorityWoken)
+    {
+        portYIELD_FROM_ISR();
+    }
+}
 
-    // Calculate font metrics using available M5GFX methods
-    int fontHeight = M5.Display.fontHeight();
-    int textWidth = M5.Display.textWidth(sampleText);
-    int charWidth = M5.Display.textWidth("A"); // Standard character width
+void M5DialDevice::notify()
+{
+    TaskHandle_t task = waitingTask;
+    if (task != nullptr)
+    {
+        xTaskNotifyGive(task);
+    }
+}
 
-    // Estimate baseline from font height (typical ratio is about 80% above baseline)
-    int baseline = fontHeight * 0.2; // Approximate descender height
-    int ascender = fontHeight - baseline;
-    int descender = baseline;
+void M5DialDevice::lockDisplay()
+{
+    if (displayLock != nullptr)
+    {
+        xSemaphoreTakeRecursive(displayLock, portMAX_DELAY);
+    }
+}
 
-    // Display metrics in compact format using Font2
-    M5.Display.setFont(&fonts::Font2);
-    M5.Display.setTextColor(CYAN);
-    M5.Display.setTextDatum(middle_center);
+void M5DialDevice::unlockDisplay()
+{
+    if (displayLock != nullptr)
+    {
+        xSemaphoreGiveRecursive(displayLock);
+    }
+}
+
+void M5DialDevice::waitForEvent(uint32_t timeoutMs)
+{
+    if (timeoutMs == 0)
+    {
+        return;
+    }
+    TickType_t ticks = (timeoutMs == EventScheduler::WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+    ulTaskNotifyTake(pdTRUE, ticks > 0 ? ticks : 1);
+}
 
-    int centerX = getDisplayWidth() / 2;
+void M5DialDevice::setPowerState(EventScheduler::PowerState state)
+{
+    if (state == powerState)
+    {
+        // Woken without a usable input (e.g. half an encoder detent): sleep again
+        if (state == EventScheduler::POWER_SLEEP && !Serial)
+        {
+            lightSleep();
+        }
+        return;
+    }
+
+    // The backlight is set through the panel, which a fan-out task may be drawing on
+    lockDisplay();
+    if (powerState == EventScheduler::POWER_ACTIVE)
+    {
+        activeBrightness = M5.Display.getBrightness();
+    }
+
+    switch (state)
+    {
+    case EventScheduler::POWER_ACTIVE:
+        M5.Display.setBrightness(activeBrightness);
+        unlockDisplay();
+        if (wakeMicros != 0)
+        {
+            Serial.printf("Wake latency: %lu us\n", micros() - wakeMicros);
+            wakeMicros = 0;
+        }
+        break;
+    case EventScheduler::POWER_DIMMED:
+        M5.Display.setBrightness(DIMMED_BRIGHTNESS);
+        unlockDisplay();
+        break;
+    case EventScheduler::POWER_SLEEP:
+        if (Serial)
+        {
+            // Keep the USB serial link up; stay dimmed instead
+            M5.Display.setBrightness(DIMMED_BRIGHTNESS);
+            unlockDisplay();
+            break;
+        }
+        M5.Display.setBrightness(0);
+        unlockDisplay();
+        lightSleep();
+        break;
+    }
+    powerState = state;
+}
+
+void M5DialDevice::lightSleep()
+{
+    const int wakePins[] = {Encoder::PIN_A, Encoder::PIN_B, BUTTON_PIN};
+
+    // GPIO wake is level triggered: wake when any pin leaves its current level
+    for (int pin : wakePins)
+    {
+        gpio_int_type_t level = digitalRead(pin) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL;
+        gpio_wakeup_enable((gpio_num_t)pin, level);
+    }
+    esp_sleep_enable_gpio_wakeup();
+
+    Serial.flush();
+    esp_light_sleep_start();
+    wakeMicros = micros();
+
+    // Wake-up left the pins level triggered; restore their CHANGE interrupts
+    for (int pin : wakePins)
+    {
+        gpio_wakeup_disable((gpio_num_t)pin);
+        gpio_set_intr_type((gpio_num_t)pin, GPIO_INTR_ANYEDGE);
+    }
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
 
-    // Create single line with all metrics - no wrapping, fits on one line
-    String allMetrics = "H:" + String(fontHeight) + " B:" + String(baseline) + " C:" + String(charWidth) + " A:" + String(ascender) + " D:" + String(descender) + " TW:" + String(textWidth);
-    M5.Display.drawString(allMetrics, centerX, yPosition);
+    // Pin interrupts are not delivered in light sleep: decode the edge that
+    // woke the chip, or the detent it started is lost, and poll inputs now
+    encoder.samplePins();
+    notify();
 }
 
 // Global instance for easy access
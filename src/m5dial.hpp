@@ -14,7 +14,12 @@
 
 #include <Arduino.h>
 #include <M5Unified.h>
+#include <atomic>
+#include "displaylist.hpp"
+#include "eventscheduler.hpp"
 #include "fontmanager.hpp"
+#include "framepacer.hpp"
+#include "specimen.hpp"
 
 /**
  * @class M5DialDevice
@@ -26,9 +31,46 @@
 class M5DialDevice : public DeviceInterface
 {
 private:
-    void drawWrappedText(const char *text, int centerX, int centerY);
-    int getStringWidth(const String &text);
-    void displayFontMetrics(const lgfx::IFont *fontPtr, const char *sampleText, int yPosition);
+    // Full-screen sprites: the front one holds the frame on screen, the back
+    // one receives the incoming frame during a transition
+    M5Canvas frameCanvas[2];
+    bool frameCanvasReady[2]; // true once the sprite has a buffer
+    int frontCanvas;          // Index of the sprite matching the screen
+    bool frontCanvasValid;    // false after drawing directly to the display
+    SpecimenRenderer renderer; // Lays frames out as display lists
+    DisplayList frameList;     // The frame being drawn
+
+    // Thumbnails: a 4-bit sprite to decode into, and the renderer state
+    // buildThumbnails() uses so it can run on another task
+    M5Canvas thumbnailCanvas;
+    bool thumbnailCanvasReady;
+    SpecimenRenderer thumbnailRenderer;
+    DisplayList thumbnailList;
+
+    // Power state
+    EventScheduler::PowerState powerState;
+    uint8_t activeBrightness; // Backlight level restored after dimming
+
+    // Transition state
+    FramePacer framePacer;
+    bool transitionPending;       // setTransition() was called for the next frame
+    bool transitionActive;        // A transition is being animated
+    bool transitionHardwareScroll; // Using the panel scroll instead of the sprite pair
+    int transitionDirection;
+    float transitionVelocity;
+    uint32_t transitionStart;     // micros() at the first frame
+    uint32_t transitionDuration;  // Total animation time in microseconds
+    int transitionRows;           // Rows of the incoming frame revealed so far
+
+    void drawList(lgfx::LovyanGFX &gfx, const DisplayList &list);
+    bool ensureThumbnailCanvas();
+    int getStringWidth(const char *text);
+    bool ensureFrameCanvas(int index);
+    bool startTransition();
+    void drawTransitionFrame(int rows);
+    void finishTransition();
+    void setHardwareScroll(int firstRow);
+    void lightSleep();
 
 public:
     /**
@@ -59,6 +101,19 @@ public:
      */
     int getDisplayHeight() const override;
 
+    /**
+     * @brief Get the width sample text is wrapped to
+     * @return Maximum line width in pixels
+     */
+    int getWrapWidth() const;
+
+    /**
+     * @brief Fill the font height and glyph width caches for a font ahead of its first render
+     * @param fontPtr Font to measure
+     * @param text Sample text whose glyphs to measure
+     */
+    void warmFontCache(const void *fontPtr, const char *text);
+
     /**
      * @brief Display font information and sample text
      * @param familyName Font family name
@@ -67,8 +122,91 @@ public:
      * @param fontPtr Pointer to the font object
      * @param sampleText Sample text to display
      */
-    void displayFont(const String &familyName, const String &fontName,
-                     int fontSize, const lgfx::IFont *fontPtr, const char *sampleText) override;
+    void displayFont(const char *familyName, const char *fontName,
+                     int fontSize, const void *fontPtr, const char *sampleText) override;
+
+    /**
+     * @brief Display an overview page with one specimen per font
+     * @param fonts Fonts shown on this page, in catalog order
+     * @param count Number of entries in fonts
+     * @param slots Number of rows a full page is laid out for
+     * @param sampleText Sample text to display in each font
+     * @param pageIndex Zero-based index of this page
+     * @param pageCount Total number of overview pages
+     */
+    void displayFontPage(const FontInfo *fonts, int count, int slots,
+                         const char *sampleText, int pageIndex, int pageCount) override;
+
+    /**
+     * @brief Show the stored thumbnail of a font in place of a live render
+     * @param fontId Catalog index of the font
+     * @param sampleText Sample text the thumbnail has to show
+     * @return false if thumbnailStore has none for this font and text
+     */
+    bool displayPreview(int fontId, const char *sampleText) override;
+
+    /**
+     * @brief Render the thumbnail of every catalog font into a thumbnail file
+     * @param path File to write; replaced only once every thumbnail is written
+     * @param fonts Catalog fonts, in catalog order
+     * @param fontCount Number of entries in fonts
+     * @param catalogHash Hash of the font catalog
+     * @param sampleText Text the thumbnails show
+     * @param cancel Checked between fonts; the build stops when it turns true
+     * @return false if cancelled or the file could not be written
+     *
+     * A thumbnail is the top of the single-font frame: the size, family and
+     * font labels and the wrapped sample text, without the metrics and
+     * instructions below. Draws only into its own sprite, so it may run on
+     * another task while the display is in use; thumbnailStore must not have
+     * the file open.
+     */
+    bool buildThumbnails(const char *path, const FontInfo *fonts, size_t fontCount, uint32_t catalogHash,
+                         const char *sampleText, const std::atomic<bool> &cancel);
+
+    /**
+     * @brief Request an animated transition for the next displayFont() call
+     * @param direction +1 slides the new font in from below, -1 from above
+     * @param velocity Encoder speed in detents per second
+     */
+    void setTransition(int direction, float velocity) override;
+
+    /**
+     * @brief Advance a running transition by at most one paced frame
+     * @param hurry true if a newer font is waiting and the transition should finish now
+     * @return true while a transition is still running
+     */
+    bool updateTransition(bool hurry) override;
+
+    /**
+     * @brief Read one row of the frame currently on screen
+     * @param y Row to read
+     * @param pixels Output, getDisplayWidth() pixels of RGB565 in byte-swapped
+     *               (most significant byte first) order
+     * @return true; the frame sprite or the panel can always be read
+     */
+    bool readFrameRow(int y, uint16_t *pixels) override;
+
+    // Take and release the panel with lockDisplay(), so a fan-out task cannot draw mid-read
+    void beginFrameRead() override;
+    void endFrameRead() override;
+
+    // Average cost of pushing one full frame sprite, see measurePush()
+    struct PushTiming
+    {
+        int colorDepth;       // Bits per pixel
+        uint32_t bufferBytes; // Sprite buffer size
+        uint32_t frameMicros; // 0 if the sprite could not be allocated
+    };
+
+    /**
+     * @brief Time full-frame pushes of the frame on screen
+     * @param repeats Pushes to average over
+     * @param frame Output, timing of the frame sprite as configured
+     * @param rgb565 Output, timing of the same frame as an RGB565 sprite
+     * @return false if no frame sprite is on screen
+     */
+    bool measurePush(int repeats, PushTiming &frame, PushTiming &rgb565);
 
     /**
      * @brief Update device state
@@ -86,6 +224,57 @@ public:
      * @return true if button was pressed
      */
     bool wasButtonPressed();
+
+    static const int BUTTON_PIN = 42;    // M5Dial front button (BtnA)
+    static const int TOUCH_INT_PIN = 14; // Touch controller interrupt, low while touched
+
+    /**
+     * @brief Let input interrupts wake the calling task from waitForEvent()
+     *
+     * Call from the task that runs loop(). Attaches pin-change interrupts to
+     * the button and the touch controller; pass notifyFromISR() to
+     * Encoder::setChangeCallback() as well.
+     */
+    void beginEventWait();
+
+    /**
+     * @brief Block until an input interrupt fires or the timeout passes
+     * @param timeoutMs Maximum time to block, EventScheduler::WAIT_FOREVER for no limit
+     */
+    void waitForEvent(uint32_t timeoutMs);
+
+    /**
+     * @brief Wake the task blocked in waitForEvent(); safe to call from interrupts
+     */
+    static void notifyFromISR();
+
+    /**
+     * @brief Wake the task blocked in waitForEvent() from another task
+     */
+    static void notify();
+
+    /**
+     * @brief Take the panel for a run of drawing or reads on M5.Display
+     *
+     * Only needed where another task draws on M5.Display as well, as the
+     * fan-out's dial target does. Font, color and clip are shared panel state,
+     * so hold the lock from setting them until the last draw. Recursive.
+     */
+    static void lockDisplay();
+
+    /**
+     * @brief Release the panel taken with lockDisplay()
+     */
+    static void unlockDisplay();
+
+    /**
+     * @brief Apply a power state: full backlight, dimmed, or backlight off and light sleep
+     * @param state Power state from the event scheduler
+     *
+     * POWER_SLEEP returns after the encoder or button wakes the chip. Light sleep
+     * is skipped while a USB host is connected, since it would drop the serial link.
+     */
+    void setPowerState(EventScheduler::PowerState state);
 };
 
 // Global instance declaration
@@ -0,0 +1,121 @@
+/**
+ * @file memorytracker.cpp
+ * @brief Per-subsystem heap accounting with high-water marks
+ * @date 2026-10-19
+ */
+
+#include "memorytracker.hpp"
+#include <stdio.h>
+
+#ifdef ESP_PLATFORM
+#include <soc/soc_memory_layout.h>
+#endif
+
+static const char *const tagNames[MEM_TAG_COUNT] = {
+    "font metrics",
+    "glyph widths",
+    "text layout",
+    "layout store",
+    "sample texts",
+    "sprites",
+    "thumbnails",
+    "truetype",
+    "display list",
+};
+
+MemoryRegion MemoryTracker::getRegion(const void *ptr)
+{
+#ifdef ESP_PLATFORM
+    return esp_ptr_external_ram(ptr) ? MEM_PSRAM : MEM_INTERNAL;
+#else
+    (void)ptr;
+    return MEM_INTERNAL;
+#endif
+}
+
+const char *MemoryTracker::getTagName(MemoryTag tag)
+{
+    return (tag < MEM_TAG_COUNT) ? tagNames[tag] : "?";
+}
+
+void MemoryTracker::recordAlloc(MemoryTag tag, const void *ptr, size_t bytes)
+{
+    if (tag >= MEM_TAG_COUNT || ptr == nullptr)
+    {
+        return;
+    }
+
+    MemoryRegion region = getRegion(ptr);
+    size_t now = current[tag][region].fetch_add(bytes) + bytes;
+    allocations[tag]++;
+
+    // Raise the high-water mark unless another task already raised it further
+    size_t high = peak[tag][region].load();
+    while (now > high && !peak[tag][region].compare_exchange_weak(high, now))
+    {
+    }
+}
+
+void MemoryTracker::recordFree(MemoryTag tag, const void *ptr, size_t bytes)
+{
+    if (tag >= MEM_TAG_COUNT || ptr == nullptr)
+    {
+        return;
+    }
+    current[tag][getRegion(ptr)].fetch_sub(bytes);
+}
+
+size_t MemoryTracker::getCurrent(MemoryTag tag, MemoryRegion region) const
+{
+    return (tag < MEM_TAG_COUNT && region < MEM_REGION_COUNT) ? current[tag][region].load() : 0;
+}
+
+size_t MemoryTracker::getPeak(MemoryTag tag, MemoryRegion region) const
+{
+    return (tag < MEM_TAG_COUNT && region < MEM_REGION_COUNT) ? peak[tag][region].load() : 0;
+}
+
+uint32_t MemoryTracker::getAllocationCount(MemoryTag tag) const
+{
+    return (tag < MEM_TAG_COUNT) ? allocations[tag].load() : 0;
+}
+
+size_t MemoryTracker::format(char *buffer, size_t size) const
+{
+    if (buffer == nullptr || size == 0)
+    {
+        return 0;
+    }
+
+    size_t used = snprintf(buffer, size, "%-13s %9s %9s %9s %9s %6s\n", "subsystem", "sram", "sram max",
+                           "psram", "psram max", "allocs");
+    for (int i = 0; i < MEM_TAG_COUNT && used < size; i++)
+    {
+        MemoryTag tag = (MemoryTag)i;
+        used += snprintf(buffer + used, size - used, "%-13s %9u %9u %9u %9u %6u\n", getTagName(tag),
+                         (unsigned)getCurrent(tag, MEM_INTERNAL), (unsigned)getPeak(tag, MEM_INTERNAL),
+                         (unsigned)getCurrent(tag, MEM_PSRAM), (unsigned)getPeak(tag, MEM_PSRAM),
+                         (unsigned)getAllocationCount(tag));
+    }
+    return used < size ? used : size - 1; // Truncated to fit
+}
+
+void *trackedAlloc(MemoryTag tag, size_t bytes)
+{
+    void *ptr = ::operator new(bytes);
+    memoryTracker.recordAlloc(tag, ptr, bytes);
+    return ptr;
+}
+
+void trackedFree(MemoryTag tag, void *ptr, size_t bytes)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    memoryTracker.recordFree(tag, ptr, bytes);
+    ::operator delete(ptr);
+}
+
+// Global instance for easy access
+MemoryTracker memoryTracker;
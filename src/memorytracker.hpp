@@ -0,0 +1,178 @@
+/**
+ * @file memorytracker.hpp
+ * @brief Per-subsystem heap accounting with high-water marks
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. On ESP32 targets allocations are
+ * split into internal SRAM and PSRAM by address; elsewhere everything counts
+ * as internal.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <new>
+
+enum MemoryTag : uint8_t
+{
+    MEM_FONT_METRICS = 0, // FontMetricsIndex entries
+    MEM_GLYPH_WIDTHS,     // GlyphWidthTable pages
+    MEM_TEXT_LAYOUT,      // TextLayout and TextEditor text, codepoints and lines
+    MEM_LAYOUT_STORE,     // Precomputed sample text layouts
+    MEM_SAMPLE_TEXTS,     // Loaded sample texts
+    MEM_SPRITES,          // Frame canvases
+    MEM_THUMBNAILS,       // Thumbnail offsets and read buffer
+    MEM_TRUETYPE,         // Scalable font faces, glyph cache and rasterizer
+    MEM_DISPLAY_LIST,     // Fan-out display lists
+    MEM_TAG_COUNT
+};
+
+enum MemoryRegion : uint8_t
+{
+    MEM_INTERNAL = 0,
+    MEM_PSRAM,
+    MEM_REGION_COUNT
+};
+
+/**
+ * @class MemoryTracker
+ * @brief Counts live bytes, peak bytes and allocations for each tag and region
+ *
+ * Counters are atomic so subsystems may allocate from different tasks. The
+ * class has no constructor: the global instance is zero-initialized before
+ * any static constructor runs, so globals that allocate are counted too.
+ */
+class MemoryTracker
+{
+private:
+    std::atomic<size_t> current[MEM_TAG_COUNT][MEM_REGION_COUNT];
+    std::atomic<size_t> peak[MEM_TAG_COUNT][MEM_REGION_COUNT];
+    std::atomic<uint32_t> allocations[MEM_TAG_COUNT];
+
+public:
+    /**
+     * @brief Get the region an address belongs to
+     * @param ptr Allocated block
+     * @return MEM_PSRAM for external RAM, MEM_INTERNAL otherwise
+     */
+    static MemoryRegion getRegion(const void *ptr);
+
+    /**
+     * @brief Get the display name of a tag
+     * @param tag Memory tag
+     * @return Short name
+     */
+    static const char *getTagName(MemoryTag tag);
+
+    /**
+     * @brief Record a block allocated on behalf of a subsystem
+     * @param tag Owning subsystem
+     * @param ptr Block address, used to pick the region
+     * @param bytes Block size
+     */
+    void recordAlloc(MemoryTag tag, const void *ptr, size_t bytes);
+
+    /**
+     * @brief Record that a block recorded with recordAlloc() was freed
+     * @param tag Owning subsystem
+     * @param ptr Block address
+     * @param bytes Block size
+     */
+    void recordFree(MemoryTag tag, const void *ptr, size_t bytes);
+
+    /**
+     * @brief Get the bytes currently allocated
+     * @param tag Memory tag
+     * @param region Memory region
+     * @return Live bytes
+     */
+    size_t getCurrent(MemoryTag tag, MemoryRegion region) const;
+
+    /**
+     * @brief Get the most bytes ever allocated at once
+     * @param tag Memory tag
+     * @param region Memory region
+     * @return High-water mark in bytes
+     */
+    size_t getPeak(MemoryTag tag, MemoryRegion region) const;
+
+    /**
+     * @brief Get the number of allocations made so far
+     * @param tag Memory tag
+     * @return Allocation count, including blocks since freed
+     */
+    uint32_t getAllocationCount(MemoryTag tag) const;
+
+    /**
+     * @brief Format a table of all tags: current and peak bytes per region, allocation count
+     * @param buffer Output buffer
+     * @param size Buffer size
+     * @return Characters written, excluding the terminator
+     */
+    size_t format(char *buffer, size_t size) const;
+};
+
+// Global instance declaration
+extern MemoryTracker memoryTracker;
+
+/**
+ * @brief Allocate raw memory charged to a subsystem
+ * @param tag Owning subsystem
+ * @param bytes Size in bytes
+ * @return Block (throws std::bad_alloc like operator new)
+ */
+void *trackedAlloc(MemoryTag tag, size_t bytes);
+
+/**
+ * @brief Free memory from trackedAlloc()
+ * @param tag Tag it was allocated with
+ * @param ptr Block, nullptr is ignored
+ * @param bytes Size it was allocated with
+ */
+void trackedFree(MemoryTag tag, void *ptr, size_t bytes);
+
+/**
+ * @class TaggedAllocator
+ * @brief Standard allocator that charges a container's storage to a subsystem
+ */
+template <typename T, MemoryTag Tag>
+class TaggedAllocator
+{
+public:
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef TaggedAllocator<U, Tag> other;
+    };
+
+    TaggedAllocator() noexcept {}
+
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U, Tag> &) noexcept {}
+
+    T *allocate(size_t count)
+    {
+        return static_cast<T *>(trackedAlloc(Tag, count * sizeof(T)));
+    }
+
+    void deallocate(T *ptr, size_t count) noexcept
+    {
+        trackedFree(Tag, ptr, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const TaggedAllocator<U, Tag> &) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const TaggedAllocator<U, Tag> &) const noexcept
+    {
+        return false;
+    }
+};
@@ -0,0 +1,61 @@
+/**
+ * @file quadrature.hpp
+ * @brief Step decoding of the dial encoder's two pins
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies, so pin sequences can be decoded on
+ * a host the way the pin interrupt decodes them.
+ */
+
+#pragma once
+
+/**
+ * @class QuadratureDecoder
+ * @brief Counts one step per falling edge of pin A, in the direction pin B gives
+ */
+class QuadratureDecoder
+{
+private:
+    bool lastA;
+    bool lastB;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    QuadratureDecoder() : lastA(false), lastB(false) {}
+
+    /**
+     * @brief Take pin levels as the starting point without counting a step
+     * @param a Level of pin A
+     * @param b Level of pin B
+     */
+    void reset(bool a, bool b)
+    {
+        lastA = a;
+        lastB = b;
+    }
+
+    /**
+     * @brief Decode the current pin levels
+     * @param a Level of pin A
+     * @param b Level of pin B
+     * @return +1 or -1 if this is a step, 0 otherwise
+     *
+     * Always inlined, so it runs from IRAM as part of the interrupt handler.
+     */
+    inline __attribute__((always_inline)) int update(bool a, bool b)
+    {
+        int step = 0;
+        if (lastA != a || lastB != b)
+        {
+            if (lastA && !a) // Falling edge on A
+            {
+                step = b ? 1 : -1;
+            }
+            lastA = a;
+            lastB = b;
+        }
+        return step;
+    }
+};
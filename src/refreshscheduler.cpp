@@ -0,0 +1,294 @@
+/**
+ * @file refreshscheduler.cpp
+ * @brief Dirty-rectangle batching and partial/full refresh decisions for e-paper
+ * @date 2026-10-19
+ */
+
+#include "refreshscheduler.hpp"
+
+static const uint32_t NO_WAIT = 0xFFFFFFFFUL;
+
+RefreshScheduler::RefreshScheduler(int panelWidth, int panelHeight) : width(panelWidth),
+                                                                      height(panelHeight),
+                                                                      rects(),
+                                                                      rectCount(0),
+                                                                      fullRequested(false),
+                                                                      firstDamage(0),
+                                                                      lastDamage(0),
+                                                                      settleMs(250),
+                                                                      maxLatencyMs(1500),
+                                                                      maxPartials(10),
+                                                                      fullAreaPercent(60),
+                                                                      partialsSinceFull(0),
+                                                                      cost({2000, 300, 0}),
+                                                                      partialRefreshes(0),
+                                                                      fullRefreshes(0)
+{
+}
+
+void RefreshScheduler::setPolicy(uint32_t settle, uint32_t maxLatency, int partialsBeforeFull, int fullArea)
+{
+    settleMs = settle;
+    maxLatencyMs = maxLatency;
+    maxPartials = partialsBeforeFull;
+    fullAreaPercent = fullArea;
+}
+
+void RefreshScheduler::setCostModel(const RefreshCostModel &model)
+{
+    cost = model;
+}
+
+DirtyRect RefreshScheduler::unite(const DirtyRect &a, const DirtyRect &b)
+{
+    int16_t left = (a.x < b.x) ? a.x : b.x;
+    int16_t top = (a.y < b.y) ? a.y : b.y;
+    int16_t right = (a.x + a.w > b.x + b.w) ? a.x + a.w : b.x + b.w;
+    int16_t bottom = (a.y + a.h > b.y + b.h) ? a.y + a.h : b.y + b.h;
+    return {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+}
+
+int32_t RefreshScheduler::area(const DirtyRect &rect)
+{
+    return (int32_t)rect.w * rect.h;
+}
+
+void RefreshScheduler::mergeClosestPair()
+{
+    // Merge the two rectangles whose union adds the least undamaged area
+    int bestA = 0;
+    int bestB = 1;
+    int32_t bestGrowth = 0x7FFFFFFF;
+    for (int a = 0; a < rectCount; a++)
+    {
+        for (int b = a + 1; b < rectCount; b++)
+        {
+            int32_t growth = area(unite(rects[a], rects[b])) - area(rects[a]) - area(rects[b]);
+            if (growth < bestGrowth)
+            {
+                bestGrowth = growth;
+                bestA = a;
+                bestB = b;
+            }
+        }
+    }
+
+    rects[bestA] = unite(rects[bestA], rects[bestB]);
+    rects[bestB] = rects[--rectCount];
+}
+
+void RefreshScheduler::addDamage(const DirtyRect &rect, uint32_t now)
+{
+    // Clip to the panel
+    int left = rect.x < 0 ? 0 : rect.x;
+    int top = rect.y < 0 ? 0 : rect.y;
+    int right = (rect.x + rect.w > width) ? width : rect.x + rect.w;
+    int bottom = (rect.y + rect.h > height) ? height : rect.y + rect.h;
+    if (right <= left || bottom <= top)
+    {
+        return;
+    }
+    DirtyRect clipped = {(int16_t)left, (int16_t)top, (int16_t)(right - left), (int16_t)(bottom - top)};
+
+    if (rectCount == 0 && !fullRequested)
+    {
+        firstDamage = now;
+    }
+    lastDamage = now;
+
+    // Absorb it into a rectangle it overlaps, otherwise keep it separate
+    for (int i = 0; i < rectCount; i++)
+    {
+        DirtyRect joined = unite(rects[i], clipped);
+        if (area(joined) <= area(rects[i]) + area(clipped))
+        {
+            rects[i] = joined;
+            return;
+        }
+    }
+
+    rects[rectCount++] = clipped;
+    if (rectCount == MAX_RECTS)
+    {
+        mergeClosestPair();
+    }
+}
+
+void RefreshScheduler::requestFull(uint32_t now)
+{
+    if (rectCount == 0 && !fullRequested)
+    {
+        firstDamage = now;
+    }
+    lastDamage = now;
+    fullRequested = true;
+}
+
+RefreshKind RefreshScheduler::poll(uint32_t now, DirtyRect *out, int &count)
+{
+    count = 0;
+    if (getWaitTime(now) != 0)
+    {
+        return REFRESH_NONE;
+    }
+
+    int32_t damaged = 0;
+    for (int i = 0; i < rectCount; i++)
+    {
+        damaged += area(rects[i]);
+    }
+
+    bool full = fullRequested || partialsSinceFull >= maxPartials ||
+                damaged * 100 >= (int32_t)width * height * fullAreaPercent ||
+                estimateCost(REFRESH_PARTIAL, rects, rectCount) >= cost.fullMs;
+
+    RefreshKind kind;
+    if (full)
+    {
+        kind = REFRESH_FULL;
+        partialsSinceFull = 0;
+        fullRefreshes++;
+    }
+    else
+    {
+        kind = REFRESH_PARTIAL;
+        for (int i = 0; i < rectCount; i++)
+        {
+            out[i] = rects[i];
+        }
+        count = rectCount;
+        partialsSinceFull++;
+        partialRefreshes++;
+    }
+
+    rectCount = 0;
+    fullRequested = false;
+    return kind;
+}
+
+uint32_t RefreshScheduler::getWaitTime(uint32_t now) const
+{
+    if (rectCount == 0 && !fullRequested)
+    {
+        return NO_WAIT;
+    }
+
+    // Signed differences keep this correct across millis() wrap-around
+    int32_t settle = (int32_t)(lastDamage + settleMs - now);
+    int32_t latency = (int32_t)(firstDamage + maxLatencyMs - now);
+    int32_t wait = (settle < latency) ? settle : latency;
+    return wait > 0 ? (uint32_t)wait : 0;
+}
+
+uint32_t RefreshScheduler::getPendingSince() const
+{
+    return firstDamage;
+}
+
+uint32_t RefreshScheduler::estimateCost(RefreshKind kind, const DirtyRect *regions, int count) const
+{
+    if (kind == REFRESH_FULL)
+    {
+        return cost.fullMs;
+    }
+
+    uint32_t total = 0;
+    for (int i = 0; i < count; i++)
+    {
+        total += cost.partialMs + (uint32_t)((uint64_t)area(regions[i]) * cost.partialPerKPixel / 1000000);
+    }
+    return total;
+}
+
+uint32_t RefreshScheduler::getPartialRefreshes() const
+{
+    return partialRefreshes;
+}
+
+uint32_t RefreshScheduler::getFullRefreshes() const
+{
+    return fullRefreshes;
+}
+
+// SimulatedEpd
+
+SimulatedEpd::SimulatedEpd(int panelWidth, int panelHeight, const RefreshCostModel &model) : width(panelWidth),
+                                                                                             height(panelHeight),
+                                                                                             cost(model),
+                                                                                             busyUntil(0),
+                                                                                             busyTotal(0),
+                                                                                             latencyTotal(0),
+                                                                                             maxLatency(0),
+                                                                                             refreshCount(0),
+                                                                                             ghosting(0),
+                                                                                             maxGhosting(0)
+{
+}
+
+uint32_t SimulatedEpd::refresh(RefreshKind kind, const DirtyRect *regions, int count, uint32_t now,
+                               uint32_t damagedAt)
+{
+    if (kind == REFRESH_NONE)
+    {
+        return now;
+    }
+
+    uint32_t duration;
+    if (kind == REFRESH_FULL)
+    {
+        duration = cost.fullMs;
+        ghosting = 0;
+    }
+    else
+    {
+        duration = 0;
+        for (int i = 0; i < count; i++)
+        {
+            uint32_t pixels = (uint32_t)regions[i].w * regions[i].h;
+            duration += cost.partialMs + (uint32_t)((uint64_t)pixels * cost.partialPerKPixel / 1000000);
+            ghosting += (float)pixels / ((float)width * height);
+        }
+        maxGhosting = (ghosting > maxGhosting) ? ghosting : maxGhosting;
+    }
+
+    // The panel refreshes one thing at a time
+    uint32_t start = isBusy(now) ? busyUntil : now;
+    busyUntil = start + duration;
+    busyTotal += duration;
+
+    uint32_t latency = busyUntil - damagedAt;
+    latencyTotal += latency;
+    maxLatency = (latency > maxLatency) ? latency : maxLatency;
+    refreshCount++;
+    return busyUntil;
+}
+
+bool SimulatedEpd::isBusy(uint32_t now) const
+{
+    return (int32_t)(busyUntil - now) > 0;
+}
+
+uint32_t SimulatedEpd::getBusyTime() const
+{
+    return busyTotal;
+}
+
+uint32_t SimulatedEpd::getMeanLatency() const
+{
+    return refreshCount > 0 ? latencyTotal / refreshCount : 0;
+}
+
+uint32_t SimulatedEpd::getMaxLatency() const
+{
+    return maxLatency;
+}
+
+float SimulatedEpd::getGhosting() const
+{
+    return ghosting;
+}
+
+float SimulatedEpd::getMaxGhosting() const
+{
+    return maxGhosting;
+}
@@ -0,0 +1,234 @@
+/**
+ * @file refreshscheduler.hpp
+ * @brief Dirty-rectangle batching and partial/full refresh decisions for e-paper
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies; every call takes the current time
+ * in milliseconds. SimulatedEpd stands in for a panel so scheduling policies
+ * can be compared against a virtual clock without hardware.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+struct DirtyRect
+{
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+enum RefreshKind : uint8_t
+{
+    REFRESH_NONE = 0,
+    REFRESH_PARTIAL, // Fast waveform on the dirty rectangles only, leaves ghosting
+    REFRESH_FULL,    // Slow flashing waveform over the whole panel, clears ghosting
+};
+
+// Refresh durations of a panel, used to choose between partial and full refreshes
+struct RefreshCostModel
+{
+    uint32_t fullMs;           // One full refresh
+    uint32_t partialMs;        // Fixed cost of one partial refresh region
+    uint32_t partialPerKPixel; // Added microseconds per 1000 pixels of region
+};
+
+/**
+ * @class RefreshScheduler
+ * @brief Collects damaged areas and decides when and how to refresh them
+ *
+ * Damage is merged into at most MAX_RECTS rectangles. Nothing is refreshed
+ * until the damage has settled for settleMs (so a burst of font changes costs
+ * one refresh) or has been pending for maxLatencyMs. A full refresh replaces
+ * the partial one when ghosting needs clearing (every maxPartials partial
+ * refreshes), when most of the panel changed, or when the cost model says the
+ * partial refresh would not be faster.
+ */
+class RefreshScheduler
+{
+public:
+    static const int MAX_RECTS = 4;
+
+private:
+    int width;
+    int height;
+    DirtyRect rects[MAX_RECTS];
+    int rectCount;
+    bool fullRequested;
+    uint32_t firstDamage;
+    uint32_t lastDamage;
+    uint32_t settleMs;
+    uint32_t maxLatencyMs;
+    int maxPartials;
+    int fullAreaPercent;
+    int partialsSinceFull;
+    RefreshCostModel cost;
+    uint32_t partialRefreshes;
+    uint32_t fullRefreshes;
+
+    static DirtyRect unite(const DirtyRect &a, const DirtyRect &b);
+    static int32_t area(const DirtyRect &rect);
+    void mergeClosestPair();
+
+public:
+    /**
+     * @brief Constructor
+     * @param panelWidth Panel width in pixels
+     * @param panelHeight Panel height in pixels
+     */
+    RefreshScheduler(int panelWidth, int panelHeight);
+
+    /**
+     * @brief Set the batching and ghosting policy
+     * @param settle Quiet time before pending damage is refreshed
+     * @param maxLatency Longest time damage may stay pending during continuous changes
+     * @param partialsBeforeFull Partial refreshes allowed between full refreshes
+     * @param fullArea Percentage of the panel above which a full refresh is used
+     */
+    void setPolicy(uint32_t settle, uint32_t maxLatency, int partialsBeforeFull, int fullArea);
+
+    /**
+     * @brief Set the refresh durations of the panel
+     * @param model Cost model
+     */
+    void setCostModel(const RefreshCostModel &model);
+
+    /**
+     * @brief Record a changed area
+     * @param rect Changed area, clipped to the panel
+     * @param now Current time in milliseconds
+     */
+    void addDamage(const DirtyRect &rect, uint32_t now);
+
+    /**
+     * @brief Make the next refresh a full one, even without damage
+     * @param now Current time in milliseconds
+     */
+    void requestFull(uint32_t now);
+
+    /**
+     * @brief Take the refresh that is due now, if any
+     * @param now Current time in milliseconds
+     * @param out Output, regions to refresh (unused for REFRESH_FULL)
+     * @param count Output, number of regions
+     * @return What to refresh; pending damage is cleared unless REFRESH_NONE
+     */
+    RefreshKind poll(uint32_t now, DirtyRect *out, int &count);
+
+    /**
+     * @brief Get how long until poll() may return a refresh
+     * @param now Current time in milliseconds
+     * @return Milliseconds, 0xFFFFFFFF with no pending damage
+     */
+    uint32_t getWaitTime(uint32_t now) const;
+
+    /**
+     * @brief Get when the oldest pending damage was added
+     * @return Time in milliseconds; meaningful only while damage is pending
+     */
+    uint32_t getPendingSince() const;
+
+    /**
+     * @brief Estimate how long a refresh takes under the cost model
+     * @param kind Refresh kind
+     * @param regions Regions for a partial refresh
+     * @param count Number of regions
+     * @return Milliseconds
+     */
+    uint32_t estimateCost(RefreshKind kind, const DirtyRect *regions, int count) const;
+
+    /**
+     * @brief Get the number of partial refreshes issued
+     * @return Partial refresh count
+     */
+    uint32_t getPartialRefreshes() const;
+
+    /**
+     * @brief Get the number of full refreshes issued
+     * @return Full refresh count
+     */
+    uint32_t getFullRefreshes() const;
+};
+
+/**
+ * @class SimulatedEpd
+ * @brief Host stand-in for an e-paper panel: tracks busy time and ghosting
+ *
+ * Each partial refresh adds ghosting in proportion to the area it covered; a
+ * full refresh clears it. A refresh issued while the panel is still busy
+ * starts when the previous one ends, so latency grows when a policy refreshes
+ * faster than the panel can.
+ */
+class SimulatedEpd
+{
+private:
+    int width;
+    int height;
+    RefreshCostModel cost;
+    uint32_t busyUntil;
+    uint32_t busyTotal;
+    uint32_t latencyTotal;
+    uint32_t maxLatency;
+    uint32_t refreshCount;
+    float ghosting;
+    float maxGhosting;
+
+public:
+    /**
+     * @brief Constructor
+     * @param panelWidth Panel width in pixels
+     * @param panelHeight Panel height in pixels
+     * @param model Refresh durations of the simulated panel
+     */
+    SimulatedEpd(int panelWidth, int panelHeight, const RefreshCostModel &model);
+
+    /**
+     * @brief Perform a refresh
+     * @param kind Refresh kind
+     * @param regions Regions for a partial refresh
+     * @param count Number of regions
+     * @param now Time the refresh is requested
+     * @param damagedAt Time the oldest refreshed change was drawn, for latency
+     * @return Time the refresh completes
+     */
+    uint32_t refresh(RefreshKind kind, const DirtyRect *regions, int count, uint32_t now, uint32_t damagedAt);
+
+    /**
+     * @brief Check whether a refresh is still running
+     * @param now Current time in milliseconds
+     * @return true while busy
+     */
+    bool isBusy(uint32_t now) const;
+
+    /**
+     * @brief Get the total time spent refreshing
+     * @return Milliseconds
+     */
+    uint32_t getBusyTime() const;
+
+    /**
+     * @brief Get the mean time from a change being drawn until its refresh completed
+     * @return Milliseconds
+     */
+    uint32_t getMeanLatency() const;
+
+    /**
+     * @brief Get the longest time from a change being drawn until its refresh completed
+     * @return Milliseconds
+     */
+    uint32_t getMaxLatency() const;
+
+    /**
+     * @brief Get the accumulated ghosting, in panel areas of partial refresh since the last full one
+     * @return Current ghosting
+     */
+    float getGhosting() const;
+
+    /**
+     * @brief Get the highest ghosting reached
+     * @return Peak ghosting
+     */
+    float getMaxGhosting() const;
+};
@@ -0,0 +1,134 @@
+/**
+ * @file rle4.cpp
+ * @brief Run-length codec for 4-bit palette-indexed pixel rows
+ * @date 2026-10-19
+ */
+
+#include "rle4.hpp"
+
+static const uint8_t RUN_FLAG = 0x80;
+static const size_t MIN_RUN = 3; // Shorter runs are cheaper as literals
+
+static inline uint8_t getPixel(const uint8_t *pixels, size_t index)
+{
+    return (index & 1) ? (pixels[index >> 1] & 0x0F) : (pixels[index >> 1] >> 4);
+}
+
+static inline void setPixel(uint8_t *pixels, size_t index, uint8_t value)
+{
+    uint8_t &byte = pixels[index >> 1];
+    byte = (index & 1) ? ((byte & 0xF0) | value) : ((byte & 0x0F) | (value << 4));
+}
+
+size_t rle4Encode(const uint8_t *pixels, size_t pixelCount, uint8_t *out, size_t outSize)
+{
+    size_t written = 0;
+    size_t i = 0;
+
+    while (i < pixelCount)
+    {
+        // Length of the run starting here
+        uint8_t value = getPixel(pixels, i);
+        size_t run = 1;
+        while (i + run < pixelCount && run < RLE4_MAX_PACKET && getPixel(pixels, i + run) == value)
+        {
+            run++;
+        }
+
+        if (run >= MIN_RUN)
+        {
+            if (written + 2 > outSize)
+            {
+                return 0;
+            }
+            out[written++] = RUN_FLAG | (run - 1);
+            out[written++] = value;
+            i += run;
+            continue;
+        }
+
+        // Literal up to the next run worth encoding
+        size_t literal = 1;
+        while (i + literal < pixelCount && literal < RLE4_MAX_PACKET)
+        {
+            size_t ahead = 1;
+            uint8_t next = getPixel(pixels, i + literal);
+            while (ahead < MIN_RUN && i + literal + ahead < pixelCount &&
+                   getPixel(pixels, i + literal + ahead) == next)
+            {
+                ahead++;
+            }
+            if (ahead >= MIN_RUN)
+            {
+                break;
+            }
+            literal++;
+        }
+
+        size_t literalBytes = (literal + 1) / 2;
+        if (written + 1 + literalBytes > outSize)
+        {
+            return 0;
+        }
+        out[written++] = literal - 1;
+        for (size_t k = 0; k < literalBytes; k++)
+        {
+            out[written + k] = 0;
+        }
+        for (size_t k = 0; k < literal; k++)
+        {
+            setPixel(out + written, k, getPixel(pixels, i + k));
+        }
+        written += literalBytes;
+        i += literal;
+    }
+    return written;
+}
+
+size_t rle4Decode(const uint8_t *data, size_t dataSize, uint8_t *pixels, size_t pixelCount)
+{
+    size_t consumed = 0;
+    size_t filled = 0;
+
+    while (filled < pixelCount)
+    {
+        if (consumed >= dataSize)
+        {
+            return 0;
+        }
+
+        uint8_t header = data[consumed++];
+        size_t count = (header & ~RUN_FLAG) + 1;
+        if (filled + count > pixelCount)
+        {
+            return 0;
+        }
+
+        if (header & RUN_FLAG)
+        {
+            if (consumed + 1 > dataSize)
+            {
+                return 0;
+            }
+            uint8_t value = data[consumed++] & 0x0F;
+            for (size_t k = 0; k < count; k++)
+            {
+                setPixel(pixels, filled++, value);
+            }
+        }
+        else
+        {
+            size_t literalBytes = (count + 1) / 2;
+            if (consumed + literalBytes > dataSize)
+            {
+                return 0;
+            }
+            for (size_t k = 0; k < count; k++)
+            {
+                setPixel(pixels, filled++, getPixel(data + consumed, k));
+            }
+            consumed += literalBytes;
+        }
+    }
+    return consumed;
+}
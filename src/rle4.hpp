@@ -0,0 +1,53 @@
+/**
+ * @file rle4.hpp
+ * @brief Run-length codec for 4-bit palette-indexed pixel rows
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies.
+ *
+ * Rows are packed two pixels per byte, the first pixel in the high nibble, as
+ * in LovyanGFX 4-bit sprites. Packets start with one header byte. If its top
+ * bit is set the packet is a run: (header & 0x7F) + 1 pixels (at least 3) of the index in
+ * the low nibble of the byte that follows. Otherwise it is a literal: header
+ * + 1 pixels follow, packed like the row.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest packet, in pixels
+static const size_t RLE4_MAX_PACKET = 128;
+
+/**
+ * @brief Worst-case encoded size of a row
+ * @param pixelCount Pixels in the row
+ * @return Bytes needed by rle4Encode() for any content
+ */
+constexpr size_t rle4MaxEncodedSize(size_t pixelCount)
+{
+    // Runs take at least 3 pixels, so the worst case alternates 1-pixel
+    // literals (2 bytes) with 3-pixel runs (2 bytes)
+    return pixelCount + 2;
+}
+
+/**
+ * @brief Encode pixels
+ * @param pixels Packed pixels to encode
+ * @param pixelCount Number of pixels
+ * @param out Output buffer
+ * @param outSize Size of out; rle4MaxEncodedSize(pixelCount) always suffices
+ * @return Encoded size in bytes, 0 if out was too small
+ */
+size_t rle4Encode(const uint8_t *pixels, size_t pixelCount, uint8_t *out, size_t outSize);
+
+/**
+ * @brief Decode pixels
+ * @param data Encoded bytes
+ * @param dataSize Number of encoded bytes
+ * @param pixels Output, packed pixels
+ * @param pixelCount Number of pixels expected
+ * @return Bytes consumed, 0 if the data is malformed or does not fill pixelCount exactly
+ */
+size_t rle4Decode(const uint8_t *data, size_t dataSize, uint8_t *pixels, size_t pixelCount);
@@ -0,0 +1,104 @@
+/**
+ * @file rle565.cpp
+ * @brief Run-length codec for RGB565 pixel rows
+ * @date 2026-10-19
+ */
+
+#include "rle565.hpp"
+#include <string.h>
+
+static const uint8_t RUN_FLAG = 0x80;
+
+size_t rle565Encode(const uint16_t *pixels, size_t pixelCount, uint8_t *out, size_t outSize)
+{
+    size_t written = 0;
+    size_t i = 0;
+
+    while (i < pixelCount)
+    {
+        // Length of the run starting here
+        size_t run = 1;
+        while (i + run < pixelCount && run < RLE565_MAX_PACKET && pixels[i + run] == pixels[i])
+        {
+            run++;
+        }
+
+        if (run >= 2)
+        {
+            if (written + 3 > outSize)
+            {
+                return 0;
+            }
+            out[written++] = RUN_FLAG | (run - 1);
+            memcpy(out + written, &pixels[i], 2);
+            written += 2;
+            i += run;
+            continue;
+        }
+
+        // Literal up to the next run of two or more
+        size_t literal = 1;
+        while (i + literal < pixelCount && literal < RLE565_MAX_PACKET &&
+               !(i + literal + 1 < pixelCount && pixels[i + literal] == pixels[i + literal + 1]))
+        {
+            literal++;
+        }
+
+        if (written + 1 + literal * 2 > outSize)
+        {
+            return 0;
+        }
+        out[written++] = literal - 1;
+        memcpy(out + written, &pixels[i], literal * 2);
+        written += literal * 2;
+        i += literal;
+    }
+    return written;
+}
+
+size_t rle565Decode(const uint8_t *data, size_t dataSize, uint16_t *pixels, size_t pixelCount)
+{
+    size_t consumed = 0;
+    size_t filled = 0;
+
+    while (filled < pixelCount)
+    {
+        if (consumed >= dataSize)
+        {
+            return 0;
+        }
+
+        uint8_t header = data[consumed++];
+        size_t count = (header & ~RUN_FLAG) + 1;
+        if (filled + count > pixelCount)
+        {
+            return 0;
+        }
+
+        if (header & RUN_FLAG)
+        {
+            if (consumed + 2 > dataSize)
+            {
+                return 0;
+            }
+            uint16_t pixel;
+            memcpy(&pixel, data + consumed, 2);
+            consumed += 2;
+            for (size_t i = 0; i < count; i++)
+            {
+                pixels[filled++] = pixel;
+            }
+        }
+        else
+        {
+            if (consumed + count * 2 > dataSize)
+            {
+                return 0;
+            }
+            memcpy(pixels + filled, data + consumed, count * 2);
+            consumed += count * 2;
+            filled += count;
+        }
+    }
+    return consumed;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file rle565.hpp
+ * @brief Run-length codec for RGB565 pixel rows
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies.
+ *
+ * Packets start with one header byte. If its top bit is set the packet is a
+ * run: (header & 0x7F) + 1 copies of the single pixel that follows. Otherwise
+ * it is a literal: header + 1 pixels follow. Pixels are two bytes each and are
+ * copied in memory order, so a row of byte-swapped (big-endian) RGB565 as kept
+ * in LovyanGFX sprites goes on the wire most significant byte first.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest packet, in pixels
+static const size_t RLE565_MAX_PACKET = 128;
+
+/**
+ * @brief Worst-case encoded size of a row
+ * @param pixelCount Pixels in the row
+ * @return Bytes needed by rle565Encode() for any content
+ */
+constexpr size_t rle565MaxEncodedSize(size_t pixelCount)
+{
+    return pixelCount * 2 + (pixelCount + RLE565_MAX_PACKET - 1) / RLE565_MAX_PACKET;
+}
+
+/**
+ * @brief Encode pixels
+ * @param pixels Pixels to encode
+ * @param pixelCount Number of pixels
+ * @param out Output buffer
+ * @param outSize Size of out; rle565MaxEncodedSize(pixelCount) always suffices
+ * @return Encoded size in bytes, 0 if out was too small
+ */
+size_t rle565Encode(const uint16_t *pixels, size_t pixelCount, uint8_t *out, size_t outSize);
+
+/**
+ * @brief Decode pixels
+ * @param data Encoded bytes
+ * @param dataSize Number of encoded bytes
+ * @param pixels Output pixels
+ * @param pixelCount Number of pixels expected
+ * @return Bytes consumed, 0 if the data is malformed or does not fill pixelCount exactly
+ */
+size_t rle565Decode(const uint8_t *data, size_t dataSize, uint16_t *pixels, size_t pixelCount);
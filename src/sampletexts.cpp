@@ -0,0 +1,192 @@
+/**
+ * @file sampletexts.cpp
+ * @brief Sample text store loaded from flash at boot
+ * @date 2026-10-19
+ */
+
+#include "sampletexts.hpp"
+#include "fnv1a.hpp"
+#include "fontcatalog.hpp"
+#include "textlayout.hpp"
+#include <stdio.h>
+#include <string.h>
+
+static const char *const defaultSampleTexts[] = {
+    "Hello World!",
+    "Font Demo",
+    "M5Dial",
+    "12345",
+    "ABC abc",
+    // https://en.wikipedia.org/wiki/Pangram
+    "Pack my box with five dozen liquor jugs",
+    "The quick brown fox jumps over the lazy dog",
+    "Glib jocks quiz nymph to vex dwarf.",
+    "Sphinx of black quartz, judge my vow.",
+    "How vexingly quick daft zebras jump!",
+    "The five boxing wizards jump quickly.",
+    "Jackdaws love my big sphinx of quartz."
+#if FONT_CATALOG_HAS_CJK
+    ,
+    // Iroha (Japanese pangram) and the opening of the Thousand Character Classic
+    "いろはにほへと ちりぬるを わかよたれそ つねならむ",
+    "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。"
+#endif
+};
+
+#if !FONT_CATALOG_HAS_CJK
+// Without CJK fonts such a text would show only fallback glyphs
+static bool needsCjkFont(const char *text)
+{
+    SpanList spans;
+    decodeUtf8(text, spans);
+    for (size_t i = 0; i < spans.size(); i++)
+    {
+        if (isIdeographic(spans[i].codepoint))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+SampleTextStore::SampleTextStore() : textsHash(0),
+                                     current(0)
+{
+    loadDefaults();
+}
+
+void SampleTextStore::loadDefaults()
+{
+    texts.clear();
+    for (size_t i = 0; i < sizeof(defaultSampleTexts) / sizeof(defaultSampleTexts[0]); i++)
+    {
+        texts.push_back(defaultSampleTexts[i]);
+    }
+    finishLoad();
+}
+
+void SampleTextStore::finishLoad()
+{
+    textPointers.clear();
+    textsHash = FNV1A_SEED;
+    for (size_t i = 0; i < texts.size(); i++)
+    {
+        textPointers.push_back(texts[i].c_str());
+        textsHash = fnv1aString(texts[i].c_str(), textsHash);
+    }
+}
+
+size_t SampleTextStore::load(const char *path)
+{
+    FILE *file = (path != nullptr) ? fopen(path, "r") : nullptr;
+    if (file == nullptr)
+    {
+        loadDefaults();
+        return texts.size();
+    }
+
+    texts.clear();
+    char line[MAX_TEXT_BYTES + 2];
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        size_t length = strlen(line);
+        bool complete = (length > 0 && line[length - 1] == '\n');
+
+        // Strip the line ending (LF or CRLF)
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r'))
+        {
+            line[--length] = 0;
+        }
+
+        // Skip the rest of an over-long line
+        if (!complete && !feof(file))
+        {
+            int c;
+            while ((c = fgetc(file)) != EOF && c != '\n')
+            {
+            }
+        }
+
+        if (length > MAX_TEXT_BYTES)
+        {
+            // Do not leave a partial UTF-8 sequence at the end
+            length = MAX_TEXT_BYTES;
+            while (length > 0 && (static_cast<uint8_t>(line[length]) & 0xC0) == 0x80)
+            {
+                length--;
+            }
+            line[length] = 0;
+        }
+
+        if (length == 0 || line[0] == '#')
+        {
+            continue;
+        }
+#if !FONT_CATALOG_HAS_CJK
+        if (needsCjkFont(line))
+        {
+            continue;
+        }
+#endif
+        texts.push_back(line);
+    }
+    fclose(file);
+
+    if (texts.empty())
+    {
+        loadDefaults();
+        return texts.size();
+    }
+
+    finishLoad();
+    return texts.size();
+}
+
+size_t SampleTextStore::getCount() const
+{
+    return texts.size();
+}
+
+const char *SampleTextStore::getText(size_t index) const
+{
+    if (texts.empty())
+    {
+        return "";
+    }
+    return textPointers[index % textPointers.size()];
+}
+
+size_t SampleTextStore::getCurrentIndex() const
+{
+    return current;
+}
+
+const char *SampleTextStore::select(size_t index)
+{
+    current = texts.empty() ? 0 : index % texts.size();
+    return getText(current);
+}
+
+const char *SampleTextStore::selectNext()
+{
+    return select(current + 1);
+}
+
+const char *const *SampleTextStore::getTexts() const
+{
+    return textPointers.data();
+}
+
+uint32_t SampleTextStore::getHash() const
+{
+    return textsHash;
+}
+
+const char *SampleTextStore::getDefaultText()
+{
+    return defaultSampleTexts[0];
+}
+
+// Global instance for easy access
+SampleTextStore sampleTextStore;
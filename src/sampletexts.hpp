@@ -0,0 +1,108 @@
+/**
+ * @file sampletexts.hpp
+ * @brief Sample text store loaded from flash at boot
+ * @date 2026-10-19
+ *
+ * Plain C++ using stdio, so the same code reads LittleFS on the device
+ * (through its VFS mount point) or an ordinary file elsewhere.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "memorytracker.hpp"
+
+/**
+ * @class SampleTextStore
+ * @brief Holds the sample texts the button cycles through
+ *
+ * Texts are read from a UTF-8 file with one text per line; blank lines and
+ * lines starting with '#' are skipped, and so are CJK texts when the build has
+ * no CJK fonts. Without a file the built-in texts are used. Pointers returned
+ * by getText() stay valid until the next load().
+ */
+class SampleTextStore
+{
+public:
+    static const size_t MAX_TEXT_BYTES = 256; // Longer lines are truncated
+
+private:
+    typedef std::basic_string<char, std::char_traits<char>, TaggedAllocator<char, MEM_SAMPLE_TEXTS>> Text;
+
+    std::vector<Text, TaggedAllocator<Text, MEM_SAMPLE_TEXTS>> texts;
+    std::vector<const char *, TaggedAllocator<const char *, MEM_SAMPLE_TEXTS>> textPointers;
+    uint32_t textsHash;
+    size_t current; // Text the button last selected
+
+    void loadDefaults();
+    void finishLoad();
+
+public:
+    /**
+     * @brief Constructor - starts with the built-in texts
+     */
+    SampleTextStore();
+
+    /**
+     * @brief Load texts from a file, falling back to the built-in texts
+     * @param path File to read
+     * @return Number of texts loaded
+     */
+    size_t load(const char *path);
+
+    /**
+     * @brief Get the number of texts
+     * @return Text count
+     */
+    size_t getCount() const;
+
+    /**
+     * @brief Get one text
+     * @param index Text index (wraps around)
+     * @return NUL-terminated UTF-8 text
+     */
+    const char *getText(size_t index) const;
+
+    /**
+     * @brief Get the index of the selected text
+     * @return Index passed to the last select(), 0 initially
+     */
+    size_t getCurrentIndex() const;
+
+    /**
+     * @brief Select a text
+     * @param index Text index (wraps around)
+     * @return The selected text
+     */
+    const char *select(size_t index);
+
+    /**
+     * @brief Select the text after the current one
+     * @return The selected text
+     */
+    const char *selectNext();
+
+    /**
+     * @brief Get all texts as an array
+     * @return getCount() text pointers
+     */
+    const char *const *getTexts() const;
+
+    /**
+     * @brief Get a hash of all texts, used to key cached layouts
+     * @return FNV-1a hash of the texts in order
+     */
+    uint32_t getHash() const;
+
+    /**
+     * @brief Get the first built-in text
+     * @return Text that stays valid while load() runs on another task
+     */
+    static const char *getDefaultText();
+};
+
+// Global instance declaration
+extern SampleTextStore sampleTextStore;
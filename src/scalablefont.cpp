@@ -0,0 +1,339 @@
+/**
+ * @file scalablefont.cpp
+ * @brief lgfx::IFont backend drawing TrueType faces at any pixel size
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ */
+
+#include "scalablefont.hpp"
+#include "fnv1a.hpp"
+#include <esp_heap_caps.h>
+#include <math.h>
+#include <stdio.h>
+
+static const int PALETTE_THRESHOLD = 8; // Coverage (of 15) drawn on palette sprites
+
+ScalableFontLibrary::ScalableFontLibrary() : faces(),
+                                             cache(),
+                                             rasterizer(),
+                                             scratch(),
+                                             mutex(nullptr),
+                                             rasterizeMicros(0),
+                                             rasterizeCount(0)
+{
+}
+
+bool ScalableFontLibrary::loadFace(int faceId, const char *path)
+{
+    if (faceId < 0 || faceId >= MAX_FACES || path == nullptr)
+    {
+        return false;
+    }
+    unloadFace(faceId);
+    if (mutex == nullptr)
+    {
+        mutex = xSemaphoreCreateMutex();
+    }
+
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    long length = (fseek(file, 0, SEEK_END) == 0) ? ftell(file) : -1;
+    uint8_t *data = (length > 0) ? static_cast<uint8_t *>(heap_caps_malloc(length, MALLOC_CAP_SPIRAM)) : nullptr;
+    bool ok = data != nullptr && fseek(file, 0, SEEK_SET) == 0 && fread(data, 1, length, file) == (size_t)length;
+    fclose(file);
+
+    LoadedFace &slot = faces[faceId];
+    if (ok && slot.face.load(data, length))
+    {
+        memoryTracker.recordAlloc(MEM_TRUETYPE, data, length);
+        slot.data = data;
+        slot.size = length;
+        slot.hash = fnv1a(data, length);
+        return true;
+    }
+
+    slot.face = TrueTypeFace();
+    heap_caps_free(data);
+    return false;
+}
+
+void ScalableFontLibrary::unloadFace(int faceId)
+{
+    if (faceId < 0 || faceId >= MAX_FACES || faces[faceId].data == nullptr)
+    {
+        return;
+    }
+
+    lock();
+    cache.clearFace(faceId);
+    unlock();
+
+    LoadedFace &slot = faces[faceId];
+    memoryTracker.recordFree(MEM_TRUETYPE, slot.data, slot.size);
+    heap_caps_free(slot.data);
+    slot.face = TrueTypeFace();
+    slot.data = nullptr;
+    slot.size = 0;
+    slot.hash = 0;
+}
+
+const TrueTypeFace *ScalableFontLibrary::getFace(int faceId) const
+{
+    if (faceId < 0 || faceId >= MAX_FACES || !faces[faceId].face.isLoaded())
+    {
+        return nullptr;
+    }
+    return &faces[faceId].face;
+}
+
+size_t ScalableFontLibrary::getFaceSize(int faceId) const
+{
+    return (getFace(faceId) != nullptr) ? faces[faceId].size : 0;
+}
+
+uint32_t ScalableFontLibrary::getHash() const
+{
+    uint32_t hash = FNV1A_SEED;
+    for (int i = 0; i < MAX_FACES; i++)
+    {
+        if (faces[i].data != nullptr)
+        {
+            hash = fnv1a(&faces[i].hash, sizeof(faces[i].hash), hash);
+        }
+    }
+    return hash;
+}
+
+void ScalableFontLibrary::lock()
+{
+    // The mutex is created by the first loadFace(); without faces there is nothing to guard
+    if (mutex != nullptr)
+    {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+    }
+}
+
+void ScalableFontLibrary::unlock()
+{
+    if (mutex != nullptr)
+    {
+        xSemaphoreGive(mutex);
+    }
+}
+
+const GlyphBitmap *ScalableFontLibrary::getGlyph(int faceId, int pixelsPerEm, uint32_t codepoint)
+{
+    const TrueTypeFace *face = getFace(faceId);
+    if (face == nullptr)
+    {
+        return nullptr;
+    }
+
+    const GlyphBitmap *glyph = cache.find(faceId, pixelsPerEm, codepoint);
+    if (glyph != nullptr)
+    {
+        return glyph;
+    }
+
+    uint32_t start = micros();
+    bool found = rasterizer.rasterize(*face, codepoint, pixelsPerEm, scratch);
+    rasterizeMicros += micros() - start;
+    rasterizeCount++;
+    return found ? cache.insert(faceId, pixelsPerEm, codepoint, scratch) : nullptr;
+}
+
+void ScalableFontLibrary::clearCache()
+{
+    lock();
+    cache.clear();
+    unlock();
+}
+
+GlyphCache::Stats ScalableFontLibrary::getCacheStats()
+{
+    lock();
+    GlyphCache::Stats stats = cache.getStats();
+    unlock();
+    return stats;
+}
+
+uint32_t ScalableFontLibrary::getRasterizeMicros(uint32_t &glyphs) const
+{
+    glyphs = rasterizeCount;
+    return rasterizeMicros;
+}
+
+void ScalableFontLibrary::resetTiming()
+{
+    lock();
+    cache.resetStats();
+    rasterizeMicros = 0;
+    rasterizeCount = 0;
+    unlock();
+}
+
+// ScalableFont
+
+void ScalableFont::getDefaultMetric(lgfx::FontMetrics *metrics) const
+{
+    const TrueTypeFace *face = scalableFonts.getFace(faceId);
+    if (face == nullptr)
+    {
+        // No face loaded: a blank font of the nominal size
+        *metrics = {0, 0, 0, (int16_t)pixelSize, (int16_t)pixelSize, (int16_t)-pixelSize, (int16_t)pixelSize};
+        return;
+    }
+
+    const TrueTypeFace::Metrics &faceMetrics = face->getMetrics();
+    float scale = (float)pixelSize / faceMetrics.unitsPerEm;
+    int ascent = (int)ceilf(faceMetrics.ascender * scale);
+    int descent = (int)ceilf(-faceMetrics.descender * scale);
+    metrics->width = 0;
+    metrics->x_advance = 0;
+    metrics->x_offset = 0;
+    metrics->height = ascent + descent;
+    metrics->y_advance = ascent + descent + (int)lroundf(faceMetrics.lineGap * scale);
+    metrics->y_offset = -ascent;
+    metrics->baseline = ascent;
+}
+
+bool ScalableFont::updateFontMetric(lgfx::FontMetrics *metrics, uint16_t uniCode) const
+{
+    // From the font tables alone, so measuring text never rasterizes
+    const TrueTypeFace *face = scalableFonts.getFace(faceId);
+    if (face == nullptr)
+    {
+        return false;
+    }
+
+    uint16_t glyph = face->findGlyph(uniCode);
+    bool found = glyph != 0;
+    if (!found)
+    {
+        glyph = face->findGlyph(' '); // Missing glyphs take up a space, as with GFX fonts
+    }
+
+    float scale = (float)pixelSize / face->getMetrics().unitsPerEm;
+    int advance;
+    int leftBearing;
+    face->getHorizontalMetrics(glyph, advance, leftBearing);
+    metrics->x_advance = (int16_t)lroundf(advance * scale);
+
+    int xMin, yMin, xMax, yMax;
+    if (face->getBounds(glyph, xMin, yMin, xMax, yMax))
+    {
+        metrics->x_offset = (int16_t)floorf(xMin * scale);
+        metrics->width = (int16_t)ceilf(xMax * scale) - metrics->x_offset;
+    }
+    else
+    {
+        metrics->x_offset = 0;
+        metrics->width = 0;
+    }
+    return found;
+}
+
+size_t ScalableFont::drawChar(lgfx::LGFXBase *gfx, int32_t x, int32_t y, uint16_t c, const lgfx::TextStyle *style,
+                              lgfx::FontMetrics *metrics, int32_t &filled_x) const
+{
+    const int sx = (style->size_x >= 1) ? (int)style->size_x : 1;
+    const int sy = (style->size_y >= 1) ? (int)style->size_y : 1;
+    const uint32_t fore = style->fore_rgb888;
+    const bool transparent = style->fore_rgb888 == style->back_rgb888;
+    const uint32_t back = transparent ? 0 : style->back_rgb888;
+    const bool palette = gfx->hasPalette();
+    if (scalableFonts.getFace(faceId) == nullptr)
+    {
+        return 0;
+    }
+
+    scalableFonts.lock();
+    const GlyphBitmap *glyph = scalableFonts.getGlyph(faceId, pixelSize, c);
+    if (glyph == nullptr)
+    {
+        glyph = scalableFonts.getGlyph(faceId, pixelSize, ' ');
+    }
+    if (glyph == nullptr)
+    {
+        scalableFonts.unlock();
+        return 0;
+    }
+
+    const int advance = glyph->advance * sx;
+    if (!transparent && advance > 0)
+    {
+        // Fill the cell from where the previous character left off
+        int32_t left = (filled_x > x) ? filled_x : x;
+        if (x + advance > left)
+        {
+            gfx->fillRect(left, y, x + advance - left, metrics->height * sy, back);
+        }
+        filled_x = x + advance;
+    }
+
+    // Precompute the blended colors for each coverage level
+    uint32_t ramp[16];
+    for (int level = 0; level < 16; level++)
+    {
+        uint32_t color = 0;
+        for (int shift = 0; shift < 24; shift += 8)
+        {
+            int f = (fore >> shift) & 0xFF;
+            int b = (back >> shift) & 0xFF;
+            color |= (uint32_t)(b + (f - b) * level / 15) << shift;
+        }
+        ramp[level] = color;
+    }
+
+    const int originX = x + glyph->left * sx;
+    const int originY = y + (metrics->baseline - glyph->top) * sy;
+    const size_t stride = glyph->getStride();
+    for (int row = 0; row < glyph->height; row++)
+    {
+        const uint8_t *pixels = glyph->pixels.data() + row * stride;
+        int column = 0;
+        while (column < glyph->width)
+        {
+            // One draw call per run of equal coverage
+            int level = (pixels[column >> 1] >> ((column & 1) ? 0 : 4)) & 0x0F;
+            int runEnd = column + 1;
+            while (runEnd < glyph->width && ((pixels[runEnd >> 1] >> ((runEnd & 1) ? 0 : 4)) & 0x0F) == level)
+            {
+                runEnd++;
+            }
+
+            if (palette)
+            {
+                level = (level >= PALETTE_THRESHOLD) ? 15 : 0;
+            }
+            if (level > 0)
+            {
+                uint32_t color = palette ? fore : ramp[level];
+                if (sx == 1 && sy == 1)
+                {
+                    gfx->drawFastHLine(originX + column, originY + row, runEnd - column, color);
+                }
+                else
+                {
+                    gfx->fillRect(originX + column * sx, originY + row * sy, (runEnd - column) * sx, sy, color);
+                }
+            }
+            column = runEnd;
+        }
+    }
+
+    scalableFonts.unlock();
+    return advance;
+}
+
+// Global instance for easy access
+ScalableFontLibrary scalableFonts;
@@ -0,0 +1,179 @@
+/**
+ * @file scalablefont.hpp
+ * @brief lgfx::IFont backend drawing TrueType faces at any pixel size
+ * @date 2026-10-19
+ *
+ * @Hardwares: M5Dial
+ * @Platform Version: Arduino M5Stack Board Manager v2.0.7
+ * @Dependent Library:
+ * M5GFX: https://github.com/m5stack/M5GFX
+ * M5Unified: https://github.com/m5stack/M5Unified
+ *
+ * One font file per face replaces a bitmap font per size: ScalableFont
+ * objects are just (face, size) pairs, glyphs are rasterized on first use
+ * and kept in a shared GlyphCache.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "M5GFX.h"
+#include "glyphcache.hpp"
+#include "truetype.hpp"
+
+/**
+ * @class ScalableFontLibrary
+ * @brief Loaded font faces plus the glyph cache and rasterizer they share
+ *
+ * Face files are read into PSRAM. Glyph lookups go through one mutex, since
+ * both the main loop and the thumbnail task draw text.
+ */
+class ScalableFontLibrary
+{
+public:
+    static const int MAX_FACES = 4;
+
+private:
+    struct LoadedFace
+    {
+        TrueTypeFace face;
+        uint8_t *data;
+        size_t size;
+        uint32_t hash; // FNV-1a of the file
+    };
+
+    LoadedFace faces[MAX_FACES];
+    GlyphCache cache;
+    GlyphRasterizer rasterizer;
+    GlyphBitmap scratch; // Rasterizer output, moved into the cache
+    SemaphoreHandle_t mutex;
+    uint32_t rasterizeMicros; // Time spent in the rasterizer since resetTiming()
+    uint32_t rasterizeCount;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    ScalableFontLibrary();
+
+    /**
+     * @brief Read a TrueType file into PSRAM and parse it
+     * @param faceId Slot to load into (0..MAX_FACES-1), replacing its face
+     * @param path File to read
+     * @return false if the file is missing, too large for PSRAM or not a usable TrueType font
+     */
+    bool loadFace(int faceId, const char *path);
+
+    /**
+     * @brief Free a face and drop its cached glyphs
+     * @param faceId Slot to clear
+     */
+    void unloadFace(int faceId);
+
+    /**
+     * @brief Get a loaded face
+     * @param faceId Slot
+     * @return Face, or nullptr if the slot is empty
+     */
+    const TrueTypeFace *getFace(int faceId) const;
+
+    /**
+     * @brief Get the size of a loaded face's file
+     * @param faceId Slot
+     * @return Bytes, 0 if the slot is empty
+     */
+    size_t getFaceSize(int faceId) const;
+
+    /**
+     * @brief Get a hash over every loaded face file
+     * @return FNV-1a hash, FNV1A_SEED if nothing is loaded
+     *
+     * Mixed into the catalog hash so cached layouts and thumbnails are
+     * rebuilt when a face file changes.
+     */
+    uint32_t getHash() const;
+
+    /**
+     * @brief Take the glyph cache for the calling task
+     */
+    void lock();
+
+    /**
+     * @brief Release the glyph cache
+     */
+    void unlock();
+
+    /**
+     * @brief Look up a glyph, rasterizing it on a cache miss
+     * @param faceId Slot
+     * @param pixelsPerEm Size of the em square in pixels
+     * @param codepoint Unicode codepoint
+     * @return Bitmap valid until unlock(), nullptr if the face has no such glyph
+     *
+     * Call between lock() and unlock().
+     */
+    const GlyphBitmap *getGlyph(int faceId, int pixelsPerEm, uint32_t codepoint);
+
+    /**
+     * @brief Drop every cached glyph, e.g. to time cold renders
+     */
+    void clearCache();
+
+    /**
+     * @brief Get the glyph cache counters
+     * @return Hits, misses, evictions and fill
+     */
+    GlyphCache::Stats getCacheStats();
+
+    /**
+     * @brief Get the rasterizer time since resetTiming()
+     * @param glyphs Output, glyphs rasterized
+     * @return Total microseconds spent rasterizing
+     */
+    uint32_t getRasterizeMicros(uint32_t &glyphs) const;
+
+    /**
+     * @brief Reset the rasterizer time and the cache counters
+     */
+    void resetTiming();
+};
+
+/**
+ * @class ScalableFont
+ * @brief One face at one pixel size, usable wherever LovyanGFX takes a font
+ *
+ * Anti-aliased edges are blended toward the text background color; text
+ * drawn without a background (fore equals back) blends toward black, the
+ * background everything here is drawn on. On palette sprites coverage is
+ * thresholded and the text color written as is.
+ */
+class ScalableFont : public lgfx::IFont
+{
+private:
+    uint8_t faceId;
+    uint16_t pixelSize;
+
+public:
+    /**
+     * @brief Constructor
+     * @param face Slot in scalableFonts
+     * @param pixelsPerEm Size of the em square in pixels
+     */
+    constexpr ScalableFont(uint8_t face, uint16_t pixelsPerEm) : faceId(face),
+                                                                 pixelSize(pixelsPerEm)
+    {
+    }
+
+    font_type_t getType() const override
+    {
+        return ft_unknown;
+    }
+
+    void getDefaultMetric(lgfx::FontMetrics *metrics) const override;
+    bool updateFontMetric(lgfx::FontMetrics *metrics, uint16_t uniCode) const override;
+    size_t drawChar(lgfx::LGFXBase *gfx, int32_t x, int32_t y, uint16_t c, const lgfx::TextStyle *style,
+                    lgfx::FontMetrics *metrics, int32_t &filled_x) const override;
+};
+
+// Global instance declaration
+extern ScalableFontLibrary scalableFonts;
@@ -0,0 +1,334 @@
+/**
+ * @file serialcommands.cpp
+ * @brief Line-based command protocol on the USB serial port
+ * @date 2026-10-19
+ */
+
+#include "serialcommands.hpp"
+#include "memorytracker.hpp"
+#include "rle565.hpp"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static const size_t MAX_FIT_RESULTS = 128; // Matches listed by FIT; the count covers all
+
+void CommandStream::print(const char *text)
+{
+    write(reinterpret_cast<const uint8_t *>(text), strlen(text));
+}
+
+// Ends the line as Arduino's Print::println() does; printf() replies end in "\n" alone
+void CommandStream::println(const char *text)
+{
+    print(text);
+    print("\r\n");
+}
+
+void CommandStream::printf(const char *format, ...)
+{
+    // Room for a reply that repeats a whole command line, as INFO does with TEXT
+    char line[CommandParser::MAX_LINE + 64];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (length > 0)
+    {
+        write(reinterpret_cast<const uint8_t *>(line), (size_t)length < sizeof(line) ? length : sizeof(line) - 1);
+    }
+}
+
+SerialCommands::SerialCommands() : stream(nullptr),
+                                   screen(nullptr),
+                                   customText()
+{
+}
+
+void SerialCommands::begin(CommandStream &commandStream, DeviceInterface &frameDevice)
+{
+    stream = &commandStream;
+    screen = &frameDevice;
+}
+
+void SerialCommands::poll()
+{
+    if (stream == nullptr)
+    {
+        return;
+    }
+
+    while (stream->available() > 0)
+    {
+        if (parser.feed((char)stream->read()))
+        {
+            handleLine();
+        }
+    }
+}
+
+void SerialCommands::handleLine()
+{
+    const char *command = parser.getCommand();
+    long value = 0;
+
+    if (parser.wasOverflowed())
+    {
+        stream->println("ERR line too long");
+    }
+    else if (*command == 0)
+    {
+        // Blank line, nothing to do
+    }
+    else if (strcmp(command, "HELP") == 0)
+    {
+        stream->println("HELP | LIST | INFO | FONT <id> | TEXT <text> | RENDER | SHOT | MEM");
+        stream->println("FIT <w> <h> <min x-height> <ANY|MONO|PROP> <text>");
+        stream->println("REC | STOP | LOG | REPLAY | PUSH [n] | TTF | TTF BENCH <px> | EDIT | KEYS | FAN [RESET]");
+        stream->println("OK");
+    }
+    else if (strcmp(command, "LIST") == 0)
+    {
+        sendFontList();
+    }
+    else if (strcmp(command, "INFO") == 0)
+    {
+        sendInfo();
+    }
+    else if (strcmp(command, "FONT") == 0)
+    {
+        if (!parser.getIntArgument(value) || value >= fontManager.getTotalFonts())
+        {
+            stream->println("ERR font id");
+            return;
+        }
+        fontManager.selectFont(value);
+        stream->printf("OK %ld %s\n", value, fontManager.getFontAt(value)->name);
+    }
+    else if (strcmp(command, "TEXT") == 0)
+    {
+        strncpy(customText, parser.getArgument(), sizeof(customText) - 1);
+        customText[sizeof(customText) - 1] = 0;
+        fontManager.setSampleText(customText);
+        stream->println("OK");
+    }
+    else if (strcmp(command, "RENDER") == 0)
+    {
+        fontManager.render();
+        stream->printf("OK %lu us\n", fontManager.getLastFrameTime());
+    }
+    else if (strcmp(command, "SHOT") == 0)
+    {
+        sendScreenshot();
+    }
+    else if (strcmp(command, "PUSH") == 0)
+    {
+        sendPushTiming();
+    }
+    else if (strcmp(command, "MEM") == 0)
+    {
+        sendMemoryReport();
+        stream->println("OK");
+    }
+    else if (strcmp(command, "FIT") == 0)
+    {
+        sendFittingFonts();
+    }
+    else if (strcmp(command, "REC") == 0)
+    {
+        startRecording();
+    }
+    else if (strcmp(command, "STOP") == 0)
+    {
+        sendRecordingStop();
+    }
+    else if (strcmp(command, "LOG") == 0)
+    {
+        sendInputLog();
+    }
+    else if (strcmp(command, "REPLAY") == 0)
+    {
+        sendReplayLatency();
+    }
+    else if (strcmp(command, "TTF") == 0)
+    {
+        if (strncasecmp(parser.getArgument(), "BENCH", 5) == 0)
+        {
+            sendTrueTypeBenchmark();
+        }
+        else
+        {
+            sendTrueTypeInfo();
+        }
+    }
+    else if (strcmp(command, "EDIT") == 0)
+    {
+        openEditor();
+    }
+    else if (strcmp(command, "KEYS") == 0)
+    {
+        sendEditTiming();
+    }
+    else if (strcmp(command, "FAN") == 0)
+    {
+        if (strncasecmp(parser.getArgument(), "RESET", 5) == 0)
+        {
+            resetFanout();
+        }
+        else
+        {
+            sendFanoutTiming();
+        }
+    }
+    else
+    {
+        stream->printf("ERR unknown command %s\n", command);
+    }
+}
+
+void SerialCommands::sendFontList()
+{
+    int total = fontManager.getTotalFonts();
+    for (int i = 0; i < total; i++)
+    {
+        const FontInfo *font = fontManager.getFontAt(i);
+        stream->printf("FONT %d %d %s|%s\n", i, font->size, font->family, font->name);
+    }
+    stream->printf("OK %d\n", total);
+}
+
+void SerialCommands::sendInfo()
+{
+    const FontInfo *font = fontManager.getFontAt(fontManager.getCurrentCatalogIndex());
+    stream->printf("INFO %d %s\n", fontManager.getCurrentCatalogIndex(), font != nullptr ? font->name : "");
+    stream->printf("TEXT %s\n", fontManager.getSampleText());
+    stream->println("OK");
+}
+
+/**
+ * Reply format:
+ *   per matching font, tallest first: "FIT <id> <height> <x-height> <name>"
+ *   then "OK <matches> <candidates> <exact width checks>"
+ */
+void SerialCommands::sendFittingFonts()
+{
+    const char *p = parser.getArgument();
+    char *next = nullptr;
+    long values[3];
+    for (long &value : values)
+    {
+        value = strtol(p, &next, 10);
+        if (next == p || *next != ' ')
+        {
+            stream->println("ERR usage: FIT <w> <h> <min x-height> <ANY|MONO|PROP> <text>");
+            return;
+        }
+        p = next + 1;
+    }
+
+    FontQuery query;
+    query.maxWidth = values[0];
+    query.maxHeight = values[1];
+    query.minXHeight = values[2];
+    if (strncasecmp(p, "ANY ", 4) == 0)
+    {
+        query.spacing = FontQuery::SPACING_ANY;
+    }
+    else if (strncasecmp(p, "MONO ", 5) == 0)
+    {
+        query.spacing = FontQuery::SPACING_MONOSPACE;
+    }
+    else if (strncasecmp(p, "PROP ", 5) == 0)
+    {
+        query.spacing = FontQuery::SPACING_PROPORTIONAL;
+    }
+    else
+    {
+        stream->println("ERR spacing must be ANY, MONO or PROP");
+        return;
+    }
+    query.text = strchr(p, ' ') + 1;
+
+    FontMetricsIndex &index = fontManager.getMetricsIndex();
+    uint16_t results[MAX_FIT_RESULTS];
+    FontQueryStats stats;
+    size_t matches = index.query(query, results, MAX_FIT_RESULTS, &stats);
+
+    for (size_t i = 0; i < matches && i < MAX_FIT_RESULTS; i++)
+    {
+        const FontMetricsEntry *entry = index.getEntry(results[i]);
+        stream->printf("FIT %u %d %d %s\n", results[i], entry->vertical.height, entry->vertical.xHeight,
+                       fontManager.getFontAt(results[i])->name);
+    }
+    stream->printf("OK %u %u %u\n", (unsigned)matches, (unsigned)stats.candidates, (unsigned)stats.exactChecks);
+}
+
+/**
+ * Reply format:
+ *   one table row per MemoryTag: live and peak bytes in SRAM and PSRAM, allocation count
+ *   then the heap lines of sendHeapReport()
+ */
+void SerialCommands::sendMemoryReport()
+{
+    if (stream == nullptr)
+    {
+        return;
+    }
+
+    char table[768];
+    memoryTracker.format(table, sizeof(table));
+    stream->print(table);
+    sendHeapReport();
+}
+
+/**
+ * Reply format:
+ *   "SHOT <width> <height>\n"
+ *   then per row: 2-byte little-endian length, followed by that many bytes
+ *   of rle565 data (pixels RGB565, most significant byte first)
+ *   then "OK <total encoded bytes>\n"
+ */
+void SerialCommands::sendScreenshot()
+{
+    const int width = screen->getDisplayWidth();
+    const int height = screen->getDisplayHeight();
+    if (width > 320)
+    {
+        stream->println("ERR frame too wide");
+        return;
+    }
+
+    uint16_t pixels[320];
+    uint8_t encoded[rle565MaxEncodedSize(320)];
+    unsigned long total = 0;
+
+    // One consistent frame: a fan-out task may otherwise draw the next one mid-screenshot
+    screen->beginFrameRead();
+    if (!screen->readFrameRow(0, pixels))
+    {
+        screen->endFrameRead();
+        stream->println("ERR no frame to read");
+        return;
+    }
+    stream->printf("SHOT %d %d\n", width, height);
+    for (int y = 0; y < height; y++)
+    {
+        if (y > 0)
+        {
+            screen->readFrameRow(y, pixels);
+        }
+        size_t length = rle565Encode(pixels, width, encoded, sizeof(encoded));
+
+        uint8_t header[2] = {(uint8_t)(length & 0xFF), (uint8_t)(length >> 8)};
+        stream->write(header, sizeof(header));
+        stream->write(encoded, length);
+        total += length;
+    }
+    screen->endFrameRead();
+    stream->printf("OK %lu\n", total);
+}
+
+// Global instance for easy access
+SerialCommands serialCommands;
@@ -0,0 +1,137 @@
+/**
+ * @file serialcommands.hpp
+ * @brief Line-based command protocol on the USB serial port
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies: the port is a CommandStream, and
+ * SHOT reads the frame through DeviceInterface. Commands that need the
+ * hardware (REC to REPLAY, PUSH, TTF, EDIT, KEYS, FAN and MEM's heap lines)
+ * are in devicecommands.cpp; a host build supplies its own.
+ *
+ * Commands (one per line, case-insensitive command word):
+ *   HELP          List commands
+ *   LIST          One "FONT <id> <size> <family>|<name>" line per catalog font
+ *   INFO          Current font id, name and sample text
+ *   FONT <id>     Select a font by catalog id (the dial continues from there)
+ *   TEXT <text>   Set the sample text (UTF-8, to end of line)
+ *   RENDER        Finish any transition and redraw now, replies with render time
+ *   SHOT          Stream the frame on screen, see SerialCommands::sendScreenshot()
+ *   PUSH [n]      Average time of n (default 20) full-frame pushes, frame sprite vs RGB565
+ *   MEM           Heap use per subsystem and SRAM/PSRAM free and low-water marks
+ *   FIT <w> <h> <min x-height> <ANY|MONO|PROP> <text>
+ *                 Fonts that fit text on one line in a w x h box, tallest first
+ *   REC           Start recording dial and button input (replaces the previous log)
+ *   STOP          Stop recording, replies with input count and log size
+ *   LOG           Dump the recorded input log as hex, see InputLog
+ *   REPLAY        Replay the log on a virtual clock, replies with input-to-frame latency
+ *   TTF           Loaded TrueType faces and glyph cache counters
+ *   TTF BENCH <px> Time the sample text in the TrueType face at px, uncached and
+ *                 cached, against the current catalog font
+ *   EDIT          Open the sample text editor on the current font (as a screen tap does)
+ *   KEYS          Editor keystroke timing: line breaking and redraw percentiles
+ *   FAN           Per-target frame counts and replay time percentiles of the fan-out display
+ *   FAN RESET     Clear the fan-out counters
+ * Every command ends with a line starting "OK" or "ERR".
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "commandparser.hpp"
+#include "fontmanager.hpp"
+
+/**
+ * @interface CommandStream
+ * @brief Byte stream commands arrive on and replies go out on
+ *
+ * The USB serial port on the device, a pseudo-terminal on a host.
+ */
+class CommandStream
+{
+public:
+    virtual ~CommandStream() = default;
+
+    /**
+     * @brief Get the number of bytes that can be read without waiting
+     * @return Bytes available
+     */
+    virtual int available() = 0;
+
+    /**
+     * @brief Read one byte
+     * @return The byte, or -1 if none is available
+     */
+    virtual int read() = 0;
+
+    /**
+     * @brief Write bytes
+     * @param data Bytes to write
+     * @param size Number of bytes
+     * @return Bytes written
+     */
+    virtual size_t write(const uint8_t *data, size_t size) = 0;
+
+    void print(const char *text);
+    void println(const char *text);
+    void printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+/**
+ * @class SerialCommands
+ * @brief Reads commands from a stream and drives the font manager and device
+ */
+class SerialCommands
+{
+private:
+    CommandStream *stream;
+    DeviceInterface *screen; // Read by SHOT
+    CommandParser parser;
+    char customText[CommandParser::MAX_LINE + 1]; // Sample text set by TEXT
+
+    void handleLine();
+    void sendFontList();
+    void sendInfo();
+    void sendScreenshot();
+    void sendFittingFonts();
+
+    // In devicecommands.cpp
+    void startRecording();
+    void sendRecordingStop();
+    void sendInputLog();
+    void sendReplayLatency();
+    void sendPushTiming();
+    void sendTrueTypeInfo();
+    void sendTrueTypeBenchmark();
+    void openEditor();
+    void sendEditTiming();
+    void sendFanoutTiming();
+    void resetFanout();
+    void sendHeapReport();
+
+public:
+    /**
+     * @brief Constructor
+     */
+    SerialCommands();
+
+    /**
+     * @brief Start reading commands
+     * @param commandStream Stream to read commands from and reply to
+     * @param frameDevice Device whose frame SHOT sends
+     */
+    void begin(CommandStream &commandStream, DeviceInterface &frameDevice);
+
+    /**
+     * @brief Handle any complete commands received since the last call
+     */
+    void poll();
+
+    /**
+     * @brief Write the MEM report (without the trailing "OK") to the stream
+     */
+    void sendMemoryReport();
+};
+
+// Global instance declaration
+extern SerialCommands serialCommands;
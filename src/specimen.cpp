@@ -0,0 +1,215 @@
+/**
+ * @file specimen.cpp
+ * @brief The font specimen and font page frames, laid out once for every device
+ * @date 2026-10-19
+ */
+
+#include "specimen.hpp"
+#include <math.h>
+#include <stdio.h>
+#include "layoutstore.hpp"
+
+static const size_t LABEL_BUFFER_SIZE = 64; // One info line; longer names are truncated
+
+// RGB565 values of the LovyanGFX color names
+static const uint16_t BLACK_565 = 0x0000;
+static const uint16_t WHITE_565 = 0xFFFF;
+static const uint16_t GREEN_565 = 0x07E0;
+static const uint16_t CYAN_565 = 0x07FF;
+static const uint16_t YELLOW_565 = 0xFFE0;
+static const uint16_t DARKGREY_565 = 0x7BEF;
+
+const SpecimenStyle DIAL_STYLE = {BLACK_565, GREEN_565, WHITE_565, CYAN_565, YELLOW_565, DARKGREY_565, true};
+const SpecimenStyle PAPER_STYLE = {WHITE_565, BLACK_565, BLACK_565, DARKGREY_565, DARKGREY_565, DARKGREY_565, false};
+
+SpecimenRenderer::SpecimenRenderer() : fontHeightCache(),
+                                       fontHeightCacheNext(0),
+                                       glyphWidths(measureGlyphAdvance)
+{
+}
+
+int SpecimenRenderer::getFontHeight(const void *fontPtr)
+{
+    for (int i = 0; i < FONT_HEIGHT_CACHE_SIZE; i++)
+    {
+        if (fontHeightCache[i].fontPtr == fontPtr)
+        {
+            return fontHeightCache[i].height;
+        }
+    }
+
+    int height = measureFontHeight(fontPtr);
+
+    fontHeightCache[fontHeightCacheNext].fontPtr = fontPtr;
+    fontHeightCache[fontHeightCacheNext].height = height;
+    fontHeightCacheNext = (fontHeightCacheNext + 1) % FONT_HEIGHT_CACHE_SIZE;
+    return height;
+}
+
+void SpecimenRenderer::warm(const void *fontPtr, const char *text, int frameWidth)
+{
+    if (fontPtr == nullptr || text == nullptr)
+    {
+        return;
+    }
+
+    getFontHeight(fontPtr);
+    wrapLayout.setText(text);
+    wrapLayout.layout(glyphWidths.forFont(fontPtr), frameWidth - WRAP_MARGIN);
+}
+
+void SpecimenRenderer::addWrappedText(DisplayList &list, const void *fontPtr, const char *text, int centerX,
+                                      int centerY, uint16_t color)
+{
+    const int maxWidth = list.getWidth() - WRAP_MARGIN;
+
+    // Sample texts normally come pre-laid-out from the layout store; anything
+    // else is decoded only when the text changes and measured only when the font does
+    wrapLayout.setText(text);
+    size_t storedLines = 0;
+    const LayoutLine *stored = layoutStore.find(fontPtr, text, maxWidth, storedLines);
+    if (stored != nullptr)
+    {
+        wrapLayout.assignLines(fontPtr, maxWidth, stored, storedLines);
+    }
+    wrapLayout.layout(glyphWidths.forFont(fontPtr), maxWidth);
+
+    if (wrapLayout.getLineCount() == 1)
+    {
+        // Fits on one line
+        list.text(fontPtr, text, centerX, centerY, DATUM_MIDDLE_CENTER, color);
+        return;
+    }
+
+    // Calculate line height and draw centered
+    int lineHeight = getFontHeight(fontPtr);
+    int startY = centerY - (lineHeight * (int)wrapLayout.getLineCount()) / 2;
+
+    char line[TextLayout::MAX_LINE_BYTES];
+    for (size_t i = 0; i < wrapLayout.getLineCount(); i++)
+    {
+        size_t length = wrapLayout.copyLine(i, line, sizeof(line));
+        list.text(fontPtr, line, length, centerX, startY + i * lineHeight, DATUM_MIDDLE_CENTER, color);
+    }
+}
+
+void SpecimenRenderer::renderSpecimen(DisplayList &list, const SpecimenStyle &style, const char *familyName,
+                                      const char *fontName, int fontSize, const void *fontPtr,
+                                      const char *sampleText)
+{
+    const int centerX = list.getWidth() / 2;
+    list.fill(style.background);
+
+    // Labels are formatted on the stack and centered by hand so redraws never touch the heap
+    const void *labelFont = specimenLabelFont;
+    GlyphWidthTable &labelWidths = glyphWidths.forFont(labelFont);
+    char label[LABEL_BUFFER_SIZE];
+    snprintf(label, sizeof(label), "Size: %d", fontSize);
+    list.text(labelFont, label, centerX - labelWidths.getTextWidth(label) / 2, 12, DATUM_TOP_LEFT, style.label);
+    snprintf(label, sizeof(label), "Family: %s", familyName);
+    list.text(labelFont, label, centerX - labelWidths.getTextWidth(label) / 2, 28, DATUM_TOP_LEFT, style.label);
+    snprintf(label, sizeof(label), "Font: %s", fontName);
+    list.text(labelFont, label, centerX - labelWidths.getTextWidth(label) / 2, 44, DATUM_TOP_LEFT, style.label);
+
+    addWrappedText(list, fontPtr != nullptr ? fontPtr : labelFont, sampleText, centerX, list.getHeight() / 2,
+                   style.sample);
+}
+
+void SpecimenRenderer::addFontMetrics(DisplayList &list, const SpecimenStyle &style, const void *fontPtr,
+                                      const char *sampleText, int yPosition)
+{
+    if (fontPtr == nullptr)
+    {
+        return;
+    }
+
+    // Calculate font metrics from the font height and glyph advances
+    GlyphWidthTable &widths = glyphWidths.forFont(fontPtr);
+    int fontHeight = getFontHeight(fontPtr);
+    int textWidth = widths.getTextWidth(sampleText);
+    int charWidth = widths.getAdvance('A'); // Standard character width
+
+    // Estimate baseline from font height (typical ratio is about 80% above baseline)
+    int baseline = fontHeight * 0.2; // Approximate descender height
+    int ascender = fontHeight - baseline;
+    int descender = baseline;
+
+    // Single line with all metrics - no wrapping, fits on one line
+    char allMetrics[LABEL_BUFFER_SIZE];
+    snprintf(allMetrics, sizeof(allMetrics), "H:%d B:%d C:%d A:%d D:%d TW:%d", fontHeight, baseline, charWidth,
+             ascender, descender, textWidth);
+    list.text(specimenLabelFont, allMetrics, list.getWidth() / 2, yPosition, DATUM_MIDDLE_CENTER, style.metrics);
+}
+
+void SpecimenRenderer::renderFont(DisplayList &list, const SpecimenStyle &style, const char *familyName,
+                                  const char *fontName, int fontSize, const void *fontPtr,
+                                  const char *sampleText)
+{
+    const int centerX = list.getWidth() / 2;
+    const int height = list.getHeight();
+
+    renderSpecimen(list, style, familyName, fontName, fontSize, fontPtr, sampleText);
+    addFontMetrics(list, style, fontPtr, sampleText, height - 70);
+
+    const void *helpFont = specimenSmallFont;
+    list.text(helpFont, "H=height B=baseline C=char", centerX, height - 58, DATUM_MIDDLE_CENTER, style.help);
+    list.text(helpFont, "A=asc D=desc TW=width", centerX, height - 48, DATUM_MIDDLE_CENTER, style.help);
+
+    // Navigation info at the bottom
+    list.text(helpFont, "Rotate dial: change font", centerX, height - 35, DATUM_BOTTOM_CENTER, style.help);
+    list.text(helpFont, "Press button: change text", centerX, height - 25, DATUM_BOTTOM_CENTER, style.help);
+}
+
+void SpecimenRenderer::renderFontPage(DisplayList &list, const SpecimenStyle &style, const FontInfo *fonts,
+                                      int count, int slots, const char *sampleText, int pageIndex, int pageCount)
+{
+    const int width = list.getWidth();
+    const int height = list.getHeight();
+    const int centerX = width / 2;
+    const int radius = width / 2;
+    const int top = 24;
+    const int bottom = height - 20;
+    const int rowHeight = (bottom - top) / (slots > 0 ? slots : 1);
+    const int labelHeight = 9;
+    const void *labelFont = specimenSmallFont;
+
+    // Single batched clear for the whole page
+    list.fill(style.background);
+
+    char header[24];
+    snprintf(header, sizeof(header), "Page %d/%d", pageIndex + 1, pageCount);
+    list.text(labelFont, header, centerX, 8, DATUM_TOP_CENTER, style.help);
+
+    for (int i = 0; i < count && i < FontDisplayManager::MAX_FONTS_PER_PAGE; i++)
+    {
+        int rowTop = top + i * rowHeight;
+        int rowLeft = 6;
+        int rowWidth = width - 12;
+        if (style.round)
+        {
+            // Inset each row to stay inside the circle at its far edge
+            int farY = (rowTop + rowHeight / 2 < radius) ? rowTop : rowTop + rowHeight;
+            int dy = farY - radius;
+            int halfWidth = (int)sqrtf((float)(radius * radius - dy * dy)) - 6;
+            if (halfWidth < 20)
+            {
+                halfWidth = 20;
+            }
+            rowLeft = centerX - halfWidth;
+            rowWidth = halfWidth * 2;
+        }
+        int cellTop = rowTop + labelHeight;
+        int cellHeight = rowHeight - labelHeight;
+
+        list.hline(rowLeft, rowTop, rowWidth, style.rule);
+        list.text(labelFont, fonts[i].name, rowLeft, rowTop + 1, DATUM_TOP_LEFT, style.label);
+
+        // Fonts taller than the cell are top-aligned so their x-height stays visible
+        const void *fontPtr = fonts[i].fontPtr != nullptr ? fonts[i].fontPtr : specimenLabelFont;
+        int fontHeight = getFontHeight(fontPtr);
+        int textY = (fontHeight <= cellHeight) ? cellTop + cellHeight / 2 : cellTop + fontHeight / 2;
+        list.clip(rowLeft, cellTop, rowWidth, cellHeight);
+        list.text(fontPtr, sampleText, rowLeft, textY, DATUM_MIDDLE_LEFT, style.sample);
+        list.unclip();
+    }
+}
@@ -0,0 +1,145 @@
+/**
+ * @file specimen.hpp
+ * @brief The font specimen and font page frames, laid out once for every device
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. Text is measured through the
+ * catalog's measuring functions (see fontmanager.hpp), so the frames are
+ * built the same way on the device and in the host tests; LgfxDisplayTarget
+ * (lgfxtarget.hpp) draws them on a panel.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "displaylist.hpp"
+#include "fontmanager.hpp"
+#include "textlayout.hpp"
+
+// Colors (RGB565) and shape of the specimen frames on one kind of panel
+struct SpecimenStyle
+{
+    uint16_t background;
+    uint16_t label;   // Size, family and font lines; font names on a page
+    uint16_t sample;  // Sample text
+    uint16_t metrics; // Metrics line
+    uint16_t help;    // Legend, instructions and page header
+    uint16_t rule;    // Separators between page rows
+    bool round;       // Page rows are inset to stay inside a round panel
+};
+
+// Light text on black, for the round M5Dial LCD
+extern const SpecimenStyle DIAL_STYLE;
+
+// Black on white, for rectangular e-paper
+extern const SpecimenStyle PAPER_STYLE;
+
+// Fonts of the labels around the specimens: lgfx Font0 and Font2, defined in lgfxfonts.cpp
+extern const void *const specimenSmallFont; // Legend, instructions, page header and row labels
+extern const void *const specimenLabelFont; // Size, family and font lines, metrics; fallback sample font
+
+/**
+ * @class SpecimenRenderer
+ * @brief Builds the specimen frames every device shows as DisplayLists
+ *
+ * Labels are measured, sample texts wrapped (from the layout store when it
+ * has them) and page rows fitted here, from cached glyph advances and font
+ * heights, so a device only has to replay the list. Each instance keeps its
+ * own layout state; use one per task.
+ */
+class SpecimenRenderer
+{
+public:
+    static const int WRAP_MARGIN = 20; // Sample text wraps at the frame width less this
+
+private:
+    // Small round-robin cache of font heights for the fonts on recent pages
+    struct FontHeightEntry
+    {
+        const void *fontPtr;
+        int height;
+    };
+    static const int FONT_HEIGHT_CACHE_SIZE = 24;
+
+    FontHeightEntry fontHeightCache[FONT_HEIGHT_CACHE_SIZE];
+    int fontHeightCacheNext;
+    GlyphWidthCache glyphWidths; // Per-font advance tables used for line breaking and label widths
+    TextLayout wrapLayout;       // Decoded and broken lines of the last wrapped text
+
+    void addFontMetrics(DisplayList &list, const SpecimenStyle &style, const void *fontPtr,
+                        const char *sampleText, int yPosition);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    SpecimenRenderer();
+
+    /**
+     * @brief Get the line height of a font, cached for the fonts of recent pages
+     * @param fontPtr Font
+     * @return Height in pixels
+     */
+    int getFontHeight(const void *fontPtr);
+
+    /**
+     * @brief Lay a text out ahead of time so the first frame with it is quick
+     * @param fontPtr Font the text will be shown in
+     * @param text Text
+     * @param frameWidth Width of the frames it will be shown in
+     */
+    void warm(const void *fontPtr, const char *text, int frameWidth);
+
+    /**
+     * @brief Add a text wrapped to the frame width, its lines centered on a point
+     * @param list Frame being built
+     * @param fontPtr Font
+     * @param text UTF-8 text
+     * @param centerX Center of the lines
+     * @param centerY Center of the block of lines
+     * @param color RGB565 color
+     */
+    void addWrappedText(DisplayList &list, const void *fontPtr, const char *text, int centerX, int centerY,
+                        uint16_t color);
+
+    /**
+     * @brief Build the part of a font frame thumbnails show: size, family and font name over the sample text
+     * @param list Frame, already reset() to the panel size
+     * @param style Panel colors
+     * @param familyName Font family name
+     * @param fontName Font name
+     * @param fontSize Size shown in the header
+     * @param fontPtr Font, nullptr for the fallback
+     * @param sampleText Sample text
+     */
+    void renderSpecimen(DisplayList &list, const SpecimenStyle &style, const char *familyName, const char *fontName,
+                        int fontSize, const void *fontPtr, const char *sampleText);
+
+    /**
+     * @brief Build a whole font frame: the specimen, its metrics, the legend and the instructions
+     * @param list Frame, already reset() to the panel size
+     * @param style Panel colors
+     * @param familyName Font family name
+     * @param fontName Font name
+     * @param fontSize Size shown in the header
+     * @param fontPtr Font, nullptr for the fallback
+     * @param sampleText Sample text
+     */
+    void renderFont(DisplayList &list, const SpecimenStyle &style, const char *familyName, const char *fontName,
+                    int fontSize, const void *fontPtr, const char *sampleText);
+
+    /**
+     * @brief Build a page of fonts, one labelled row each with the sample text clipped to it
+     * @param list Frame, already reset() to the panel size
+     * @param style Panel colors and shape
+     * @param fonts Fonts of the page
+     * @param count Number of fonts
+     * @param slots Rows the page is divided into
+     * @param sampleText Sample text
+     * @param pageIndex Page shown, from 0
+     * @param pageCount Number of pages
+     */
+    void renderFontPage(DisplayList &list, const SpecimenStyle &style, const FontInfo *fonts, int count,
+                        int slots, const char *sampleText, int pageIndex, int pageCount);
+};
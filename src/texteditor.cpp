@@ -0,0 +1,429 @@
+/**
+ * @file texteditor.cpp
+ * @brief Editable text with incremental line breaking and redraw damage
+ * @date 2026-10-19
+ */
+
+#include "texteditor.hpp"
+#include <algorithm>
+#include <string.h>
+
+TextEditor::TextEditor() : widths(nullptr),
+                           maxWidth(0),
+                           cursor(0),
+                           stats()
+{
+    lines.push_back({0, 0, 0});
+}
+
+size_t TextEditor::breakLine(size_t start, EditLine &line)
+{
+    // The rules of TextLayout::layout(), one line at a time
+    size_t end = glyphs.size();
+    size_t lastBreak = 0; // Glyph a line may start at, 0 if none yet
+    int width = 0;
+    int widthAtBreak = 0;
+    size_t i = start;
+
+    for (; i < glyphs.size(); i++)
+    {
+        uint32_t codepoint = glyphs[i].codepoint;
+        if (codepoint == '\n')
+        {
+            end = i + 1;
+            break;
+        }
+
+        // Break opportunities: after a space, and before or after an ideograph
+        if (i > start && !isNoLineStart(codepoint))
+        {
+            uint32_t previous = glyphs[i - 1].codepoint;
+            if ((previous == ' ' && codepoint != ' ') || isIdeographic(codepoint) || isIdeographic(previous))
+            {
+                lastBreak = i;
+                widthAtBreak = width;
+            }
+        }
+
+        int advance = glyphs[i].advance;
+        if (width + advance > maxWidth && i > start && codepoint != ' ')
+        {
+            // At the last opportunity, or mid-word if a single word is wider than the line
+            if (lastBreak > start)
+            {
+                end = lastBreak;
+                width = widthAtBreak;
+            }
+            else
+            {
+                end = i;
+            }
+            break;
+        }
+
+        width += advance;
+    }
+
+    // Positions are written only inside the line: glyphs past a break may belong to a reused line
+    int x = 0;
+    for (size_t j = start; j < end; j++)
+    {
+        glyphs[j].x = x;
+        x += glyphs[j].advance;
+    }
+
+    // Spaces at the end of a line are not drawn and do not count
+    size_t last = (i < glyphs.size() && glyphs[i].codepoint == '\n') ? i : end;
+    while (last > start && glyphs[last - 1].codepoint == ' ')
+    {
+        width -= glyphs[--last].advance;
+    }
+
+    line.firstGlyph = start;
+    line.glyphCount = end - start;
+    line.width = width;
+    return end;
+}
+
+void TextEditor::layoutAll()
+{
+    lines.clear();
+    size_t start = 0;
+    while (start < glyphs.size())
+    {
+        EditLine line;
+        start = breakLine(start, line);
+        lines.push_back(line);
+    }
+
+    // An empty text, or one ending in '\n', ends with an empty line for the caret
+    if (glyphs.empty() || glyphs.back().codepoint == '\n')
+    {
+        lines.push_back({(uint16_t)glyphs.size(), 0, 0});
+    }
+
+    damage.clear();
+    for (size_t i = 0; i < lines.size(); i++)
+    {
+        damage.push_back({(uint16_t)i, 0, (int16_t)maxWidth, lines[i].firstGlyph, lines[i].glyphCount});
+    }
+
+    stats.linesBroken = lines.size();
+    stats.linesReused = 0;
+    stats.damageCount = damage.size();
+    stats.rowsShifted = true;
+}
+
+void TextEditor::damageLine(size_t row, const EditLine *oldLine, const EditLine *newLine, size_t editIndex,
+                            bool inserted, const EditGlyph &removed)
+{
+    // The glyph that was at an old index, seen through the edit
+    auto oldGlyph = [&](size_t index) -> const EditGlyph &
+    {
+        if (index < editIndex)
+        {
+            return glyphs[index];
+        }
+        if (inserted)
+        {
+            return glyphs[index + 1];
+        }
+        return (index == editIndex) ? removed : glyphs[index - 1];
+    };
+
+    size_t oldCount = (oldLine != nullptr) ? oldLine->glyphCount : 0;
+    size_t newCount = (newLine != nullptr) ? newLine->glyphCount : 0;
+    size_t oldFirst = (oldLine != nullptr) ? oldLine->firstGlyph : 0;
+    size_t newFirst = (newLine != nullptr) ? newLine->firstGlyph : glyphs.size();
+
+    // Lines start at x = 0, so a shared prefix of characters is drawn identically
+    size_t same = 0;
+    int x = 0;
+    while (same < oldCount && same < newCount &&
+           oldGlyph(oldFirst + same).codepoint == glyphs[newFirst + same].codepoint)
+    {
+        x += glyphs[newFirst + same].advance;
+        same++;
+    }
+    if (same == oldCount && same == newCount)
+    {
+        return;
+    }
+
+    int oldEnd = x;
+    for (size_t i = same; i < oldCount; i++)
+    {
+        oldEnd += oldGlyph(oldFirst + i).advance;
+    }
+    int newEnd = x;
+    for (size_t i = same; i < newCount; i++)
+    {
+        newEnd += glyphs[newFirst + i].advance;
+    }
+
+    damage.push_back({(uint16_t)row, (int16_t)x, (int16_t)(std::max(oldEnd, newEnd) - x),
+                      (uint16_t)(newFirst + same), (uint16_t)(newCount - same)});
+}
+
+void TextEditor::relayout(size_t editIndex, bool inserted, const EditGlyph &removed)
+{
+    // Old line starts in new glyph indexes
+    auto mapOld = [&](size_t index)
+    {
+        if (inserted)
+        {
+            return (index >= editIndex) ? index + 1 : index;
+        }
+        return (index > editIndex) ? index - 1 : index;
+    };
+
+    // A line's breaks depend on glyphs up to the start of the line after next (a word carried
+    // over that then breaks mid-word), so an edit can move breaks up to two lines back
+    size_t editLine = std::upper_bound(lines.begin(), lines.end(), editIndex,
+                                       [](size_t index, const EditLine &line)
+                                       { return index < line.firstGlyph; }) -
+                      lines.begin() - 1;
+    size_t firstLine = (editLine > 2) ? editLine - 2 : 0;
+
+    freshLines.clear();
+    size_t start = lines[firstLine].firstGlyph; // Before the edit, so the same in both indexings
+    size_t reuse = lines.size();                // First old line kept; none once the text end is reached
+    size_t candidate = firstLine + 1;
+    while (true)
+    {
+        EditLine line;
+        start = breakLine(start, line);
+        freshLines.push_back(line);
+
+        if (start >= glyphs.size())
+        {
+            if (!glyphs.empty() && glyphs.back().codepoint == '\n')
+            {
+                freshLines.push_back({(uint16_t)glyphs.size(), 0, 0});
+            }
+            break;
+        }
+
+        // Past the edit, a line starting where an old one did breaks as it did
+        if (start > editIndex)
+        {
+            while (candidate < lines.size() && mapOld(lines[candidate].firstGlyph) < start)
+            {
+                candidate++;
+            }
+            if (candidate < lines.size() && mapOld(lines[candidate].firstGlyph) == start)
+            {
+                reuse = candidate;
+                break;
+            }
+        }
+    }
+
+    // Damage: the re-broken lines, and every later line too if they moved rows
+    size_t freshEnd = firstLine + freshLines.size();
+    bool shifted = freshEnd != reuse;
+    size_t newCount = freshEnd + (lines.size() - reuse);
+    size_t lastRow = shifted ? std::max(lines.size(), newCount) : freshEnd;
+    damage.clear();
+    for (size_t row = firstLine; row < lastRow; row++)
+    {
+        const EditLine *oldLine = (row < lines.size()) ? &lines[row] : nullptr;
+        EditLine moved;
+        const EditLine *newLine = nullptr;
+        if (row < freshEnd)
+        {
+            newLine = &freshLines[row - firstLine];
+        }
+        else if (row < newCount)
+        {
+            moved = lines[reuse + (row - freshEnd)];
+            moved.firstGlyph = mapOld(moved.firstGlyph);
+            newLine = &moved;
+        }
+        damageLine(row, oldLine, newLine, editIndex, inserted, removed);
+    }
+
+    // Splice the new lines in; lines after them only move by the edited glyph
+    for (size_t i = reuse; i < lines.size(); i++)
+    {
+        lines[i].firstGlyph = mapOld(lines[i].firstGlyph);
+    }
+    lines.erase(lines.begin() + firstLine, lines.begin() + reuse);
+    lines.insert(lines.begin() + firstLine, freshLines.begin(), freshLines.end());
+
+    stats.linesBroken = freshLines.size();
+    stats.linesReused = lines.size() - freshEnd;
+    stats.damageCount = damage.size();
+    stats.rowsShifted = shifted;
+}
+
+void TextEditor::setFont(GlyphWidthTable &widthTable, int lineWidth)
+{
+    widths = &widthTable;
+    maxWidth = lineWidth;
+    for (EditGlyph &glyph : glyphs)
+    {
+        glyph.advance = (glyph.codepoint == '\n') ? 0 : widths->getAdvance(glyph.codepoint);
+    }
+    layoutAll();
+}
+
+void TextEditor::setText(const char *text)
+{
+    SpanList spans;
+    decodeUtf8(text, spans);
+
+    glyphs.clear();
+    for (size_t i = 0; i < spans.size() && i < MAX_GLYPHS; i++)
+    {
+        uint32_t codepoint = spans[i].codepoint;
+        int advance = (codepoint == '\n' || widths == nullptr) ? 0 : widths->getAdvance(codepoint);
+        glyphs.push_back({codepoint, 0, (int16_t)advance});
+    }
+    cursor = glyphs.size();
+    layoutAll();
+}
+
+bool TextEditor::insert(uint32_t codepoint)
+{
+    if (widths == nullptr || glyphs.size() >= MAX_GLYPHS)
+    {
+        return false;
+    }
+
+    int advance = (codepoint == '\n') ? 0 : widths->getAdvance(codepoint);
+    glyphs.insert(glyphs.begin() + cursor, {codepoint, 0, (int16_t)advance});
+    relayout(cursor, true, glyphs[cursor]);
+    cursor++;
+    return true;
+}
+
+bool TextEditor::erase()
+{
+    if (widths == nullptr || cursor == 0)
+    {
+        return false;
+    }
+
+    cursor--;
+    EditGlyph removed = glyphs[cursor];
+    glyphs.erase(glyphs.begin() + cursor);
+    relayout(cursor, false, removed);
+    return true;
+}
+
+void TextEditor::setCursor(size_t index)
+{
+    cursor = std::min(index, glyphs.size());
+}
+
+size_t TextEditor::getCursor() const
+{
+    return cursor;
+}
+
+void TextEditor::getCaret(size_t &line, int &x) const
+{
+    line = std::upper_bound(lines.begin(), lines.end(), cursor,
+                            [](size_t index, const EditLine &entry)
+                            { return index < entry.firstGlyph; }) -
+           lines.begin() - 1;
+
+    const EditLine &entry = lines[line];
+    if (cursor < entry.firstGlyph + entry.glyphCount)
+    {
+        x = glyphs[cursor].x;
+    }
+    else if (entry.glyphCount > 0)
+    {
+        // At the end of the text, after the last character
+        const EditGlyph &last = glyphs[entry.firstGlyph + entry.glyphCount - 1];
+        x = last.x + last.advance;
+    }
+    else
+    {
+        x = 0;
+    }
+}
+
+size_t TextEditor::getGlyphCount() const
+{
+    return glyphs.size();
+}
+
+const EditGlyph &TextEditor::getGlyph(size_t index) const
+{
+    return glyphs[index];
+}
+
+size_t TextEditor::getLineCount() const
+{
+    return lines.size();
+}
+
+const EditLine &TextEditor::getLine(size_t index) const
+{
+    return lines[index];
+}
+
+const EditDamage *TextEditor::getDamage(size_t &count) const
+{
+    count = damage.size();
+    return damage.data();
+}
+
+const EditStats &TextEditor::getStats() const
+{
+    return stats;
+}
+
+size_t TextEditor::copyText(char *buffer, size_t size) const
+{
+    if (buffer == nullptr || size == 0)
+    {
+        return 0;
+    }
+
+    size_t length = 0;
+    for (const EditGlyph &glyph : glyphs)
+    {
+        uint32_t c = glyph.codepoint;
+        uint8_t bytes[4];
+        size_t count;
+        if (c < 0x80)
+        {
+            bytes[0] = c;
+            count = 1;
+        }
+        else if (c < 0x800)
+        {
+            bytes[0] = 0xC0 | (c >> 6);
+            bytes[1] = 0x80 | (c & 0x3F);
+            count = 2;
+        }
+        else if (c < 0x10000)
+        {
+            bytes[0] = 0xE0 | (c >> 12);
+            bytes[1] = 0x80 | ((c >> 6) & 0x3F);
+            bytes[2] = 0x80 | (c & 0x3F);
+            count = 3;
+        }
+        else
+        {
+            bytes[0] = 0xF0 | (c >> 18);
+            bytes[1] = 0x80 | ((c >> 12) & 0x3F);
+            bytes[2] = 0x80 | ((c >> 6) & 0x3F);
+            bytes[3] = 0x80 | (c & 0x3F);
+            count = 4;
+        }
+
+        if (length + count >= size)
+        {
+            break;
+        }
+        memcpy(buffer + length, bytes, count);
+        length += count;
+    }
+    buffer[length] = 0;
+    return length;
+}
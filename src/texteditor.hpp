@@ -0,0 +1,190 @@
+/**
+ * @file texteditor.hpp
+ * @brief Editable text with incremental line breaking and redraw damage
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. Lines break by the same rules as
+ * TextLayout; advances come from a GlyphWidthTable, so the editor runs
+ * against lgfx fonts on the device or any measuring function on a host.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "memorytracker.hpp"
+#include "textlayout.hpp"
+
+// One character of the edited text and where it sits on its line
+struct EditGlyph
+{
+    uint32_t codepoint;
+    int16_t x;       // Pixels from the start of the line
+    int16_t advance; // 0 for '\n'
+};
+
+// One line as a glyph range; the last line may be empty to hold the caret
+struct EditLine
+{
+    uint16_t firstGlyph;
+    uint16_t glyphCount; // Including trailing spaces and the '\n' that ends it
+    int16_t width;       // Without trailing spaces, as TextLayout counts it
+};
+
+// Part of a line to clear and redraw after an edit
+struct EditDamage
+{
+    uint16_t line;
+    int16_t x;           // First pixel to clear
+    int16_t width;       // Pixels to clear, covering the old and the new content
+    uint16_t firstGlyph; // First glyph to draw from x on
+    uint16_t glyphCount; // Glyphs to draw, up to the end of the line
+};
+
+// Work done by the last edit, independent of the clock
+struct EditStats
+{
+    uint16_t linesBroken; // Lines laid out again
+    uint16_t linesReused; // Lines after the edit kept as they were
+    uint16_t damageCount; // Entries in getDamage()
+    bool rowsShifted;     // The line count changed, so later rows all moved
+};
+
+/**
+ * @class TextEditor
+ * @brief Text with a caret, re-broken from the edited line on each keystroke
+ *
+ * insert() and erase() break lines again from two lines before the edit (a
+ * shortened word may move up) until a line starts where an old line did;
+ * every line after that is reused. The damage list then names, per changed
+ * line, the pixels from the first glyph that differs, so a display redraws
+ * only the glyph cells that moved.
+ *
+ * Each line is scanned from its own start, so a word carried to the next
+ * line is measured there again; TextLayout's single pass can leave such a
+ * line wider than the limit, the editor breaks it.
+ */
+class TextEditor
+{
+public:
+    static const size_t MAX_GLYPHS = 512;
+
+private:
+    typedef std::vector<EditLine, TaggedAllocator<EditLine, MEM_TEXT_LAYOUT>> LineList;
+
+    std::vector<EditGlyph, TaggedAllocator<EditGlyph, MEM_TEXT_LAYOUT>> glyphs;
+    LineList lines;
+    LineList freshLines; // Lines being re-broken, reused between edits
+    std::vector<EditDamage, TaggedAllocator<EditDamage, MEM_TEXT_LAYOUT>> damage;
+    GlyphWidthTable *widths;
+    int maxWidth;
+    size_t cursor;
+    EditStats stats;
+
+    size_t breakLine(size_t start, EditLine &line);
+    void layoutAll();
+    void relayout(size_t editIndex, bool inserted, const EditGlyph &removed);
+    void damageLine(size_t row, const EditLine *oldLine, const EditLine *newLine, size_t editIndex, bool inserted,
+                    const EditGlyph &removed);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    TextEditor();
+
+    /**
+     * @brief Bind the editor to a font and width, laying the text out again
+     * @param widthTable Advances of the font to edit in, kept by reference
+     * @param lineWidth Maximum line width in pixels
+     */
+    void setFont(GlyphWidthTable &widthTable, int lineWidth);
+
+    /**
+     * @brief Replace the text and put the caret at its end
+     * @param text NUL-terminated UTF-8 text, cut at MAX_GLYPHS characters
+     *
+     * Every line is damaged.
+     */
+    void setText(const char *text);
+
+    /**
+     * @brief Insert a character before the caret and move the caret past it
+     * @param codepoint Unicode codepoint, '\n' for a line break
+     * @return false if the text is full or no font is set
+     */
+    bool insert(uint32_t codepoint);
+
+    /**
+     * @brief Delete the character before the caret
+     * @return false at the start of the text
+     */
+    bool erase();
+
+    /**
+     * @brief Move the caret
+     * @param index Glyph index the caret sits before (clamped to the text length)
+     */
+    void setCursor(size_t index);
+
+    /**
+     * @brief Get the caret position
+     * @return Index of the glyph the caret sits before
+     */
+    size_t getCursor() const;
+
+    /**
+     * @brief Get where the caret is drawn
+     * @param line Output, line index
+     * @param x Output, pixels from the start of the line
+     */
+    void getCaret(size_t &line, int &x) const;
+
+    /**
+     * @brief Get the number of characters
+     * @return Glyph count
+     */
+    size_t getGlyphCount() const;
+
+    /**
+     * @brief Get one character and its position
+     * @param index Glyph index
+     * @return Glyph
+     */
+    const EditGlyph &getGlyph(size_t index) const;
+
+    /**
+     * @brief Get the number of lines, at least 1
+     * @return Line count
+     */
+    size_t getLineCount() const;
+
+    /**
+     * @brief Get one line
+     * @param index Line index
+     * @return Glyph range and width
+     */
+    const EditLine &getLine(size_t index) const;
+
+    /**
+     * @brief Get the lines to redraw after the last edit
+     * @param count Output, number of entries
+     * @return Damage entries, in line order
+     */
+    const EditDamage *getDamage(size_t &count) const;
+
+    /**
+     * @brief Get the work done by the last edit
+     * @return Counters
+     */
+    const EditStats &getStats() const;
+
+    /**
+     * @brief Write the text as UTF-8
+     * @param buffer Destination buffer
+     * @param size Size of buffer in bytes
+     * @return Bytes written, excluding the terminator; characters that do not fit are left out
+     */
+    size_t copyText(char *buffer, size_t size) const;
+};
@@ -0,0 +1,425 @@
+/**
+ * @file textlayout.cpp
+ * @brief UTF-8 decoding, cached glyph advances and line breaking
+ * @date 2026-10-19
+ */
+
+#include "textlayout.hpp"
+#include <string.h>
+
+static const uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+// Decode the character at bytes, which is not the terminating NUL; returns its length in bytes
+static uint8_t decodeOne(const uint8_t *bytes, uint32_t &codepoint)
+{
+    uint8_t lead = bytes[0];
+    uint8_t expected = 0;
+    codepoint = REPLACEMENT_CHARACTER;
+
+    if (lead < 0x80)
+    {
+        codepoint = lead;
+    }
+    else if ((lead & 0xE0) == 0xC0)
+    {
+        codepoint = lead & 0x1F;
+        expected = 2;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        codepoint = lead & 0x0F;
+        expected = 3;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        codepoint = lead & 0x07;
+        expected = 4;
+    }
+
+    if (expected > 0)
+    {
+        uint8_t i = 1;
+        while (i < expected && (bytes[i] & 0xC0) == 0x80)
+        {
+            codepoint = (codepoint << 6) | (bytes[i] & 0x3F);
+            i++;
+        }
+
+        // Reject truncated, overlong and out-of-range sequences
+        static const uint32_t minimum[5] = {0, 0, 0x80, 0x800, 0x10000};
+        if (i == expected && codepoint >= minimum[expected] && codepoint <= 0x10FFFF &&
+            (codepoint < 0xD800 || codepoint > 0xDFFF))
+        {
+            return expected;
+        }
+        codepoint = REPLACEMENT_CHARACTER;
+    }
+    return 1;
+}
+
+size_t decodeUtf8(const char *text, SpanList &spans)
+{
+    spans.clear();
+    if (text == nullptr)
+    {
+        return 0;
+    }
+
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(text);
+    size_t offset = 0;
+    while (bytes[offset] != 0)
+    {
+        CodepointSpan span;
+        span.byteLength = decodeOne(bytes + offset, span.codepoint);
+        span.byteOffset = offset;
+        spans.push_back(span);
+        offset += span.byteLength;
+    }
+    return spans.size();
+}
+
+bool isIdeographic(uint32_t codepoint)
+{
+    return (codepoint >= 0x2E80 && codepoint <= 0x9FFF) ||   // CJK radicals, kana, ideographs
+           (codepoint >= 0xAC00 && codepoint <= 0xD7AF) ||   // Hangul syllables
+           (codepoint >= 0xF900 && codepoint <= 0xFAFF) ||   // CJK compatibility ideographs
+           (codepoint >= 0xFF00 && codepoint <= 0xFFEF) ||   // Fullwidth forms
+           (codepoint >= 0x20000 && codepoint <= 0x3FFFF);   // Supplementary ideographs
+}
+
+bool isNoLineStart(uint32_t codepoint)
+{
+    switch (codepoint)
+    {
+    case ')':
+    case ']':
+    case '}':
+    case ',':
+    case '.':
+    case '!':
+    case '?':
+    case ':':
+    case ';':
+    case 0x3001: // 、
+    case 0x3002: // 。
+    case 0x3009: // 〉
+    case 0x300B: // 》
+    case 0x300D: // 」
+    case 0x300F: // 』
+    case 0x3011: // 】
+    case 0x30FC: // ー
+    case 0xFF01: // ！
+    case 0xFF09: // ）
+    case 0xFF0C: // ，
+    case 0xFF0E: // ．
+    case 0xFF1A: // ：
+    case 0xFF1B: // ；
+    case 0xFF1F: // ？
+        return true;
+    default:
+        // Small kana may not start a line either
+        return (codepoint >= 0x3041 && codepoint <= 0x30FA &&
+                (codepoint == 0x3041 || codepoint == 0x3043 || codepoint == 0x3045 || codepoint == 0x3047 ||
+                 codepoint == 0x3049 || codepoint == 0x3063 || codepoint == 0x3083 || codepoint == 0x3085 ||
+                 codepoint == 0x3087 || codepoint == 0x30A1 || codepoint == 0x30A3 || codepoint == 0x30A5 ||
+                 codepoint == 0x30A7 || codepoint == 0x30A9 || codepoint == 0x30C3 || codepoint == 0x30E3 ||
+                 codepoint == 0x30E5 || codepoint == 0x30E7));
+    }
+}
+
+// GlyphWidthTable
+
+GlyphWidthTable::GlyphWidthTable() : pages(),
+                                     font(nullptr),
+                                     measure(nullptr),
+                                     pagesAllocated(0)
+{
+}
+
+GlyphWidthTable::~GlyphWidthTable()
+{
+    for (int i = 0; i < PAGE_COUNT; i++)
+    {
+        trackedFree(MEM_GLYPH_WIDTHS, pages[i], PAGE_SIZE);
+    }
+}
+
+void GlyphWidthTable::reset(const void *fontPtr, MeasureFunc measureFunc)
+{
+    // Pages are kept and cleared rather than freed: the next font mostly uses
+    // the same pages, so switching fonts does not touch the heap
+    for (int i = 0; i < PAGE_COUNT; i++)
+    {
+        if (pages[i] != nullptr)
+        {
+            memset(pages[i], UNKNOWN_ADVANCE, PAGE_SIZE);
+        }
+    }
+    font = fontPtr;
+    measure = measureFunc;
+}
+
+const void *GlyphWidthTable::getFont() const
+{
+    return font;
+}
+
+int GlyphWidthTable::getAdvance(uint32_t codepoint)
+{
+    if (measure == nullptr)
+    {
+        return 0;
+    }
+
+    // Outside the BMP there is nothing to cache for the bundled fonts
+    if (codepoint >= (uint32_t)PAGE_COUNT * PAGE_SIZE)
+    {
+        return measure(font, codepoint);
+    }
+
+    uint8_t *&page = pages[codepoint >> 8];
+    if (page == nullptr)
+    {
+        page = static_cast<uint8_t *>(trackedAlloc(MEM_GLYPH_WIDTHS, PAGE_SIZE));
+        memset(page, UNKNOWN_ADVANCE, PAGE_SIZE);
+        pagesAllocated++;
+    }
+
+    uint8_t cached = page[codepoint & 0xFF];
+    if (cached != UNKNOWN_ADVANCE)
+    {
+        return cached;
+    }
+
+    int advance = measure(font, codepoint);
+    if (advance >= 0 && advance < UNKNOWN_ADVANCE)
+    {
+        page[codepoint & 0xFF] = advance;
+    }
+    return advance;
+}
+
+int GlyphWidthTable::getTextWidth(const char *text)
+{
+    int width = 0;
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(text);
+    while (bytes != nullptr && *bytes != 0)
+    {
+        uint32_t codepoint;
+        bytes += decodeOne(bytes, codepoint);
+        width += getAdvance(codepoint);
+    }
+    return width;
+}
+
+size_t GlyphWidthTable::getPageCount() const
+{
+    return pagesAllocated;
+}
+
+// GlyphWidthCache
+
+GlyphWidthCache::GlyphWidthCache(GlyphWidthTable::MeasureFunc measureFunc) : lastUse(),
+                                                                             useCounter(0),
+                                                                             measure(measureFunc)
+{
+}
+
+GlyphWidthTable &GlyphWidthCache::forFont(const void *fontPtr)
+{
+    useCounter++;
+
+    int oldest = 0;
+    for (int i = 0; i < FONT_SLOTS; i++)
+    {
+        if (lastUse[i] != 0 && tables[i].getFont() == fontPtr)
+        {
+            lastUse[i] = useCounter;
+            return tables[i];
+        }
+        if (lastUse[i] < lastUse[oldest])
+        {
+            oldest = i;
+        }
+    }
+
+    tables[oldest].reset(fontPtr, measure);
+    lastUse[oldest] = useCounter;
+    return tables[oldest];
+}
+
+// TextLayout
+
+TextLayout::TextLayout() : layoutFont(nullptr),
+                           layoutWidth(0),
+                           layoutValid(false),
+                           spansValid(true)
+{
+}
+
+bool TextLayout::setText(const char *newText)
+{
+    if (newText == nullptr)
+    {
+        newText = "";
+    }
+    if (text == newText)
+    {
+        return false;
+    }
+
+    text = newText;
+    spansValid = false;
+    layoutValid = false;
+    return true;
+}
+
+void TextLayout::emitLine(size_t firstSpan, size_t endSpan, int width, GlyphWidthTable &widths)
+{
+    // Spaces at the end of a line are not drawn and do not count
+    while (endSpan > firstSpan && spans[endSpan - 1].codepoint == ' ')
+    {
+        width -= widths.getAdvance(' ');
+        endSpan--;
+    }
+
+    LayoutLine line;
+    line.byteStart = (firstSpan < spans.size()) ? spans[firstSpan].byteOffset : text.size();
+    line.byteLength = (endSpan > firstSpan)
+                          ? spans[endSpan - 1].byteOffset + spans[endSpan - 1].byteLength - line.byteStart
+                          : 0;
+    line.width = width;
+    lines.push_back(line);
+}
+
+void TextLayout::layout(GlyphWidthTable &widths, int maxWidth)
+{
+    if (layoutValid && layoutFont == widths.getFont() && layoutWidth == maxWidth)
+    {
+        return;
+    }
+
+    if (!spansValid)
+    {
+        decodeUtf8(text.c_str(), spans);
+        spansValid = true;
+    }
+
+    lines.clear();
+    layoutFont = widths.getFont();
+    layoutWidth = maxWidth;
+    layoutValid = true;
+
+    size_t lineStart = 0;
+    size_t lastBreak = 0; // Span index a line may start at, 0 if none yet
+    int width = 0;
+    int widthAtBreak = 0;
+
+    for (size_t i = 0; i < spans.size(); i++)
+    {
+        uint32_t codepoint = spans[i].codepoint;
+
+        if (codepoint == '\n')
+        {
+            emitLine(lineStart, i, width, widths);
+            lineStart = i + 1;
+            lastBreak = 0;
+            width = 0;
+            continue;
+        }
+
+        // Break opportunities: after a space, and before or after an ideograph
+        if (i > lineStart && !isNoLineStart(codepoint))
+        {
+            uint32_t previous = spans[i - 1].codepoint;
+            if ((previous == ' ' && codepoint != ' ') || isIdeographic(codepoint) || isIdeographic(previous))
+            {
+                lastBreak = i;
+                widthAtBreak = width;
+            }
+        }
+
+        int advance = widths.getAdvance(codepoint);
+        if (width + advance > maxWidth && i > lineStart && codepoint != ' ')
+        {
+            if (lastBreak > lineStart)
+            {
+                emitLine(lineStart, lastBreak, widthAtBreak, widths);
+                width -= widthAtBreak;
+                lineStart = lastBreak;
+            }
+            else
+            {
+                // A single word wider than the line: force a break here
+                emitLine(lineStart, i, width, widths);
+                width = 0;
+                lineStart = i;
+            }
+            lastBreak = 0;
+        }
+
+        width += advance;
+    }
+
+    if (lineStart < spans.size() || lines.empty())
+    {
+        emitLine(lineStart, spans.size(), width, widths);
+    }
+}
+
+size_t TextLayout::getLineCount() const
+{
+    return lines.size();
+}
+
+const LayoutLine &TextLayout::getLine(size_t index) const
+{
+    return lines[index];
+}
+
+void TextLayout::assignLines(const void *font, int maxWidth, const LayoutLine *precomputed, size_t count)
+{
+    lines.assign(precomputed, precomputed + count);
+    layoutFont = font;
+    layoutWidth = maxWidth;
+    layoutValid = true;
+}
+
+const SpanList &TextLayout::getSpans()
+{
+    if (!spansValid)
+    {
+        decodeUtf8(text.c_str(), spans);
+        spansValid = true;
+    }
+    return spans;
+}
+
+size_t TextLayout::copyLine(size_t index, char *buffer, size_t size) const
+{
+    if (buffer == nullptr || size == 0)
+    {
+        return 0;
+    }
+    if (index >= lines.size())
+    {
+        buffer[0] = 0;
+        return 0;
+    }
+
+    const LayoutLine &line = lines[index];
+    size_t length = line.byteLength;
+    if (length >= size)
+    {
+        // Truncate without splitting a UTF-8 sequence
+        length = size - 1;
+        while (length > 0 && (static_cast<uint8_t>(text[line.byteStart + length]) & 0xC0) == 0x80)
+        {
+            length--;
+        }
+    }
+
+    memcpy(buffer, text.data() + line.byteStart, length);
+    buffer[length] = 0;
+    return length;
+}
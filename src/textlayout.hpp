@@ -0,0 +1,246 @@
+/**
+ * @file textlayout.hpp
+ * @brief UTF-8 decoding, cached glyph advances and line breaking
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. Glyph advances are obtained through
+ * a caller-supplied measuring function so the same code runs against
+ * lgfx::IFont on the device or any other font source.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "memorytracker.hpp"
+
+// One decoded character and where it came from in the UTF-8 text
+struct CodepointSpan
+{
+    uint32_t codepoint;
+    uint16_t byteOffset;
+    uint8_t byteLength;
+};
+
+// One laid-out line as a byte range of the source text
+struct LayoutLine
+{
+    uint16_t byteStart;
+    uint16_t byteLength;
+    int16_t width;
+};
+
+typedef std::vector<CodepointSpan, TaggedAllocator<CodepointSpan, MEM_TEXT_LAYOUT>> SpanList;
+
+/**
+ * @brief Decode UTF-8 text into codepoint spans
+ * @param text NUL-terminated UTF-8 text
+ * @param spans Output, replaced with one entry per codepoint
+ * @return Number of codepoints decoded
+ *
+ * Malformed sequences decode to U+FFFD one byte at a time.
+ */
+size_t decodeUtf8(const char *text, SpanList &spans);
+
+/**
+ * @brief Check whether a line may break before or after this codepoint
+ * @param codepoint Unicode codepoint
+ * @return true for CJK ideographs, kana, hangul and fullwidth forms
+ */
+bool isIdeographic(uint32_t codepoint);
+
+/**
+ * @brief Check whether this codepoint must not start a line
+ * @param codepoint Unicode codepoint
+ * @return true for closing brackets and CJK punctuation such as 、。」
+ */
+bool isNoLineStart(uint32_t codepoint);
+
+/**
+ * @class GlyphWidthTable
+ * @brief Two-level page table of glyph advances for one font
+ *
+ * The first level is indexed by the high byte of a BMP codepoint, the second
+ * by the low byte. Pages are allocated the first time one of their glyphs is
+ * measured, so Latin text costs one page and CJK text a handful.
+ */
+class GlyphWidthTable
+{
+public:
+    typedef int (*MeasureFunc)(const void *font, uint32_t codepoint);
+
+private:
+    static const int PAGE_SIZE = 256;
+    static const int PAGE_COUNT = 256;         // Covers the Basic Multilingual Plane
+    static const uint8_t UNKNOWN_ADVANCE = 0xFF; // Not measured yet (or too wide to cache)
+
+    uint8_t *pages[PAGE_COUNT];
+    const void *font;
+    MeasureFunc measure;
+    size_t pagesAllocated;
+
+    GlyphWidthTable(const GlyphWidthTable &) = delete;
+    GlyphWidthTable &operator=(const GlyphWidthTable &) = delete;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    GlyphWidthTable();
+
+    /**
+     * @brief Destructor - frees all pages
+     */
+    ~GlyphWidthTable();
+
+    /**
+     * @brief Drop all cached advances and bind the table to a font
+     *
+     * Allocated pages are cleared and reused, not freed.
+     * @param fontPtr Font identity passed to the measuring function
+     * @param measureFunc Function returning the advance of one glyph
+     */
+    void reset(const void *fontPtr, MeasureFunc measureFunc);
+
+    /**
+     * @brief Get the font this table caches
+     * @return Font identity given to reset()
+     */
+    const void *getFont() const;
+
+    /**
+     * @brief Get the advance width of a glyph, measuring it on first use
+     * @param codepoint Unicode codepoint
+     * @return Advance in pixels
+     */
+    int getAdvance(uint32_t codepoint);
+
+    /**
+     * @brief Get the width of a text on one line: the sum of its advances
+     * @param text NUL-terminated UTF-8 text, or nullptr
+     * @return Width in pixels
+     */
+    int getTextWidth(const char *text);
+
+    /**
+     * @brief Get the number of second-level pages allocated
+     * @return Allocated page count
+     */
+    size_t getPageCount() const;
+};
+
+/**
+ * @class GlyphWidthCache
+ * @brief Keeps glyph width tables for the most recently used fonts
+ */
+class GlyphWidthCache
+{
+public:
+    static const int FONT_SLOTS = 4;
+
+private:
+    GlyphWidthTable tables[FONT_SLOTS];
+    uint32_t lastUse[FONT_SLOTS];
+    uint32_t useCounter;
+    GlyphWidthTable::MeasureFunc measure;
+
+public:
+    /**
+     * @brief Constructor
+     * @param measureFunc Function returning the advance of one glyph
+     */
+    GlyphWidthCache(GlyphWidthTable::MeasureFunc measureFunc);
+
+    /**
+     * @brief Get the table for a font, recycling the least recently used slot
+     * @param fontPtr Font identity
+     * @return Width table bound to the font
+     */
+    GlyphWidthTable &forFont(const void *fontPtr);
+};
+
+/**
+ * @class TextLayout
+ * @brief Breaks one text into lines that fit a given width
+ *
+ * The text is decoded when it changes and re-measured only when the font or
+ * width changes. Lines break after spaces and between ideographs, never in
+ * the middle of a UTF-8 sequence, and never before closing punctuation.
+ */
+class TextLayout
+{
+public:
+    static const size_t MAX_LINE_BYTES = 192; // Longest line copyLine() returns
+
+private:
+    std::basic_string<char, std::char_traits<char>, TaggedAllocator<char, MEM_TEXT_LAYOUT>> text;
+    SpanList spans;
+    std::vector<LayoutLine, TaggedAllocator<LayoutLine, MEM_TEXT_LAYOUT>> lines;
+    const void *layoutFont;
+    int layoutWidth;
+    bool layoutValid;
+    bool spansValid;   // Decoding is deferred until layout() needs it
+
+    void emitLine(size_t firstSpan, size_t endSpan, int width, GlyphWidthTable &widths);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    TextLayout();
+
+    /**
+     * @brief Set the text to lay out
+     * @param newText NUL-terminated UTF-8 text
+     * @return true if the text differs from the previous one
+     */
+    bool setText(const char *newText);
+
+    /**
+     * @brief Break the text into lines for a font and width
+     * @param widths Glyph width table of the font to lay out with
+     * @param maxWidth Maximum line width in pixels
+     */
+    void layout(GlyphWidthTable &widths, int maxWidth);
+
+    /**
+     * @brief Use lines computed earlier instead of laying the text out again
+     * @param font Font identity the lines were computed for
+     * @param maxWidth Width the lines were computed for
+     * @param precomputed Lines for the current text
+     * @param count Number of lines
+     *
+     * A following layout() with the same font and width is then a no-op.
+     */
+    void assignLines(const void *font, int maxWidth, const LayoutLine *precomputed, size_t count);
+
+    /**
+     * @brief Get the number of lines from the last layout()
+     * @return Line count
+     */
+    size_t getLineCount() const;
+
+    /**
+     * @brief Get one laid-out line
+     * @param index Line index
+     * @return Byte range and width of the line
+     */
+    const LayoutLine &getLine(size_t index) const;
+
+    /**
+     * @brief Get the decoded codepoints of the current text
+     * @return Codepoint spans
+     */
+    const SpanList &getSpans();
+
+    /**
+     * @brief Copy one line into a NUL-terminated buffer
+     * @param index Line index
+     * @param buffer Destination buffer
+     * @param size Size of buffer in bytes
+     * @return Number of bytes copied, excluding the terminator
+     */
+    size_t copyLine(size_t index, char *buffer, size_t size) const;
+};
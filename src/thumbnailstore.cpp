@@ -0,0 +1,288 @@
+/**
+ * @file thumbnailstore.cpp
+ * @brief Pre-rendered 4-bit specimen images for every catalog font, persisted to flash
+ * @date 2026-10-19
+ */
+
+#include "thumbnailstore.hpp"
+#include "rle4.hpp"
+#include <string.h>
+
+static const uint32_t THUMBNAIL_FILE_MAGIC = 0x424D4854; // "THMB"
+static const uint16_t THUMBNAIL_FILE_VERSION = 1;
+
+struct ThumbnailFileHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t width;
+    uint32_t catalogHash;
+    uint32_t textHash;
+    uint16_t fontCount;
+    uint16_t reserved;
+    uint32_t tableOffset;
+};
+
+ThumbnailStore::ThumbnailStore() : file(nullptr),
+                                   width(0),
+                                   textHash(0)
+{
+}
+
+ThumbnailStore::~ThumbnailStore()
+{
+    close();
+}
+
+bool ThumbnailStore::load(const char *path, uint32_t catalogHash, uint32_t expectedTextHash, int imageWidth,
+                          size_t fontCount)
+{
+    close();
+
+    file = (path != nullptr) ? fopen(path, "rb") : nullptr;
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    ThumbnailFileHeader header;
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 &&
+                 header.magic == THUMBNAIL_FILE_MAGIC &&
+                 header.version == THUMBNAIL_FILE_VERSION &&
+                 header.width == imageWidth &&
+                 header.catalogHash == catalogHash &&
+                 header.textHash == expectedTextHash &&
+                 header.fontCount == fontCount &&
+                 fseek(file, header.tableOffset, SEEK_SET) == 0;
+
+    if (valid)
+    {
+        offsets.resize(fontCount + 1);
+        valid = fread(offsets.data(), sizeof(uint32_t), offsets.size(), file) == offsets.size() &&
+                offsets[fontCount] == header.tableOffset;
+    }
+
+    // One read buffer for the largest entry, so read() never allocates
+    size_t largest = 0;
+    for (size_t i = 0; valid && i < fontCount; i++)
+    {
+        valid = offsets[i] >= sizeof(header) && offsets[i] <= offsets[i + 1];
+        largest = (valid && offsets[i + 1] - offsets[i] > largest) ? offsets[i + 1] - offsets[i] : largest;
+    }
+    if (valid)
+    {
+        readBuffer.resize(largest);
+    }
+
+    if (!valid)
+    {
+        close();
+        return false;
+    }
+
+    width = imageWidth;
+    textHash = expectedTextHash;
+    return true;
+}
+
+void ThumbnailStore::close()
+{
+    if (file != nullptr)
+    {
+        fclose(file);
+        file = nullptr;
+    }
+    offsets.clear();
+    offsets.shrink_to_fit();
+    readBuffer.clear();
+    readBuffer.shrink_to_fit();
+}
+
+bool ThumbnailStore::isReady() const
+{
+    return file != nullptr;
+}
+
+uint32_t ThumbnailStore::getTextHash() const
+{
+    return textHash;
+}
+
+bool ThumbnailStore::read(int fontId, uint8_t *pixels, size_t stride, int maxHeight, int &height)
+{
+    height = 0;
+    if (file == nullptr || fontId < 0 || (size_t)fontId + 1 >= offsets.size() ||
+        offsets[fontId + 1] <= offsets[fontId] + sizeof(uint16_t))
+    {
+        return false;
+    }
+
+    // One read for the whole entry, then decode row by row
+    size_t length = offsets[fontId + 1] - offsets[fontId];
+    if (fseek(file, offsets[fontId], SEEK_SET) != 0 || fread(readBuffer.data(), 1, length, file) != length)
+    {
+        return false;
+    }
+
+    uint16_t rows;
+    memcpy(&rows, readBuffer.data(), sizeof(rows));
+    if (rows > maxHeight)
+    {
+        return false;
+    }
+
+    size_t offset = sizeof(rows);
+    for (int y = 0; y < rows; y++)
+    {
+        size_t used = rle4Decode(readBuffer.data() + offset, length - offset, pixels + y * stride, width);
+        if (used == 0)
+        {
+            return false;
+        }
+        offset += used;
+    }
+
+    height = rows;
+    return true;
+}
+
+size_t ThumbnailStore::getFileSize() const
+{
+    return offsets.empty() ? 0 : offsets.back() + offsets.size() * sizeof(uint32_t);
+}
+
+// ThumbnailWriter
+
+ThumbnailWriter::ThumbnailWriter() : file(nullptr),
+                                     path(),
+                                     tempPath(),
+                                     width(0),
+                                     fontCount(0),
+                                     catalogHash(0),
+                                     textHash(0)
+{
+}
+
+ThumbnailWriter::~ThumbnailWriter()
+{
+    abort();
+}
+
+bool ThumbnailWriter::begin(const char *targetPath, uint32_t catalog, uint32_t text, int imageWidth, size_t fonts)
+{
+    abort();
+    if (targetPath == nullptr || strlen(targetPath) >= sizeof(path))
+    {
+        return false;
+    }
+
+    strcpy(path, targetPath);
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", targetPath);
+    file = fopen(tempPath, "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    width = imageWidth;
+    fontCount = fonts;
+    catalogHash = catalog;
+    textHash = text;
+    offsets.clear();
+    encodeBuffer.resize(rle4MaxEncodedSize(imageWidth));
+
+    // The header is rewritten by finish(); until then its magic is zero
+    ThumbnailFileHeader header = {};
+    if (fwrite(&header, sizeof(header), 1, file) != 1)
+    {
+        abort();
+        return false;
+    }
+    return true;
+}
+
+bool ThumbnailWriter::add(const uint8_t *pixels, size_t stride, int height)
+{
+    if (file == nullptr || height < 0 || height > 0xFFFF)
+    {
+        return false;
+    }
+
+    offsets.push_back(ftell(file));
+    uint16_t rows = height;
+    if (fwrite(&rows, sizeof(rows), 1, file) != 1)
+    {
+        return false;
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        size_t length = rle4Encode(pixels + y * stride, width, encodeBuffer.data(), encodeBuffer.size());
+        if (length == 0 || fwrite(encodeBuffer.data(), 1, length, file) != length)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ThumbnailWriter::finish()
+{
+    if (file == nullptr || offsets.size() != fontCount)
+    {
+        abort();
+        return false;
+    }
+
+    ThumbnailFileHeader header;
+    header.magic = THUMBNAIL_FILE_MAGIC;
+    header.version = THUMBNAIL_FILE_VERSION;
+    header.width = width;
+    header.catalogHash = catalogHash;
+    header.textHash = textHash;
+    header.fontCount = fontCount;
+    header.reserved = 0;
+    header.tableOffset = ftell(file);
+    offsets.push_back(header.tableOffset);
+
+    bool ok = fwrite(offsets.data(), sizeof(uint32_t), offsets.size(), file) == offsets.size() &&
+              fseek(file, 0, SEEK_SET) == 0 &&
+              fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = (fclose(file) == 0) && ok;
+    file = nullptr;
+
+    if (ok)
+    {
+        remove(path);
+        ok = rename(tempPath, path) == 0;
+    }
+    if (!ok)
+    {
+        remove(tempPath);
+    }
+
+    offsets.clear();
+    offsets.shrink_to_fit();
+    encodeBuffer.clear();
+    encodeBuffer.shrink_to_fit();
+    return ok;
+}
+
+void ThumbnailWriter::abort()
+{
+    if (file != nullptr)
+    {
+        fclose(file);
+        file = nullptr;
+        remove(tempPath);
+    }
+    offsets.clear();
+}
+
+size_t ThumbnailWriter::getSize() const
+{
+    return (file != nullptr) ? (size_t)ftell(file) : 0;
+}
+
+// Global instance for easy access
+ThumbnailStore thumbnailStore;
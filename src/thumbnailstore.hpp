@@ -0,0 +1,166 @@
+/**
+ * @file thumbnailstore.hpp
+ * @brief Pre-rendered 4-bit specimen images for every catalog font, persisted to flash
+ * @date 2026-10-19
+ *
+ * Plain C++ using stdio for persistence, like layoutstore.hpp.
+ *
+ * File layout (little-endian):
+ *   ThumbnailFileHeader
+ *   per font: uint16_t height, then height rows of rle4 data
+ *   uint32_t offsets[fontCount + 1] at header.tableOffset, file offset of each font's entry
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+#include "memorytracker.hpp"
+
+/**
+ * @class ThumbnailStore
+ * @brief Reads thumbnails written by ThumbnailWriter
+ *
+ * load() keeps only the offset table and a read buffer the size of the
+ * largest entry in RAM, and the file open; read() seeks to one entry, reads
+ * it into that buffer and decodes it without allocating. The file records the font-catalog
+ * hash, the hash of the text it was rendered with and the image width, and
+ * load() rejects it if any of them differ.
+ */
+class ThumbnailStore
+{
+private:
+    FILE *file;
+    int width;
+    uint32_t textHash;
+    std::vector<uint32_t, TaggedAllocator<uint32_t, MEM_THUMBNAILS>> offsets;
+    std::vector<uint8_t, TaggedAllocator<uint8_t, MEM_THUMBNAILS>> readBuffer;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    ThumbnailStore();
+    ~ThumbnailStore();
+
+    ThumbnailStore(const ThumbnailStore &) = delete;
+    ThumbnailStore &operator=(const ThumbnailStore &) = delete;
+
+    /**
+     * @brief Open a thumbnail file
+     * @param path File to read
+     * @param catalogHash Hash of the current font catalog
+     * @param expectedTextHash Hash of the text the thumbnails must show
+     * @param imageWidth Width the thumbnails must have
+     * @param fontCount Number of catalog fonts
+     * @return true if the file matched
+     */
+    bool load(const char *path, uint32_t catalogHash, uint32_t expectedTextHash, int imageWidth, size_t fontCount);
+
+    /**
+     * @brief Close the file and free the offset table
+     */
+    void close();
+
+    /**
+     * @brief Check whether thumbnails are available
+     * @return true after a successful load()
+     */
+    bool isReady() const;
+
+    /**
+     * @brief Get the hash of the text the thumbnails show
+     * @return FNV-1a hash, see fnv1aString()
+     */
+    uint32_t getTextHash() const;
+
+    /**
+     * @brief Decode one thumbnail
+     * @param fontId Catalog index
+     * @param pixels Output, packed 4-bit rows
+     * @param stride Bytes per output row, at least (width + 1) / 2
+     * @param maxHeight Rows available in pixels
+     * @param height Output, rows decoded
+     * @return false if the thumbnail is missing, too tall or corrupt
+     */
+    bool read(int fontId, uint8_t *pixels, size_t stride, int maxHeight, int &height);
+
+    /**
+     * @brief Get the size of the open file
+     * @return Bytes, 0 if not loaded
+     */
+    size_t getFileSize() const;
+};
+
+/**
+ * @class ThumbnailWriter
+ * @brief Writes a thumbnail file, one font at a time in catalog order
+ *
+ * The file is written under a temporary name and renamed over the target
+ * by finish(), so an interrupted build never leaves a file load() accepts.
+ */
+class ThumbnailWriter
+{
+private:
+    FILE *file;
+    char path[64];
+    char tempPath[68];
+    int width;
+    size_t fontCount;
+    uint32_t catalogHash;
+    uint32_t textHash;
+    std::vector<uint32_t, TaggedAllocator<uint32_t, MEM_THUMBNAILS>> offsets;
+    std::vector<uint8_t, TaggedAllocator<uint8_t, MEM_THUMBNAILS>> encodeBuffer;
+
+public:
+    /**
+     * @brief Constructor
+     */
+    ThumbnailWriter();
+    ~ThumbnailWriter();
+
+    ThumbnailWriter(const ThumbnailWriter &) = delete;
+    ThumbnailWriter &operator=(const ThumbnailWriter &) = delete;
+
+    /**
+     * @brief Start a thumbnail file
+     * @param targetPath File to create
+     * @param catalog Hash of the font catalog
+     * @param text Hash of the text the thumbnails show
+     * @param imageWidth Width of every thumbnail
+     * @param fonts Number of thumbnails that will be added
+     * @return false if the temporary file cannot be created
+     */
+    bool begin(const char *targetPath, uint32_t catalog, uint32_t text, int imageWidth, size_t fonts);
+
+    /**
+     * @brief Append the thumbnail of the next font
+     * @param pixels Packed 4-bit rows
+     * @param stride Bytes per row
+     * @param height Rows to store
+     * @return false on a write error
+     */
+    bool add(const uint8_t *pixels, size_t stride, int height);
+
+    /**
+     * @brief Write the offset table and replace the target file
+     * @return false on a write error or if fewer thumbnails were added than announced
+     */
+    bool finish();
+
+    /**
+     * @brief Discard the file being written
+     */
+    void abort();
+
+    /**
+     * @brief Get the number of bytes written so far
+     * @return File size
+     */
+    size_t getSize() const;
+};
+
+// Global instance declaration
+extern ThumbnailStore thumbnailStore;
@@ -0,0 +1,805 @@
+/**
+ * @file truetype.cpp
+ * @brief TrueType outline parsing and anti-aliased scanline rasterization
+ * @date 2026-10-19
+ */
+
+#include "truetype.hpp"
+#include <math.h>
+#include <string.h>
+
+static const int MAX_COMPOSITE_DEPTH = 8; // Nesting of composite glyphs
+static const int MAX_CURVE_SEGMENTS = 32;
+
+// Composite glyph flags
+static const uint16_t ARG_1_AND_2_ARE_WORDS = 0x0001;
+static const uint16_t ARGS_ARE_XY_VALUES = 0x0002;
+static const uint16_t WE_HAVE_A_SCALE = 0x0008;
+static const uint16_t MORE_COMPONENTS = 0x0020;
+static const uint16_t WE_HAVE_AN_X_AND_Y_SCALE = 0x0040;
+static const uint16_t WE_HAVE_A_TWO_BY_TWO = 0x0080;
+
+// Simple glyph point flags
+static const uint8_t ON_CURVE_POINT = 0x01;
+static const uint8_t X_SHORT_VECTOR = 0x02;
+static const uint8_t Y_SHORT_VECTOR = 0x04;
+static const uint8_t REPEAT_FLAG = 0x08;
+static const uint8_t X_SAME_OR_POSITIVE = 0x10;
+static const uint8_t Y_SAME_OR_POSITIVE = 0x20;
+
+// Font files are big-endian
+static inline uint16_t readU16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static inline int16_t readS16(const uint8_t *p)
+{
+    return (int16_t)readU16(p);
+}
+
+static inline uint32_t readU32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Component placement: x' = xx * x + yx * y + dx, y' = xy * x + yy * y + dy
+struct TrueTypeFace::Transform
+{
+    float xx, xy, yx, yy, dx, dy;
+};
+
+TrueTypeFace::TrueTypeFace() : data(nullptr),
+                               size(0),
+                               glyfOffset(0),
+                               locaOffset(0),
+                               hmtxOffset(0),
+                               cmapOffset(0),
+                               glyphCount(0),
+                               hMetricCount(0),
+                               longLoca(false),
+                               metrics()
+{
+}
+
+uint32_t TrueTypeFace::findTable(const char *tag) const
+{
+    if (size < 12)
+    {
+        return 0;
+    }
+
+    uint16_t tableCount = readU16(data + 4);
+    for (uint16_t i = 0; i < tableCount; i++)
+    {
+        const uint8_t *record = data + 12 + i * 16;
+        if (record + 16 > data + size)
+        {
+            return 0;
+        }
+        if (memcmp(record, tag, 4) == 0)
+        {
+            uint32_t offset = readU32(record + 8);
+            uint32_t length = readU32(record + 12);
+            return (offset < size && length <= size - offset) ? offset : 0;
+        }
+    }
+    return 0;
+}
+
+bool TrueTypeFace::load(const uint8_t *fontData, size_t length)
+{
+    data = fontData;
+    size = length;
+    glyphCount = 0;
+
+    uint32_t version = (length >= 4) ? readU32(fontData) : 0;
+    if (version != 0x00010000 && version != 0x74727565) // TrueType outlines, "true"
+    {
+        return false;
+    }
+
+    uint32_t head = findTable("head");
+    uint32_t hhea = findTable("hhea");
+    uint32_t maxp = findTable("maxp");
+    uint32_t cmap = findTable("cmap");
+    glyfOffset = findTable("glyf");
+    locaOffset = findTable("loca");
+    hmtxOffset = findTable("hmtx");
+    if (head == 0 || hhea == 0 || maxp == 0 || cmap == 0 || glyfOffset == 0 || locaOffset == 0 ||
+        hmtxOffset == 0 || head + 54 > size || hhea + 36 > size || maxp + 6 > size)
+    {
+        return false;
+    }
+
+    metrics.unitsPerEm = readU16(data + head + 18);
+    longLoca = readS16(data + head + 50) != 0;
+    metrics.ascender = readS16(data + hhea + 4);
+    metrics.descender = readS16(data + hhea + 6);
+    metrics.lineGap = readS16(data + hhea + 8);
+    hMetricCount = readU16(data + hhea + 34);
+    uint16_t glyphs = readU16(data + maxp + 4);
+    if (metrics.unitsPerEm == 0 || hMetricCount == 0)
+    {
+        return false;
+    }
+
+    // Prefer the Windows Unicode BMP subtable, any Unicode one will do
+    cmapOffset = 0;
+    uint16_t subtableCount = (cmap + 4 <= size) ? readU16(data + cmap + 2) : 0;
+    for (uint16_t i = 0; i < subtableCount && cmap + 4 + (i + 1) * 8 <= size; i++)
+    {
+        const uint8_t *record = data + cmap + 4 + i * 8;
+        uint16_t platform = readU16(record);
+        uint16_t encoding = readU16(record + 2);
+        uint32_t offset = cmap + readU32(record + 4);
+        if (offset + 14 > size || readU16(data + offset) != 4)
+        {
+            continue;
+        }
+        if (platform == 0 || (platform == 3 && encoding == 1))
+        {
+            cmapOffset = offset;
+            if (platform == 3)
+            {
+                break;
+            }
+        }
+    }
+    if (cmapOffset == 0)
+    {
+        return false;
+    }
+
+    glyphCount = glyphs;
+    return true;
+}
+
+bool TrueTypeFace::isLoaded() const
+{
+    return glyphCount > 0;
+}
+
+const TrueTypeFace::Metrics &TrueTypeFace::getMetrics() const
+{
+    return metrics;
+}
+
+uint16_t TrueTypeFace::getGlyphCount() const
+{
+    return glyphCount;
+}
+
+uint16_t TrueTypeFace::findGlyph(uint32_t codepoint) const
+{
+    if (!isLoaded() || codepoint > 0xFFFF)
+    {
+        return 0;
+    }
+
+    const uint8_t *table = data + cmapOffset;
+    uint16_t segCount = readU16(table + 6) / 2;
+    if (cmapOffset + 16 + segCount * 8 > size)
+    {
+        return 0;
+    }
+    const uint8_t *endCodes = table + 14;
+    const uint8_t *startCodes = endCodes + segCount * 2 + 2;
+    const uint8_t *idDeltas = startCodes + segCount * 2;
+    const uint8_t *idRangeOffsets = idDeltas + segCount * 2;
+
+    // Segments are sorted by end code; find the first one ending at or after codepoint
+    uint16_t low = 0;
+    uint16_t high = segCount;
+    while (low < high)
+    {
+        uint16_t mid = (low + high) / 2;
+        if (readU16(endCodes + mid * 2) < codepoint)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    if (low == segCount || readU16(startCodes + low * 2) > codepoint)
+    {
+        return 0;
+    }
+
+    uint16_t delta = readU16(idDeltas + low * 2);
+    uint16_t rangeOffset = readU16(idRangeOffsets + low * 2);
+    if (rangeOffset == 0)
+    {
+        return (uint16_t)(codepoint + delta);
+    }
+
+    const uint8_t *glyphAddress = idRangeOffsets + low * 2 + rangeOffset +
+                                  (codepoint - readU16(startCodes + low * 2)) * 2;
+    if (glyphAddress + 2 > data + size)
+    {
+        return 0;
+    }
+    uint16_t glyph = readU16(glyphAddress);
+    return (glyph != 0) ? (uint16_t)(glyph + delta) : 0;
+}
+
+void TrueTypeFace::getHorizontalMetrics(uint16_t glyph, int &advance, int &leftBearing) const
+{
+    advance = 0;
+    leftBearing = 0;
+    if (!isLoaded())
+    {
+        return;
+    }
+
+    // Glyphs past the last long metric share its advance and have only a bearing
+    uint16_t metricIndex = (glyph < hMetricCount) ? glyph : hMetricCount - 1;
+    uint32_t offset = hmtxOffset + metricIndex * 4;
+    if (offset + 4 <= size)
+    {
+        advance = readU16(data + offset);
+        leftBearing = readS16(data + offset + 2);
+    }
+    if (glyph >= hMetricCount)
+    {
+        offset = hmtxOffset + hMetricCount * 4 + (glyph - hMetricCount) * 2;
+        leftBearing = (offset + 2 <= size) ? readS16(data + offset) : 0;
+    }
+}
+
+bool TrueTypeFace::getGlyphRange(uint16_t glyph, uint32_t &offset, uint32_t &length) const
+{
+    if (!isLoaded() || glyph >= glyphCount)
+    {
+        return false;
+    }
+
+    uint32_t start;
+    uint32_t end;
+    if (longLoca)
+    {
+        if (locaOffset + (glyph + 2) * 4 > size)
+        {
+            return false;
+        }
+        start = readU32(data + locaOffset + glyph * 4);
+        end = readU32(data + locaOffset + glyph * 4 + 4);
+    }
+    else
+    {
+        if (locaOffset + (glyph + 2) * 2 > size)
+        {
+            return false;
+        }
+        start = readU16(data + locaOffset + glyph * 2) * 2;
+        end = readU16(data + locaOffset + glyph * 2 + 2) * 2;
+    }
+
+    // Empty glyphs (spaces) have no data; a glyph header alone is 10 bytes
+    offset = glyfOffset + start;
+    length = (end > start) ? end - start : 0;
+    return length >= 10 && offset + length <= size;
+}
+
+bool TrueTypeFace::getBounds(uint16_t glyph, int &xMin, int &yMin, int &xMax, int &yMax) const
+{
+    uint32_t offset;
+    uint32_t length;
+    if (!getGlyphRange(glyph, offset, length))
+    {
+        return false;
+    }
+
+    xMin = readS16(data + offset + 2);
+    yMin = readS16(data + offset + 4);
+    xMax = readS16(data + offset + 6);
+    yMax = readS16(data + offset + 8);
+    return true;
+}
+
+bool TrueTypeFace::getOutline(uint16_t glyph, Outline &outline) const
+{
+    outline.points.clear();
+    outline.contourEnds.clear();
+
+    int xMin, yMin, xMax, yMax;
+    if (!getBounds(glyph, xMin, yMin, xMax, yMax))
+    {
+        return false;
+    }
+    outline.xMin = xMin;
+    outline.yMin = yMin;
+    outline.xMax = xMax;
+    outline.yMax = yMax;
+
+    Transform identity = {1, 0, 0, 1, 0, 0};
+    return appendOutline(glyph, outline, identity, 0) && !outline.points.empty();
+}
+
+bool TrueTypeFace::appendOutline(uint16_t glyph, Outline &outline, const Transform &transform, int depth) const
+{
+    uint32_t offset;
+    uint32_t length;
+    if (depth > MAX_COMPOSITE_DEPTH || !getGlyphRange(glyph, offset, length))
+    {
+        return depth > 0; // A blank component adds nothing, but is no error
+    }
+
+    const uint8_t *p = data + offset;
+    const uint8_t *end = p + length;
+    int16_t contourCount = readS16(p);
+
+    if (contourCount < 0)
+    {
+        // Composite: place each component with its own transform
+        p += 10;
+        uint16_t flags;
+        do
+        {
+            if (p + 4 > end)
+            {
+                return false;
+            }
+            flags = readU16(p);
+            uint16_t component = readU16(p + 2);
+            p += 4;
+
+            int arg1;
+            int arg2;
+            if (flags & ARG_1_AND_2_ARE_WORDS)
+            {
+                if (p + 4 > end)
+                {
+                    return false;
+                }
+                arg1 = readS16(p);
+                arg2 = readS16(p + 2);
+                p += 4;
+            }
+            else
+            {
+                if (p + 2 > end)
+                {
+                    return false;
+                }
+                arg1 = (int8_t)p[0];
+                arg2 = (int8_t)p[1];
+                p += 2;
+            }
+
+            Transform local = {1, 0, 0, 1, 0, 0};
+            if (flags & ARGS_ARE_XY_VALUES)
+            {
+                local.dx = arg1;
+                local.dy = arg2;
+            } // Point-matched placement is rare in text faces and left at the origin
+
+            if (flags & WE_HAVE_A_SCALE)
+            {
+                if (p + 2 > end)
+                {
+                    return false;
+                }
+                local.xx = local.yy = readS16(p) / 16384.0f;
+                p += 2;
+            }
+            else if (flags & WE_HAVE_AN_X_AND_Y_SCALE)
+            {
+                if (p + 4 > end)
+                {
+                    return false;
+                }
+                local.xx = readS16(p) / 16384.0f;
+                local.yy = readS16(p + 2) / 16384.0f;
+                p += 4;
+            }
+            else if (flags & WE_HAVE_A_TWO_BY_TWO)
+            {
+                if (p + 8 > end)
+                {
+                    return false;
+                }
+                local.xx = readS16(p) / 16384.0f;
+                local.xy = readS16(p + 2) / 16384.0f;
+                local.yx = readS16(p + 4) / 16384.0f;
+                local.yy = readS16(p + 6) / 16384.0f;
+                p += 8;
+            }
+
+            // Component first, then the parent's transform
+            Transform combined;
+            combined.xx = transform.xx * local.xx + transform.yx * local.xy;
+            combined.xy = transform.xy * local.xx + transform.yy * local.xy;
+            combined.yx = transform.xx * local.yx + transform.yx * local.yy;
+            combined.yy = transform.xy * local.yx + transform.yy * local.yy;
+            combined.dx = transform.xx * local.dx + transform.yx * local.dy + transform.dx;
+            combined.dy = transform.xy * local.dx + transform.yy * local.dy + transform.dy;
+            if (!appendOutline(component, outline, combined, depth + 1))
+            {
+                return false;
+            }
+        } while (flags & MORE_COMPONENTS);
+        return true;
+    }
+
+    // Simple glyph
+    const uint8_t *endPoints = p + 10;
+    if (contourCount == 0 || endPoints + contourCount * 2 + 2 > end)
+    {
+        return contourCount == 0;
+    }
+    size_t pointCount = readU16(endPoints + (contourCount - 1) * 2) + 1;
+    uint16_t instructionLength = readU16(endPoints + contourCount * 2);
+    const uint8_t *flagData = endPoints + contourCount * 2 + 2 + instructionLength;
+
+    size_t first = outline.points.size();
+    for (int i = 0; i < contourCount; i++)
+    {
+        size_t contourEnd = first + readU16(endPoints + i * 2);
+        if (contourEnd >= first + pointCount || (i > 0 && contourEnd <= outline.contourEnds.back()))
+        {
+            outline.points.resize(first);
+            return false;
+        }
+        outline.contourEnds.push_back(contourEnd);
+    }
+    outline.points.resize(first + pointCount);
+    Point *points = outline.points.data() + first;
+
+    // Flags, run-length coded; kept in y until the y deltas are read
+    size_t xLength = 0;
+    for (size_t i = 0; i < pointCount;)
+    {
+        if (flagData >= end)
+        {
+            return false;
+        }
+        uint8_t flag = *flagData++;
+        int repeat = 1;
+        if (flag & REPEAT_FLAG)
+        {
+            if (flagData >= end)
+            {
+                return false;
+            }
+            repeat += *flagData++;
+        }
+        for (; repeat > 0 && i < pointCount; repeat--, i++)
+        {
+            points[i].onCurve = (flag & ON_CURVE_POINT) != 0;
+            points[i].y = flag;
+            xLength += (flag & X_SHORT_VECTOR) ? 1 : ((flag & X_SAME_OR_POSITIVE) ? 0 : 2);
+        }
+    }
+
+    const uint8_t *xData = flagData;
+    const uint8_t *yData = xData + xLength;
+    int x = 0;
+    int y = 0;
+    for (size_t i = 0; i < pointCount; i++)
+    {
+        uint8_t flag = (uint8_t)points[i].y;
+        if (flag & X_SHORT_VECTOR)
+        {
+            if (xData >= end)
+            {
+                return false;
+            }
+            x += (flag & X_SAME_OR_POSITIVE) ? *xData : -*xData;
+            xData++;
+        }
+        else if (!(flag & X_SAME_OR_POSITIVE))
+        {
+            if (xData + 2 > end)
+            {
+                return false;
+            }
+            x += readS16(xData);
+            xData += 2;
+        }
+
+        if (flag & Y_SHORT_VECTOR)
+        {
+            if (yData >= end)
+            {
+                return false;
+            }
+            y += (flag & Y_SAME_OR_POSITIVE) ? *yData : -*yData;
+            yData++;
+        }
+        else if (!(flag & Y_SAME_OR_POSITIVE))
+        {
+            if (yData + 2 > end)
+            {
+                return false;
+            }
+            y += readS16(yData);
+            yData += 2;
+        }
+
+        points[i].x = (int16_t)lroundf(transform.xx * x + transform.yx * y + transform.dx);
+        points[i].y = (int16_t)lroundf(transform.xy * x + transform.yy * y + transform.dy);
+    }
+    return true;
+}
+
+// GlyphRasterizer
+
+GlyphRasterizer::GlyphRasterizer() : width(0),
+                                     height(0)
+{
+}
+
+void GlyphRasterizer::addLine(float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1)
+    {
+        return;
+    }
+
+    // Walk downwards; the direction only decides the sign of the area
+    float direction = 1.0f;
+    if (y0 > y1)
+    {
+        direction = -1.0f;
+        float t = x0;
+        x0 = x1;
+        x1 = t;
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+
+    float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0;
+    int firstRow = (int)y0;
+    int endRow = (int)ceilf(y1);
+    if (endRow > height)
+    {
+        endRow = height;
+    }
+
+    // Each row takes the trapezoid area between the line and the right edge;
+    // cells are sums of those, and the running sum in rasterize() recovers them
+    for (int row = firstRow; row < endRow; row++)
+    {
+        float *line = coverage.data() + row * width;
+        float dy = ((row + 1 < y1) ? row + 1 : y1) - ((row > y0) ? row : y0);
+        float xNext = x + dxdy * dy;
+        float d = dy * direction;
+        float left = (x < xNext) ? x : xNext;
+        float right = (x < xNext) ? xNext : x;
+        float leftFloor = floorf(left);
+        int leftCell = (int)leftFloor;
+        float rightCeil = ceilf(right);
+        int rightCell = (int)rightCeil;
+
+        if (rightCell <= leftCell + 1)
+        {
+            // Within one cell
+            float middle = 0.5f * (x + xNext) - leftFloor;
+            line[leftCell] += d - d * middle;
+            line[leftCell + 1] += d * middle;
+        }
+        else
+        {
+            float slope = 1.0f / (right - left);
+            float leftFraction = left - leftFloor;
+            float firstArea = 0.5f * slope * (1.0f - leftFraction) * (1.0f - leftFraction);
+            float rightFraction = right - rightCeil + 1.0f;
+            float lastArea = 0.5f * slope * rightFraction * rightFraction;
+
+            line[leftCell] += d * firstArea;
+            if (rightCell == leftCell + 2)
+            {
+                line[leftCell + 1] += d * (1.0f - firstArea - lastArea);
+            }
+            else
+            {
+                float secondArea = slope * (1.5f - leftFraction);
+                line[leftCell + 1] += d * (secondArea - firstArea);
+                for (int cell = leftCell + 2; cell < rightCell - 1; cell++)
+                {
+                    line[cell] += d * slope;
+                }
+                float beforeLast = secondArea + (rightCell - leftCell - 3) * slope;
+                line[rightCell - 1] += d * (1.0f - beforeLast - lastArea);
+            }
+            line[rightCell] += d * lastArea;
+        }
+        x = xNext;
+    }
+}
+
+void GlyphRasterizer::addCurve(float x0, float y0, float cx, float cy, float x1, float y1)
+{
+    // The flattening error of n segments is about |x0 - 2c + x1| / (8 n^2) pixels
+    float ddx = x0 - 2 * cx + x1;
+    float ddy = y0 - 2 * cy + y1;
+    int segments = 1 + (int)sqrtf(sqrtf(ddx * ddx + ddy * ddy));
+    if (segments > MAX_CURVE_SEGMENTS)
+    {
+        segments = MAX_CURVE_SEGMENTS;
+    }
+
+    float px = x0;
+    float py = y0;
+    for (int i = 1; i <= segments; i++)
+    {
+        float t = (float)i / segments;
+        float u = 1.0f - t;
+        float nx = u * u * x0 + 2 * u * t * cx + t * t * x1;
+        float ny = u * u * y0 + 2 * u * t * cy + t * t * y1;
+        addLine(px, py, nx, ny);
+        px = nx;
+        py = ny;
+    }
+}
+
+bool GlyphRasterizer::rasterize(const TrueTypeFace &face, uint32_t codepoint, int pixelsPerEm, GlyphBitmap &bitmap)
+{
+    bitmap.width = 0;
+    bitmap.height = 0;
+    bitmap.left = 0;
+    bitmap.top = 0;
+    bitmap.advance = 0;
+    bitmap.pixels.clear();
+
+    uint16_t glyph = face.findGlyph(codepoint);
+    if (glyph == 0 || pixelsPerEm <= 0)
+    {
+        return false;
+    }
+
+    float scale = (float)pixelsPerEm / face.getMetrics().unitsPerEm;
+    int advance;
+    int leftBearing;
+    face.getHorizontalMetrics(glyph, advance, leftBearing);
+    bitmap.advance = (int16_t)lroundf(advance * scale);
+
+    if (!face.getOutline(glyph, outline))
+    {
+        return true; // Blank glyph, e.g. a space
+    }
+
+    int left = (int)floorf(outline.xMin * scale);
+    int right = (int)ceilf(outline.xMax * scale);
+    int top = (int)ceilf(outline.yMax * scale);
+    int bottom = (int)floorf(outline.yMin * scale);
+    width = right - left;
+    height = top - bottom;
+    if (width <= 0 || height <= 0)
+    {
+        return true;
+    }
+
+    // Lines may spill one cell past the row end; the running sum carries it over
+    coverage.assign(width * height + 2, 0.0f);
+
+    // Contours, in pixels with y downwards; points outside the box from
+    // rounding are clamped onto it
+    auto px = [&](const TrueTypeFace::Point &p)
+    {
+        float v = p.x * scale - left;
+        return (v < 0) ? 0.0f : ((v > width) ? (float)width : v);
+    };
+    auto py = [&](const TrueTypeFace::Point &p)
+    {
+        float v = top - p.y * scale;
+        return (v < 0) ? 0.0f : ((v > height) ? (float)height : v);
+    };
+
+    size_t start = 0;
+    for (size_t contour = 0; contour < outline.contourEnds.size(); contour++)
+    {
+        size_t end = outline.contourEnds[contour];
+        size_t count = end - start + 1;
+        const TrueTypeFace::Point *points = outline.points.data() + start;
+        start = end + 1;
+        if (count < 2)
+        {
+            continue;
+        }
+
+        // Start on an on-curve point; between two off-curve points one is implied
+        float startX;
+        float startY;
+        size_t first;
+        size_t remaining;
+        if (points[0].onCurve)
+        {
+            startX = px(points[0]);
+            startY = py(points[0]);
+            first = 1;
+            remaining = count - 1;
+        }
+        else if (points[count - 1].onCurve)
+        {
+            startX = px(points[count - 1]);
+            startY = py(points[count - 1]);
+            first = 0;
+            remaining = count - 1;
+        }
+        else
+        {
+            startX = 0.5f * (px(points[0]) + px(points[count - 1]));
+            startY = 0.5f * (py(points[0]) + py(points[count - 1]));
+            first = 0;
+            remaining = count;
+        }
+
+        float x = startX;
+        float y = startY;
+        float controlX = 0;
+        float controlY = 0;
+        bool haveControl = false;
+        for (size_t i = 0; i < remaining; i++)
+        {
+            const TrueTypeFace::Point &point = points[(first + i) % count];
+            float nx = px(point);
+            float ny = py(point);
+            if (point.onCurve)
+            {
+                if (haveControl)
+                {
+                    addCurve(x, y, controlX, controlY, nx, ny);
+                }
+                else
+                {
+                    addLine(x, y, nx, ny);
+                }
+                x = nx;
+                y = ny;
+                haveControl = false;
+            }
+            else
+            {
+                if (haveControl)
+                {
+                    float midX = 0.5f * (controlX + nx);
+                    float midY = 0.5f * (controlY + ny);
+                    addCurve(x, y, controlX, controlY, midX, midY);
+                    x = midX;
+                    y = midY;
+                }
+                controlX = nx;
+                controlY = ny;
+                haveControl = true;
+            }
+        }
+
+        if (haveControl)
+        {
+            addCurve(x, y, controlX, controlY, startX, startY);
+        }
+        else
+        {
+            addLine(x, y, startX, startY);
+        }
+    }
+
+    bitmap.width = width;
+    bitmap.height = height;
+    bitmap.left = left;
+    bitmap.top = top;
+    size_t stride = bitmap.getStride();
+    bitmap.pixels.assign(stride * height, 0);
+
+    // Non-zero winding: overlapping contours sum past full coverage and are clamped
+    float sum = 0;
+    const float *cell = coverage.data();
+    for (int row = 0; row < height; row++)
+    {
+        uint8_t *out = bitmap.pixels.data() + row * stride;
+        for (int column = 0; column < width; column++)
+        {
+            sum += *cell++;
+            float alpha = fabsf(sum);
+            int level = (alpha >= 1.0f) ? 15 : (int)(alpha * 15.0f + 0.5f);
+            out[column >> 1] |= (column & 1) ? level : level << 4;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file truetype.hpp
+ * @brief TrueType outline parsing and anti-aliased scanline rasterization
+ * @date 2026-10-19
+ *
+ * Plain C++ with no Arduino dependencies. Reads the tables needed to draw
+ * horizontal text (head, hhea, maxp, cmap format 4, loca, glyf, hmtx) from a
+ * font file held in memory; hinting, kerning and other tables are ignored.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "memorytracker.hpp"
+
+// One rasterized glyph, 4-bit coverage packed two pixels per byte, high nibble first
+struct GlyphBitmap
+{
+    int16_t width;   // Pixels
+    int16_t height;  // Rows
+    int16_t left;    // Pen position to the first column
+    int16_t top;     // Baseline to the first row, positive upwards
+    int16_t advance; // Pen movement to the next glyph
+    std::vector<uint8_t, TaggedAllocator<uint8_t, MEM_TRUETYPE>> pixels;
+
+    /**
+     * @brief Get the bytes per row of pixels
+     * @return (width + 1) / 2
+     */
+    size_t getStride() const
+    {
+        return (width + 1) / 2;
+    }
+};
+
+/**
+ * @class TrueTypeFace
+ * @brief Glyph lookup and outlines of one TrueType font file
+ *
+ * The face reads straight from the file data, which must stay valid while
+ * the face is used. Only glyf-flavored fonts are supported (no CFF outlines).
+ */
+class TrueTypeFace
+{
+public:
+    // Vertical metrics in font units
+    struct Metrics
+    {
+        int unitsPerEm;
+        int ascender;  // Positive
+        int descender; // Negative
+        int lineGap;
+    };
+
+private:
+    const uint8_t *data;
+    size_t size;
+    uint32_t glyfOffset;
+    uint32_t locaOffset;
+    uint32_t hmtxOffset;
+    uint32_t cmapOffset; // Format 4 subtable
+    uint16_t glyphCount;
+    uint16_t hMetricCount;
+    bool longLoca;
+    Metrics metrics;
+
+    uint32_t findTable(const char *tag) const;
+    bool getGlyphRange(uint16_t glyph, uint32_t &offset, uint32_t &length) const;
+
+public:
+    // One outline point in font units
+    struct Point
+    {
+        int16_t x;
+        int16_t y;
+        bool onCurve;
+    };
+
+    // Glyph outline: contour end indexes into points, as in the glyf table
+    struct Outline
+    {
+        std::vector<Point, TaggedAllocator<Point, MEM_TRUETYPE>> points;
+        std::vector<uint16_t, TaggedAllocator<uint16_t, MEM_TRUETYPE>> contourEnds;
+        int16_t xMin, yMin, xMax, yMax;
+    };
+
+    /**
+     * @brief Constructor
+     */
+    TrueTypeFace();
+
+    /**
+     * @brief Parse the tables of a font file
+     * @param fontData Complete font file, kept by reference
+     * @param length Size of fontData in bytes
+     * @return false if a required table is missing or malformed
+     */
+    bool load(const uint8_t *fontData, size_t length);
+
+    /**
+     * @brief Check whether load() succeeded
+     * @return true if glyphs can be looked up
+     */
+    bool isLoaded() const;
+
+    /**
+     * @brief Get the vertical metrics
+     * @return Metrics in font units
+     */
+    const Metrics &getMetrics() const;
+
+    /**
+     * @brief Get the number of glyphs in the font
+     * @return Glyph count
+     */
+    uint16_t getGlyphCount() const;
+
+    /**
+     * @brief Map a codepoint to a glyph
+     * @param codepoint Unicode codepoint (the BMP only, as cmap format 4 covers)
+     * @return Glyph index, 0 (the missing glyph) if the font has none
+     */
+    uint16_t findGlyph(uint32_t codepoint) const;
+
+    /**
+     * @brief Get the horizontal metrics of a glyph
+     * @param glyph Glyph index
+     * @param advance Output, advance width in font units
+     * @param leftBearing Output, left side bearing in font units
+     */
+    void getHorizontalMetrics(uint16_t glyph, int &advance, int &leftBearing) const;
+
+    /**
+     * @brief Get the bounding box of a glyph without decoding its outline
+     * @param glyph Glyph index
+     * @param xMin, yMin, xMax, yMax Output, box in font units
+     * @return false for glyphs without outline, e.g. the space
+     */
+    bool getBounds(uint16_t glyph, int &xMin, int &yMin, int &xMax, int &yMax) const;
+
+    /**
+     * @brief Decode the outline of a glyph, flattening composite glyphs
+     * @param glyph Glyph index
+     * @param outline Output, cleared first
+     * @return false for glyphs without outline or malformed data
+     */
+    bool getOutline(uint16_t glyph, Outline &outline) const;
+
+private:
+    struct Transform; // Placement of a composite glyph's component
+
+    bool appendOutline(uint16_t glyph, Outline &outline, const Transform &transform, int depth) const;
+};
+
+/**
+ * @class GlyphRasterizer
+ * @brief Scales outlines and fills them with exact-area anti-aliasing
+ *
+ * Quadratic curves are flattened to lines, each line adds its signed area
+ * to a coverage accumulator, and a running sum over every row gives the
+ * coverage of each pixel. The accumulator and outline buffers are reused
+ * between glyphs.
+ */
+class GlyphRasterizer
+{
+private:
+    std::vector<float, TaggedAllocator<float, MEM_TRUETYPE>> coverage;
+    TrueTypeFace::Outline outline;
+    int width;
+    int height;
+
+    void addLine(float x0, float y0, float x1, float y1);
+    void addCurve(float x0, float y0, float cx, float cy, float x1, float y1);
+
+public:
+    /**
+     * @brief Constructor
+     */
+    GlyphRasterizer();
+
+    /**
+     * @brief Rasterize one glyph
+     * @param face Font face
+     * @param codepoint Unicode codepoint
+     * @param pixelsPerEm Size of the em square in pixels
+     * @param bitmap Output; an empty bitmap with just an advance for blank glyphs
+     * @return false if the face has no glyph for codepoint
+     */
+    bool rasterize(const TrueTypeFace &face, uint32_t codepoint, int pixelsPerEm, GlyphBitmap &bitmap);
+};
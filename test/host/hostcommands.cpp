@@ -0,0 +1,73 @@
+/**
+ * @file hostcommands.cpp
+ * @brief Serial commands that need the M5Dial hardware, answered on the host
+ * @date 2026-10-19
+ *
+ * In place of devicecommands.cpp: the commands are recognized, and reply
+ * with an error as a device built without the feature would. MEM sends the
+ * MemoryTracker table with no heap lines.
+ */
+
+#include "serialcommands.hpp"
+
+static const char NO_HARDWARE[] = "ERR not on the host";
+
+void SerialCommands::startRecording()
+{
+    stream->println(NO_HARDWARE);
+}
+
+void SerialCommands::sendRecordingStop()
+{
+    stream->println(NO_HARDWARE);
+}
+
+void SerialCommands::sendInputLog()
+{
+    stream->println(NO_HARDWARE);
+}
+
+void SerialCommands::sendReplayLatency()
+{
+    stream->println(NO_HARDWARE);
+}
+
+void SerialCommands::sendPushTiming()
+{
+    stream->println(NO_HARDWARE);
+}
+
+void SerialCommands::sendTrueTypeInfo()
+{
+    stream->println(NO_HARDWARE);
+}
+
+void SerialCommands::sendTrueTypeBenchmark()
+{
+    stream->println(NO_HARDWARE);
+}
+
+void SerialCommands::openEditor()
+{
+    stream->println(NO_HARDWARE);
+}
+
+void SerialCommands::sendEditTiming()
+{
+    stream->println(NO_HARDWARE);
+}
+
+// No targets, as without FANOUT_DISPLAY
+void SerialCommands::sendFanoutTiming()
+{
+    stream->println("OK 0");
+}
+
+void SerialCommands::resetFanout()
+{
+    stream->println("OK");
+}
+
+void SerialCommands::sendHeapReport()
+{
+}
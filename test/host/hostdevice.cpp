@@ -0,0 +1,353 @@
+/**
+ * @file hostdevice.cpp
+ * @brief The font catalog and a display for running FontDisplayManager on the host
+ * @date 2026-10-19
+ */
+
+#include "hostdevice.hpp"
+#include <string.h>
+#include <utility>
+
+// The catalog of the build profile, each font standing for itself
+template <size_t... Index>
+struct HostCatalog
+{
+    static constexpr FontInfo fonts[sizeof...(Index)] = {
+        {FONT_CATALOG_FONTS[Index].family, FONT_CATALOG_FONTS[Index].name, FONT_CATALOG_FONTS[Index].size,
+         &FONT_CATALOG_FONTS[Index]}...};
+};
+
+template <size_t... Index>
+static constexpr const FontInfo *hostCatalog(std::index_sequence<Index...>)
+{
+    return HostCatalog<Index...>::fonts;
+}
+
+const FontInfo *const fontCatalog = hostCatalog(std::make_index_sequence<FONT_CATALOG_FONT_COUNT>());
+
+// Every profile starts with the lgfx built-in fonts Font0 and Font2
+const void *const specimenSmallFont = &FONT_CATALOG_FONTS[0];
+const void *const specimenLabelFont = &FONT_CATALOG_FONTS[1];
+
+static int pixelSize(const CatalogFont &font)
+{
+    // lgfx built-in fonts are numbered 0..8, the rest sized in points
+    return font.size <= 8 ? 8 + font.size * 2 : font.size * 4 / 3;
+}
+
+int measureGlyphAdvance(const void *font, uint32_t codepoint)
+{
+    if (font == nullptr)
+    {
+        return 0;
+    }
+    const CatalogFont &entry = *static_cast<const CatalogFont *>(font);
+    int size = pixelSize(entry);
+    if (codepoint < 0x20 || codepoint > 0x7E)
+    {
+        return (entry.traits & FONT_TRAIT_CJK) ? size : 0;
+    }
+    return (entry.traits & FONT_TRAIT_MONO) ? size * 3 / 5 : size / 2 + (codepoint & 1);
+}
+
+int measureFontHeight(const void *font)
+{
+    if (font == nullptr)
+    {
+        return 0;
+    }
+    int size = pixelSize(*static_cast<const CatalogFont *>(font));
+    return size + size / 5;
+}
+
+bool measureFontVertical(const void *font, FontVerticalMetrics &metrics)
+{
+    if (font == nullptr)
+    {
+        return false;
+    }
+    int size = pixelSize(*static_cast<const CatalogFont *>(font));
+    metrics.height = measureFontHeight(font);
+    metrics.ascent = size;
+    metrics.descent = metrics.height - metrics.ascent;
+    metrics.xHeight = size / 2;
+    return true;
+}
+
+static uint32_t virtualClock = 0;
+
+uint32_t virtualMicros()
+{
+    return virtualClock;
+}
+
+void advanceVirtualClock(uint32_t micros)
+{
+    virtualClock += micros;
+}
+
+FrameBufferTarget::FrameBufferTarget(int targetWidth, int targetHeight) : width(targetWidth),
+                                                                         height(targetHeight),
+                                                                         pixels(new uint16_t[targetWidth * targetHeight]())
+{
+    clearClip();
+}
+
+FrameBufferTarget::~FrameBufferTarget()
+{
+    delete[] pixels;
+}
+
+const uint16_t *FrameBufferTarget::getRow(int y) const
+{
+    return pixels + y * width;
+}
+
+const char *FrameBufferTarget::getName() const
+{
+    return "frame buffer";
+}
+
+int FrameBufferTarget::getWidth() const
+{
+    return width;
+}
+
+int FrameBufferTarget::getHeight() const
+{
+    return height;
+}
+
+void FrameBufferTarget::fill(uint16_t color)
+{
+    fillRect(0, 0, width, height, color);
+}
+
+void FrameBufferTarget::fillRect(int x, int y, int w, int h, uint16_t color)
+{
+    int left = x > clipLeft ? x : clipLeft;
+    int top = y > clipTop ? y : clipTop;
+    int right = x + w < clipRight ? x + w : clipRight;
+    int bottom = y + h < clipBottom ? y + h : clipBottom;
+    uint16_t swapped = (uint16_t)((color >> 8) | (color << 8));
+    for (int row = top; row < bottom; row++)
+    {
+        for (int column = left; column < right; column++)
+        {
+            pixels[row * width + column] = swapped;
+        }
+    }
+}
+
+void FrameBufferTarget::drawHLine(int x, int y, int w, uint16_t color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+void FrameBufferTarget::drawText(const void *font, const char *text, int x, int y, uint8_t datum, uint16_t color,
+                                 float scale)
+{
+    FontVerticalMetrics metrics;
+    if (!measureFontVertical(font, metrics))
+    {
+        return;
+    }
+
+    // Lead bytes only; the synthetic fonts have no glyphs past ASCII but CJK boxes
+    int textWidth = 0;
+    for (const char *p = text; *p != 0; p++)
+    {
+        uint8_t byte = (uint8_t)*p;
+        if ((byte & 0xC0) != 0x80)
+        {
+            textWidth += measureGlyphAdvance(font, byte < 0x80 ? byte : 0x4E00);
+        }
+    }
+
+    // textdatum_t: the low two bits place x (left, center, right), the next two y (top, middle, bottom)
+    int boxWidth = (int)(textWidth * scale);
+    int boxHeight = (int)(metrics.height * scale);
+    int left = x - ((datum & 3) == 1 ? boxWidth / 2 : (datum & 3) == 2 ? boxWidth : 0);
+    int top = y - ((datum >> 2) == 1 ? boxHeight / 2 : (datum >> 2) == 2 ? boxHeight : 0);
+    int glyphHeight = (int)(metrics.ascent * scale);
+    for (const char *p = text; *p != 0; p++)
+    {
+        uint8_t byte = (uint8_t)*p;
+        if ((byte & 0xC0) == 0x80)
+        {
+            continue;
+        }
+        int advance = (int)(measureGlyphAdvance(font, byte < 0x80 ? byte : 0x4E00) * scale);
+        if (byte != ' ')
+        {
+            fillRect(left, top, advance > 1 ? advance - 1 : advance, glyphHeight, color);
+        }
+        left += advance;
+    }
+}
+
+void FrameBufferTarget::setClip(int x, int y, int w, int h)
+{
+    clipLeft = x > 0 ? x : 0;
+    clipTop = y > 0 ? y : 0;
+    clipRight = x + w < width ? x + w : width;
+    clipBottom = y + h < height ? y + h : height;
+}
+
+void FrameBufferTarget::clearClip()
+{
+    setClip(0, 0, width, height);
+}
+
+HeadlessDevice::HeadlessDevice(const Costs &frameCosts, int displayWidth, int displayHeight) : width(displayWidth),
+                                                                                              height(displayHeight),
+                                                                                              costs(frameCosts),
+                                                                                              pacer(50),
+                                                                                              target(nullptr),
+                                                                                              frameBuffer(nullptr)
+{
+    reset();
+}
+
+void HeadlessDevice::reset()
+{
+    transitionPending = false;
+    transitionActive = false;
+    transitionStart = 0;
+    fontFrames = 0;
+    pageFrames = 0;
+    transitions = 0;
+    transitionFrames = 0;
+    lastFontName = nullptr;
+}
+
+size_t HeadlessDevice::getFontFrames() const
+{
+    return fontFrames;
+}
+
+size_t HeadlessDevice::getPageFrames() const
+{
+    return pageFrames;
+}
+
+size_t HeadlessDevice::getTransitions() const
+{
+    return transitions;
+}
+
+size_t HeadlessDevice::getTransitionFrames() const
+{
+    return transitionFrames;
+}
+
+const char *HeadlessDevice::getLastFontName() const
+{
+    return lastFontName;
+}
+
+void HeadlessDevice::setTarget(DisplayTarget *drawTarget)
+{
+    target = drawTarget;
+    frameBuffer = nullptr;
+}
+
+void HeadlessDevice::setTarget(FrameBufferTarget &drawTarget)
+{
+    target = &drawTarget;
+    frameBuffer = &drawTarget;
+}
+
+void HeadlessDevice::clearDisplay()
+{
+}
+
+int HeadlessDevice::getDisplayWidth() const
+{
+    return width;
+}
+
+int HeadlessDevice::getDisplayHeight() const
+{
+    return height;
+}
+
+void HeadlessDevice::displayFont(const char *familyName, const char *fontName, int fontSize, const void *fontPtr,
+                                 const char *sampleText)
+{
+    if (target != nullptr)
+    {
+        frameList.reset(width, height);
+        renderer.renderFont(frameList, DIAL_STYLE, familyName, fontName, fontSize, fontPtr, sampleText);
+        replayDisplayList(frameList, *target);
+    }
+    advanceVirtualClock(costs.fontUs);
+    fontFrames++;
+    lastFontName = fontName;
+
+    bool animate = transitionPending;
+    transitionPending = false;
+    if (animate)
+    {
+        transitionActive = true;
+        transitionStart = virtualMicros();
+        transitions++;
+        pacer.restart();
+        pacer.resetStats();
+        updateTransition(false);
+    }
+}
+
+void HeadlessDevice::displayFontPage(const FontInfo *fonts, int count, int slots, const char *sampleText,
+                                     int pageIndex, int pageCount)
+{
+    if (target != nullptr)
+    {
+        frameList.reset(width, height);
+        renderer.renderFontPage(frameList, DIAL_STYLE, fonts, count, slots, sampleText, pageIndex, pageCount);
+        replayDisplayList(frameList, *target);
+    }
+    advanceVirtualClock(costs.pageUs);
+    pageFrames++;
+}
+
+void HeadlessDevice::setTransition(int direction, float velocity)
+{
+    (void)velocity;
+    transitionPending = (direction != 0);
+}
+
+bool HeadlessDevice::updateTransition(bool hurry)
+{
+    if (!transitionActive)
+    {
+        return false;
+    }
+
+    uint32_t now = virtualMicros();
+    if (!hurry && !pacer.isFrameDue(now))
+    {
+        return true;
+    }
+
+    pacer.beginFrame(now);
+    advanceVirtualClock(costs.transitionFrameUs);
+    transitionFrames++;
+    pacer.endFrame(virtualMicros());
+
+    if (hurry || now - transitionStart >= costs.transitionUs)
+    {
+        transitionActive = false;
+    }
+    return transitionActive;
+}
+
+bool HeadlessDevice::readFrameRow(int y, uint16_t *pixels)
+{
+    if (frameBuffer == nullptr)
+    {
+        return false;
+    }
+    memcpy(pixels, frameBuffer->getRow(y), width * sizeof(uint16_t));
+    return true;
+}
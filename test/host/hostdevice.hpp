@@ -0,0 +1,172 @@
+/**
+ * @file hostdevice.hpp
+ * @brief The font catalog and a display for running FontDisplayManager on the host
+ * @date 2026-10-19
+ *
+ * On the device fontmanager.cpp and specimen.cpp get their fonts and the
+ * measuring from lgfxfonts.cpp. Here each fontCatalog entry points at its
+ * CatalogFont, which the measuring functions give synthetic metrics from
+ * its size, and HeadlessDevice stands in for the panel: it spends the time
+ * each frame costs on a virtual clock, and builds and replays the frames
+ * when given a DisplayTarget. A FrameBufferTarget keeps the pixels, for
+ * SHOT to read back.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "displaylist.hpp"
+#include "fontmanager.hpp"
+#include "framepacer.hpp"
+#include "specimen.hpp"
+
+/**
+ * @brief Get the virtual wall time the headless device works and waits on
+ * @return Microseconds; matches FontDisplayManager::ClockFunc
+ */
+uint32_t virtualMicros();
+
+/**
+ * @brief Let virtual time pass, for work done or time waited
+ * @param micros Microseconds
+ */
+void advanceVirtualClock(uint32_t micros);
+
+/**
+ * @class FrameBufferTarget
+ * @brief DisplayTarget that draws into RGB565 pixels in memory
+ *
+ * Fills and lines are exact. Text has no glyph shapes: each glyph is a box
+ * as wide as its advance and as tall as the font's ascent, which is enough
+ * for fonts, texts and layouts to give different frames.
+ */
+class FrameBufferTarget : public DisplayTarget
+{
+private:
+    int width;
+    int height;
+    uint16_t *pixels; // Byte-swapped, as in an lgfx sprite
+    int clipLeft;
+    int clipTop;
+    int clipRight;
+    int clipBottom;
+
+public:
+    /**
+     * @brief Constructor
+     * @param targetWidth Width in pixels
+     * @param targetHeight Height in pixels
+     */
+    FrameBufferTarget(int targetWidth = 240, int targetHeight = 240);
+    ~FrameBufferTarget() override;
+
+    FrameBufferTarget(const FrameBufferTarget &) = delete;
+    FrameBufferTarget &operator=(const FrameBufferTarget &) = delete;
+
+    /**
+     * @brief Get one row of the frame
+     * @param y Row, 0 to getHeight() - 1
+     * @return getWidth() pixels of RGB565, most significant byte first
+     */
+    const uint16_t *getRow(int y) const;
+
+    // DisplayTarget implementation
+    const char *getName() const override;
+    int getWidth() const override;
+    int getHeight() const override;
+    void fill(uint16_t color) override;
+    void fillRect(int x, int y, int w, int h, uint16_t color) override;
+    void drawHLine(int x, int y, int w, uint16_t color) override;
+    void drawText(const void *font, const char *text, int x, int y, uint8_t datum, uint16_t color,
+                  float scale) override;
+    void setClip(int x, int y, int w, int h) override;
+    void clearClip() override;
+};
+
+/**
+ * @class HeadlessDevice
+ * @brief DeviceInterface without a panel
+ *
+ * Font frames, overview pages and transition frames each advance the
+ * virtual clock by their cost. With a target, font frames and pages are
+ * laid out by a SpecimenRenderer and replayed onto it, as M5DialDevice
+ * does into its sprites. Transitions are paced like
+ * M5DialDevice::updateTransition(): a FramePacer decides when a frame is
+ * due, the slide lasts a fixed wall time and a hurried one ends at once.
+ * The frame can be read back when the target is a FrameBufferTarget.
+ */
+class HeadlessDevice : public DeviceInterface
+{
+public:
+    // Virtual time the drawing takes
+    struct Costs
+    {
+        uint32_t fontUs;            // A font frame composed and pushed
+        uint32_t pageUs;            // An overview page
+        uint32_t transitionFrameUs; // One frame of a slide
+        uint32_t transitionUs;      // Wall time a slide lasts
+    };
+
+private:
+    int width;
+    int height;
+    Costs costs;
+    FramePacer pacer;
+    bool transitionPending;
+    bool transitionActive;
+    uint32_t transitionStart;
+    size_t fontFrames;
+    size_t pageFrames;
+    size_t transitions;
+    size_t transitionFrames;
+    const char *lastFontName;
+    DisplayTarget *target;
+    const FrameBufferTarget *frameBuffer;
+    SpecimenRenderer renderer;
+    DisplayList frameList;
+
+public:
+    /**
+     * @brief Constructor
+     * @param frameCosts Virtual time of each kind of frame
+     * @param displayWidth Width reported to the manager
+     * @param displayHeight Height reported to the manager
+     */
+    HeadlessDevice(const Costs &frameCosts, int displayWidth = 240, int displayHeight = 240);
+
+    /**
+     * @brief Draw the frames on a target, or only take their time
+     * @param drawTarget Target of the DIAL_STYLE frames, or nullptr
+     */
+    void setTarget(DisplayTarget *drawTarget);
+
+    /**
+     * @brief Draw the frames into pixels that readFrameRow() returns
+     * @param drawTarget Target of the DIAL_STYLE frames, of the display's size
+     */
+    void setTarget(FrameBufferTarget &drawTarget);
+
+    /**
+     * @brief Zero the frame counts and drop any running transition
+     */
+    void reset();
+
+    size_t getFontFrames() const;       // displayFont() calls
+    size_t getPageFrames() const;       // displayFontPage() calls
+    size_t getTransitions() const;      // Slides started
+    size_t getTransitionFrames() const; // Slide frames drawn
+    const char *getLastFontName() const; // Font of the last displayFont(), or nullptr
+
+    // DeviceInterface implementation
+    void clearDisplay() override;
+    int getDisplayWidth() const override;
+    int getDisplayHeight() const override;
+    void displayFont(const char *familyName, const char *fontName, int fontSize, const void *fontPtr,
+                     const char *sampleText) override;
+    void displayFontPage(const FontInfo *fonts, int count, int slots, const char *sampleText, int pageIndex,
+                         int pageCount) override;
+    void setTransition(int direction, float velocity) override;
+    bool updateTransition(bool hurry) override;
+    bool readFrameRow(int y, uint16_t *pixels) override;
+};
@@ -0,0 +1,45 @@
+/**
+ * @file hosttest.hpp
+ * @brief Checks and timing shared by the host tests
+ * @date 2026-10-19
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+static int hostTestFailures = 0;
+
+// Report a failed condition and carry on, so one run shows every failure
+#define CHECK(condition)                                                          \
+    do                                                                            \
+    {                                                                             \
+        if (!(condition))                                                         \
+        {                                                                         \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            hostTestFailures++;                                                   \
+        }                                                                         \
+    } while (0)
+
+/**
+ * @brief Get a monotonic time for benchmarks
+ * @return Microseconds since an arbitrary start
+ */
+inline uint32_t hostMicros()
+{
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Print the result of a test program
+ * @param name Test name
+ * @return Exit status for main()
+ */
+inline int finishHostTest(const char *name)
+{
+    printf("%s: %s (%d failed checks)\n", name, hostTestFailures == 0 ? "PASS" : "FAIL", hostTestFailures);
+    return hostTestFailures == 0 ? 0 : 1;
+}
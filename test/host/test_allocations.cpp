@@ -0,0 +1,260 @@
+/**
+ * @file test_allocations.cpp
+ * @brief Tagged heap accounting, and no heap use on the encoder-to-render path
+ * @date 2026-10-19
+ *
+ * Replaces the global operator new and delete with counting versions. The
+ * steady-state part turns the dial once fonts and texts are loaded: the real
+ * FontDisplayManager::update() has the specimen frame (or overview page)
+ * laid out by a SpecimenRenderer into a DisplayList, from stored layouts or
+ * laid out live, and replayed onto a target that only counts, as the
+ * headless device of hostdevice.hpp does.
+ */
+
+#include "hosttest.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <vector>
+#include "displaylist.hpp"
+#include "fontmanager.hpp"
+#include "hostdevice.hpp"
+#include "layoutstore.hpp"
+#include "memorytracker.hpp"
+#include "sampletexts.hpp"
+#include "specimen.hpp"
+#include "textlayout.hpp"
+
+static size_t heapAllocations = 0;
+
+void *operator new(size_t bytes)
+{
+    heapAllocations++;
+    void *ptr = malloc(bytes ? bytes : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t bytes)
+{
+    return operator new(bytes);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+static int measureFixed(const void *font, uint32_t codepoint)
+{
+    return *static_cast<const int *>(font) + (codepoint & 1);
+}
+
+static void testTaggedAccounting()
+{
+    const MemoryTag tag = MEM_SPRITES;
+    CHECK(memoryTracker.getCurrent(tag, MEM_INTERNAL) == 0);
+
+    size_t before = heapAllocations;
+    void *first = trackedAlloc(tag, 1000);
+    void *second = trackedAlloc(tag, 500);
+    CHECK(heapAllocations == before + 2);
+    CHECK(memoryTracker.getCurrent(tag, MEM_INTERNAL) == 1500);
+    CHECK(memoryTracker.getPeak(tag, MEM_INTERNAL) == 1500);
+    CHECK(memoryTracker.getAllocationCount(tag) == 2);
+
+    // Freeing lowers the live count; the high-water mark stays
+    trackedFree(tag, first, 1000);
+    CHECK(memoryTracker.getCurrent(tag, MEM_INTERNAL) == 500);
+    void *third = trackedAlloc(tag, 200);
+    CHECK(memoryTracker.getCurrent(tag, MEM_INTERNAL) == 700);
+    CHECK(memoryTracker.getPeak(tag, MEM_INTERNAL) == 1500);
+    trackedFree(tag, second, 500);
+    trackedFree(tag, third, 200);
+    trackedFree(tag, nullptr, 100);
+    CHECK(memoryTracker.getCurrent(tag, MEM_INTERNAL) == 0);
+    CHECK(memoryTracker.getPeak(tag, MEM_INTERNAL) == 1500);
+    CHECK(memoryTracker.getAllocationCount(tag) == 3);
+    CHECK(memoryTracker.getPeak(tag, MEM_PSRAM) == 0);
+
+    // Containers are charged to their tag, nothing leaks to the neighbours
+    {
+        std::vector<uint32_t, TaggedAllocator<uint32_t, MEM_DISPLAY_LIST>> list;
+        list.reserve(100);
+        CHECK(memoryTracker.getCurrent(MEM_DISPLAY_LIST, MEM_INTERNAL) == 100 * sizeof(uint32_t));
+        list.resize(300);
+        CHECK(memoryTracker.getCurrent(MEM_DISPLAY_LIST, MEM_INTERNAL) == list.capacity() * sizeof(uint32_t));
+        CHECK(memoryTracker.getPeak(MEM_DISPLAY_LIST, MEM_INTERNAL) >= 400 * sizeof(uint32_t));
+    }
+    CHECK(memoryTracker.getCurrent(MEM_DISPLAY_LIST, MEM_INTERNAL) == 0);
+    CHECK(memoryTracker.getCurrent(tag, MEM_INTERNAL) == 0);
+
+    // Layout text, codepoints and lines all go to the text layout tag
+    size_t layoutBefore = memoryTracker.getCurrent(MEM_TEXT_LAYOUT, MEM_INTERNAL);
+    {
+        int advance = 7;
+        GlyphWidthTable widths;
+        widths.reset(&advance, measureFixed);
+        TextLayout layout;
+        layout.setText("Pack my box with five dozen liquor jugs");
+        layout.layout(widths, 60);
+        CHECK(memoryTracker.getCurrent(MEM_TEXT_LAYOUT, MEM_INTERNAL) > layoutBefore);
+        // 256-byte width pages, one per block of codepoints seen
+        CHECK(widths.getPageCount() > 0);
+        CHECK(memoryTracker.getCurrent(MEM_GLYPH_WIDTHS, MEM_INTERNAL) == widths.getPageCount() * 256);
+    }
+    CHECK(memoryTracker.getCurrent(MEM_TEXT_LAYOUT, MEM_INTERNAL) == layoutBefore);
+    CHECK(memoryTracker.getCurrent(MEM_GLYPH_WIDTHS, MEM_INTERNAL) == 0);
+
+    char report[1024];
+    size_t length = memoryTracker.format(report, sizeof(report));
+    CHECK(length == strlen(report));
+    CHECK(strstr(report, "sprites") != nullptr);
+    fputs(report, stdout);
+}
+
+// A panel that only counts what it is asked to draw
+class CountingTarget : public DisplayTarget
+{
+public:
+    size_t frames = 0;
+    size_t ops = 0;
+
+    const char *getName() const override
+    {
+        return "counting";
+    }
+    int getWidth() const override
+    {
+        return 240;
+    }
+    int getHeight() const override
+    {
+        return 240;
+    }
+    void endFrame() override
+    {
+        frames++;
+    }
+    void fill(uint16_t) override
+    {
+        ops++;
+    }
+    void fillRect(int, int, int, int, uint16_t) override
+    {
+        ops++;
+    }
+    void drawHLine(int, int, int, uint16_t) override
+    {
+        ops++;
+    }
+    void drawText(const void *, const char *, int, int, uint8_t, uint16_t, float) override
+    {
+        ops++;
+    }
+    void setClip(int, int, int, int) override
+    {
+        ops++;
+    }
+    void clearClip() override
+    {
+        ops++;
+    }
+};
+
+static void testSteadyStateHotPath()
+{
+    // The sample texts laid out for every font at boot, as prepareLayouts() does
+    CountingTarget target;
+    static HeadlessDevice device({0, 0, 0, 0});
+    device.setTarget(&target);
+    fontManager.setDevice(&device);
+    std::vector<const void *> fonts;
+    for (int i = 0; i < fontManager.getTotalFonts(); i++)
+    {
+        fonts.push_back(fontManager.getFontAt(i)->fontPtr);
+    }
+    layoutStore.bind(fonts.data(), fonts.size(), sampleTextStore.getTexts(), sampleTextStore.getCount(),
+                     device.getDisplayWidth() - SpecimenRenderer::WRAP_MARGIN);
+    layoutStore.build(measureGlyphAdvance);
+
+    // An edited text is not in the store and is laid out live
+    static const char editedText[] = "Edited: sphinx of black quartz, judge my vow 0123456789";
+    const size_t textCount = sampleTextStore.getCount() + 1;
+    long position = 0;
+    uint32_t now = 0;
+
+    // One detent: the dial moves on, now and then with a new text or in overview
+    auto detent = [&](int step)
+    {
+        if (step % 11 == 0)
+        {
+            size_t text = (step / 11) % textCount;
+            fontManager.setSampleText(text < sampleTextStore.getCount() ? sampleTextStore.select(text) : editedText);
+        }
+        if (step % 97 == 0)
+        {
+            fontManager.setOverviewMode(!fontManager.isOverviewMode());
+        }
+        position += (step % 3 == 2) ? -1 : 2;
+        now += 40;
+        fontManager.update(position, now);
+    };
+
+    // Warm up: every font and page with every text, so each width table page and the largest frame are seen
+    for (size_t text = 0; text < textCount; text++)
+    {
+        fontManager.setSampleText(text < sampleTextStore.getCount() ? sampleTextStore.select(text) : editedText);
+        for (int font = 0; font < fontManager.getTotalFonts(); font++)
+        {
+            fontManager.selectFont(font);
+            fontManager.update(position, now);
+        }
+        fontManager.setOverviewMode(true);
+        for (int page = 0; page < fontManager.getPageCount(); page++)
+        {
+            fontManager.update(++position, now);
+        }
+        fontManager.setOverviewMode(false);
+    }
+
+    size_t framesBefore = target.frames;
+    size_t opsBefore = target.ops;
+    size_t before = heapAllocations;
+    for (int step = 0; step < 1000; step++)
+    {
+        detent(step);
+    }
+    size_t steadyAllocations = heapAllocations - before;
+    printf("1000 detents after warm-up: %zu frames of %zu ops through FontDisplayManager, SpecimenRenderer and "
+           "replayDisplayList, %zu heap allocations\n",
+           target.frames - framesBefore, target.ops - opsBefore, steadyAllocations);
+    CHECK(target.frames - framesBefore == 1000);
+    CHECK(device.getPageFrames() > 0);
+    CHECK(steadyAllocations == 0);
+}
+
+int main()
+{
+    testTaggedAccounting();
+    testSteadyStateHotPath();
+    return finishHostTest("test_allocations");
+}
@@ -0,0 +1,107 @@
+/**
+ * @file test_boot.cpp
+ * @brief Host run of the background boot with its phase timing report
+ * @date 2026-10-19
+ *
+ * Runs the portable part of bootTask() twice against the catalog of the
+ * build profile and data/samples.txt: a first boot that builds and saves the
+ * layouts, then a boot that loads them. Glyph advances are derived from the
+ * font size, as the bitmap fonts are not available here. The memory report
+ * the firmware logs when the boot completes follows.
+ *
+ * Usage: test_boot <samples.txt>
+ */
+
+#include "hosttest.hpp"
+#include <string.h>
+#include <vector>
+#include "bootprofile.hpp"
+#include "fnv1a.hpp"
+#include "fontcatalog.hpp"
+#include "layoutstore.hpp"
+#include "memorytracker.hpp"
+#include "sampletexts.hpp"
+
+static const char *const LAYOUT_PATH = "test_boot_layouts.bin";
+static const int WRAP_WIDTH = 220; // M5DialDevice::getWrapWidth()
+
+static int measureBySize(const void *font, uint32_t codepoint)
+{
+    const CatalogFont *entry = static_cast<const CatalogFont *>(font);
+    int size = entry->size > 4 ? entry->size : 8;
+    return (codepoint < 0x2E80) ? (size * 3 + 4) / 5 : size;
+}
+
+// bootTask() without the device: returns true if the layouts came from the file
+static bool boot(const char *samplesPath, BootProfile &profile)
+{
+    profile.begin(hostMicros());
+
+    SampleTextStore texts;
+    size_t count = texts.load(samplesPath);
+    profile.mark("sample texts", hostMicros());
+
+    // prepareLayouts(): the fonts are read straight from the catalog
+    std::vector<const void *> fonts;
+    uint32_t catalogHash = FNV1A_SEED;
+    for (int i = 0; i < FONT_CATALOG_FONT_COUNT; i++)
+    {
+        fonts.push_back(&FONT_CATALOG_FONTS[i]);
+        catalogHash = fnv1aString(FONT_CATALOG_FONTS[i].name, catalogHash);
+    }
+    LayoutStore layouts;
+    layouts.bind(fonts.data(), fonts.size(), texts.getTexts(), count, WRAP_WIDTH);
+    bool loaded = layouts.load(LAYOUT_PATH, catalogHash, texts.getHash());
+    if (!loaded)
+    {
+        layouts.build(measureBySize);
+        CHECK(layouts.save(LAYOUT_PATH, catalogHash, texts.getHash()));
+    }
+    profile.mark("layouts", hostMicros());
+
+    // The first font is ready to draw from the stored layout
+    size_t lines = 0;
+    CHECK(layouts.find(fonts[0], texts.getText(0), WRAP_WIDTH, lines) != nullptr && lines > 0);
+    return loaded;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        printf("usage: test_boot <samples.txt>\n");
+        return 2;
+    }
+    remove(LAYOUT_PATH);
+
+    char report[512];
+    BootProfile firstBoot("Boot (background, first):");
+    CHECK(!boot(argv[1], firstBoot));
+    firstBoot.format(report, sizeof(report));
+    fputs(report, stdout);
+
+    BootProfile nextBoot("Boot (background, layouts cached):");
+    CHECK(boot(argv[1], nextBoot));
+    size_t length = nextBoot.format(report, sizeof(report));
+    fputs(report, stdout);
+
+    CHECK(nextBoot.getPhaseCount() == 2);
+    CHECK(strstr(report, "  layouts ") != nullptr);
+    CHECK(length == strlen(report));
+
+    // MEM: every boot subsystem was charged for what it held
+    char memoryReport[1024];
+    memoryTracker.format(memoryReport, sizeof(memoryReport));
+    fputs(memoryReport, stdout);
+    CHECK(memoryTracker.getPeak(MEM_SAMPLE_TEXTS, MEM_INTERNAL) > 0);
+    CHECK(memoryTracker.getPeak(MEM_LAYOUT_STORE, MEM_INTERNAL) > 0);
+    CHECK(memoryTracker.getCurrent(MEM_LAYOUT_STORE, MEM_INTERNAL) == 0);
+
+    // A report too long for the buffer is cut off, still terminated
+    char small[40];
+    CHECK(nextBoot.format(small, sizeof(small)) == sizeof(small) - 1);
+    CHECK(strlen(small) == sizeof(small) - 1);
+
+    remove(LAYOUT_PATH);
+    return finishHostTest("test_boot");
+}
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+scripts/contact_sheet.py against the firmware's command protocol, served by
+test_serialprotocol --serve on a pseudo-terminal.
+
+The script's own Device client sets the text, lists the fonts, selects and
+renders some of them and reads their frames back with SHOT. Frames of
+different fonts must differ. With Pillow installed the whole contact sheet
+is drawn as well; pyserial is not needed, the terminal is read directly.
+
+Usage: test_contact_sheet.py <test_serialprotocol> <repo root>
+"""
+
+import os
+import select
+import subprocess
+import sys
+import tty
+
+failed = 0
+
+
+def check(condition, text):
+    global failed
+    if not condition:
+        print(f"check failed: {text}")
+        failed += 1
+
+
+class TerminalLink:
+    """The parts of pyserial's Serial that contact_sheet.Device uses, on a tty"""
+
+    def __init__(self, path, timeout):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        self.timeout = timeout
+        self.pending = b""
+
+    def close(self):
+        os.close(self.fd)
+
+    def write(self, data):
+        os.write(self.fd, data)
+
+    def fill(self):
+        ready, _, _ = select.select([self.fd], [], [], self.timeout)
+        if not ready:
+            return False
+        self.pending += os.read(self.fd, 4096)
+        return True
+
+    def read(self, size):
+        while len(self.pending) < size and self.fill():
+            pass
+        data, self.pending = self.pending[:size], self.pending[size:]
+        return data
+
+    def readline(self):
+        while b"\n" not in self.pending and self.fill():
+            pass
+        end = self.pending.find(b"\n") + 1 or len(self.pending)
+        line, self.pending = self.pending[:end], self.pending[end:]
+        return line
+
+
+def main():
+    device_program = sys.argv[1]
+    root = os.path.abspath(sys.argv[2] if len(sys.argv) > 2 else os.path.join(os.path.dirname(__file__), "..", ".."))
+    sys.path.insert(0, os.path.join(root, "scripts"))
+    import contact_sheet
+
+    server = subprocess.Popen([device_program, "--serve"], stdout=subprocess.PIPE, text=True)
+    try:
+        banner = server.stdout.readline().strip()
+        check(banner.startswith("Headless device on "), f"serve banner: {banner!r}")
+        link = TerminalLink(banner.rsplit(" ", 1)[-1], 5.0)
+        device = contact_sheet.Device(link)
+
+        device.command("TEXT Sphinx of black quartz")
+        fonts = device.list_fonts()
+        check(len(fonts) > 3, f"fonts listed: {len(fonts)}")
+        check([font[0] for font in fonts] == list(range(len(fonts))), "font ids in catalog order")
+
+        frames = []
+        for font_id, _, _, name in fonts[:3]:
+            status, _ = device.command(f"FONT {font_id}")
+            check(status == f"OK {font_id} {name}", f"FONT {font_id}: {status}")
+            status, _ = device.command("RENDER")
+            check(status.startswith("OK ") and status.endswith(" us"), f"RENDER: {status}")
+            width, height, rows = device.read_frame()
+            check((width, height) == (240, 240), f"frame size {width}x{height}")
+            check(len(rows) == height and all(len(row) == width for row in rows), "every row decoded")
+            frames.append(rows)
+        check(frames[0] != frames[1] and frames[1] != frames[2], "each font gives its own frame")
+
+        try:
+            import PIL  # noqa: F401
+        except ImportError:
+            print("Pillow not installed, contact sheet not drawn")
+        else:
+            sheet, count = contact_sheet.make_sheet(device, 6, 0.5, log=lambda line: None)
+            check(count == len(fonts), f"sheet has {count} of {len(fonts)} fonts")
+            check(sheet.width == 6 * 120, f"sheet width {sheet.width}")
+            print(f"Contact sheet of {count} fonts, {sheet.width}x{sheet.height}")
+        link.close()
+    finally:
+        server.kill()
+        server.wait()
+
+    status = "PASS" if failed == 0 else "FAIL"
+    print(f"test_contact_sheet: {status} ({failed} failed checks)")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,255 @@
+/**
+ * @file test_displayfanout.cpp
+ * @brief One display list per frame, drawn by two targets on their own threads
+ * @date 2026-10-19
+ *
+ * Frames shaped like the specimen frames (fill, labels, wrapped lines,
+ * clipped page rows) are published to a DisplayFanout with two recording
+ * targets of the dial's size, as FanoutDevice does. Both must receive the
+ * same ops for every frame they draw, and the last frame must reach both.
+ * One target is slow: it skips frames instead of holding up the producer or
+ * the other target. A target sharing its panel holds a lock for the whole
+ * frame, so a reader taking the same lock (the SHOT command) never sees a
+ * half-drawn frame.
+ */
+
+#include "hosttest.hpp"
+#include <stdarg.h>
+#include <string.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "displayfanout.hpp"
+
+static const int FRAME_SIZE = 240; // The dial's panel
+static const int FRAMES = 60;
+static const char FONT_A = 'A'; // Stand-ins for lgfx::IFont pointers
+static const char FONT_B = 'B';
+
+// Records every op of a frame as a line of text
+class RecordingTarget : public DisplayTarget
+{
+private:
+    const char *name;
+    int drawMicros; // Time one frame takes to draw
+    std::recursive_mutex *panelLock;
+    std::string current;
+
+public:
+    std::vector<std::string> frames; // Ops of each frame drawn
+    bool complete;                   // The panel shows a whole frame
+
+    RecordingTarget(const char *targetName, int frameMicros, std::recursive_mutex *lock = nullptr)
+        : name(targetName), drawMicros(frameMicros), panelLock(lock), complete(true)
+    {
+    }
+
+    const char *getName() const override
+    {
+        return name;
+    }
+
+    int getWidth() const override
+    {
+        return FRAME_SIZE;
+    }
+
+    int getHeight() const override
+    {
+        return FRAME_SIZE;
+    }
+
+    void beginFrame() override
+    {
+        if (panelLock != nullptr)
+        {
+            panelLock->lock();
+        }
+        current.clear();
+        complete = false;
+    }
+
+    void endFrame() override
+    {
+        if (drawMicros > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(drawMicros));
+        }
+        frames.push_back(current);
+        complete = true;
+        if (panelLock != nullptr)
+        {
+            panelLock->unlock();
+        }
+    }
+
+    void record(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char op[160];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(op, sizeof(op), format, args);
+        va_end(args);
+        current += op;
+        current += '\n';
+    }
+
+    void fill(uint16_t color) override
+    {
+        record("fill %04x", color);
+    }
+
+    void fillRect(int x, int y, int w, int h, uint16_t color) override
+    {
+        record("rect %d %d %d %d %04x", x, y, w, h, color);
+    }
+
+    void drawHLine(int x, int y, int w, uint16_t color) override
+    {
+        record("hline %d %d %d %04x", x, y, w, color);
+    }
+
+    void drawText(const void *font, const char *text, int x, int y, uint8_t datum, uint16_t color,
+                  float scale) override
+    {
+        record("text %c %d %d %u %04x %.2f %s", *static_cast<const char *>(font), x, y, datum, color, scale, text);
+    }
+
+    void setClip(int x, int y, int w, int h) override
+    {
+        record("clip %d %d %d %d", x, y, w, h);
+    }
+
+    void clearClip() override
+    {
+        record("unclip");
+    }
+};
+
+static uint32_t clockMicros()
+{
+    return hostMicros();
+}
+
+// A specimen frame or a page of fonts, with the frame number in its header
+static void buildFrame(DisplayList &list, int frame)
+{
+    char label[32];
+    list.fill(0x0000);
+    snprintf(label, sizeof(label), "Frame: %d", frame);
+    list.text(&FONT_A, label, 80, 12, 0, 0x07E0);
+    if (frame % 5 == 4)
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            int top = 24 + row * 48;
+            list.hline(20, top, 200, 0x7BEF);
+            list.clip(20, top + 9, 200, 39);
+            list.text(&FONT_B, "The quick brown fox", 20, top + 28, 3, 0xFFFF);
+            list.unclip();
+        }
+        return;
+    }
+    list.text(&FONT_B, "The quick brown", 120, 108, 4, 0xFFFF);
+    list.text(&FONT_B, "fox jumps", 120, 132, 4, 0xFFFF);
+    list.fillRect(110, 200, 20, 4, 0xFFE0);
+}
+
+// Whether every frame drawn is one of the published frames, in published order
+static bool inPublishedOrder(const std::vector<std::string> &drawn, const std::vector<std::string> &published)
+{
+    size_t next = 0;
+    for (const std::string &frame : drawn)
+    {
+        while (next < published.size() && published[next] != frame)
+        {
+            next++;
+        }
+        if (next == published.size())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    // Two targets of the dial's size; one takes as long as an SPI panel, the other ten times longer
+    std::recursive_mutex panelLock;
+    RecordingTarget dial("dial", 2000, &panelLock);
+    RecordingTarget mirror("mirror", 20000);
+    DisplayFanout fanout(clockMicros);
+    CHECK(fanout.addTarget(dial) == 0);
+    CHECK(fanout.addTarget(mirror) == 1);
+    CHECK(fanout.getTargetCount() == 2);
+
+    // The producer publishes a frame every 3 ms, faster than the mirror draws
+    std::vector<std::string> published;
+    uint32_t slowestPublish = 0;
+    std::thread reader(
+        [&]
+        {
+            // SHOT: every read holding the panel lock sees a whole frame
+            for (int i = 0; i < 200; i++)
+            {
+                {
+                    std::lock_guard<std::recursive_mutex> lock(panelLock);
+                    CHECK(dial.complete);
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(700));
+            }
+        });
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        uint32_t start = hostMicros();
+        DisplayList &list = fanout.beginFrame(FRAME_SIZE, FRAME_SIZE);
+        buildFrame(list, frame);
+        fanout.publish();
+        uint32_t elapsed = hostMicros() - start;
+        slowestPublish = elapsed > slowestPublish ? elapsed : slowestPublish;
+
+        // What an unscaled replay of this frame draws, for comparison
+        RecordingTarget expected("expected", 0);
+        replayDisplayList(list, expected);
+        published.push_back(expected.frames.back());
+        std::this_thread::sleep_for(std::chrono::microseconds(3000));
+    }
+    reader.join();
+    CHECK(fanout.waitIdle(1000));
+
+    FanoutTargetStats dialStats = fanout.getStats(0);
+    FanoutTargetStats mirrorStats = fanout.getStats(1);
+    char dialLatency[96];
+    char mirrorLatency[96];
+    fanout.formatLatency(0, dialLatency, sizeof(dialLatency));
+    fanout.formatLatency(1, mirrorLatency, sizeof(mirrorLatency));
+    printf("%d frames published, slowest publish %lu us\n", FRAMES, (unsigned long)slowestPublish);
+    printf("dial   drawn=%lu skipped=%lu %s\n", (unsigned long)dialStats.frames, (unsigned long)dialStats.skipped,
+           dialLatency);
+    printf("mirror drawn=%lu skipped=%lu %s\n", (unsigned long)mirrorStats.frames,
+           (unsigned long)mirrorStats.skipped, mirrorLatency);
+
+    // Every frame is either drawn or skipped by each target, and the last one is drawn by both
+    CHECK(dialStats.frames + dialStats.skipped == FRAMES);
+    CHECK(mirrorStats.frames + mirrorStats.skipped == FRAMES);
+    CHECK(dial.frames.size() == dialStats.frames && mirror.frames.size() == mirrorStats.frames);
+    CHECK(dial.frames.back() == published.back());
+    CHECK(mirror.frames.back() == published.back());
+    CHECK(dial.frames.back() == mirror.frames.back());
+
+    // Both receive the same ops, in published order, for every frame they draw
+    CHECK(inPublishedOrder(dial.frames, published));
+    CHECK(inPublishedOrder(mirror.frames, published));
+
+    // The slow target skips frames; the fast one is not held up by it
+    CHECK(mirrorStats.skipped > 0);
+    CHECK(dialStats.frames > mirrorStats.frames);
+
+    // Statistics reset without touching the frames
+    fanout.resetStats();
+    CHECK(fanout.getStats(0).frames == 0 && fanout.getStats(1).skipped == 0);
+
+    return finishHostTest("test_displayfanout");
+}
@@ -0,0 +1,177 @@
+/**
+ * @file test_epdrefresh.cpp
+ * @brief E-paper refresh policies compared on a simulated panel
+ * @date 2026-10-19
+ *
+ * Feeds the same sequence of frame changes to RefreshScheduler under three
+ * policies and lets SimulatedEpd time the refreshes on a virtual clock, as
+ * EpdDevice::service() would on an M5Paper: a full refresh per change (what
+ * an LCD-style device does), a partial refresh per change, and the batched
+ * policy EpdDevice uses. Reports refresh counts, panel busy time, damage to
+ * visible latency and the worst ghosting between full refreshes.
+ *
+ * With this panel's costs a font change, which touches three row bands, is
+ * cheaper as one full refresh than as three partial ones, so the scheduler
+ * refreshes it fully; partial refreshes pay off for edits of the sample text.
+ */
+
+#include "hosttest.hpp"
+#include <vector>
+#include "refreshscheduler.hpp"
+
+static const int PANEL_WIDTH = 540; // M5Paper
+static const int PANEL_HEIGHT = 960;
+static const RefreshCostModel EPD_COST = {450, 260, 30}; // As in epddevice.cpp
+
+enum ChangeKind
+{
+    CHANGE_FONT, // Header, sample text and metrics bands
+    CHANGE_TEXT, // Sample text band only, e.g. a keystroke in the editor
+    CHANGE_PAGE, // A page of fonts replaces the whole frame
+};
+
+struct Change
+{
+    uint32_t time;
+    ChangeKind kind;
+};
+
+struct PolicyResult
+{
+    uint32_t partials;
+    uint32_t fulls;
+    uint32_t busyMs;
+    uint32_t meanLatencyMs;
+    uint32_t maxLatencyMs;
+    float maxGhosting;
+};
+
+// Row bands a specimen frame changes from one font to the next, as commitFrame() reports them
+static void addFontDamage(RefreshScheduler &scheduler, uint32_t now)
+{
+    scheduler.addDamage({0, 12, PANEL_WIDTH, 48}, now);                          // Size, family, font
+    scheduler.addDamage({0, PANEL_HEIGHT / 2 - 90, PANEL_WIDTH, 180}, now);      // Sample text
+    scheduler.addDamage({0, PANEL_HEIGHT - 80, PANEL_WIDTH, 20}, now);           // Metrics
+}
+
+static PolicyResult run(const std::vector<Change> &changes, uint32_t settleMs, uint32_t maxLatencyMs,
+                        int partialsBeforeFull, int fullAreaPercent)
+{
+    RefreshScheduler scheduler(PANEL_WIDTH, PANEL_HEIGHT);
+    scheduler.setCostModel(EPD_COST);
+    scheduler.setPolicy(settleMs, maxLatencyMs, partialsBeforeFull, fullAreaPercent);
+    SimulatedEpd panel(PANEL_WIDTH, PANEL_HEIGHT, EPD_COST);
+
+    size_t next = 0;
+    uint32_t end = changes.back().time + 10000;
+    for (uint32_t now = 0; now < end; now++)
+    {
+        while (next < changes.size() && changes[next].time == now)
+        {
+            switch (changes[next].kind)
+            {
+            case CHANGE_FONT:
+                addFontDamage(scheduler, now);
+                break;
+            case CHANGE_TEXT:
+                scheduler.addDamage({0, PANEL_HEIGHT / 2 - 90, PANEL_WIDTH, 180}, now);
+                break;
+            case CHANGE_PAGE:
+                scheduler.addDamage({0, 0, PANEL_WIDTH, PANEL_HEIGHT}, now);
+                break;
+            }
+            next++;
+        }
+
+        // service(): nothing starts while the panel is still refreshing
+        if (!panel.isBusy(now))
+        {
+            DirtyRect regions[RefreshScheduler::MAX_RECTS];
+            int count = 0;
+            uint32_t damagedAt = scheduler.getPendingSince();
+            RefreshKind kind = scheduler.poll(now, regions, count);
+            if (kind != REFRESH_NONE)
+            {
+                panel.refresh(kind, regions, count, now, damagedAt);
+            }
+        }
+    }
+
+    PolicyResult result;
+    result.partials = scheduler.getPartialRefreshes();
+    result.fulls = scheduler.getFullRefreshes();
+    result.busyMs = panel.getBusyTime();
+    result.meanLatencyMs = panel.getMeanLatency();
+    result.maxLatencyMs = panel.getMaxLatency();
+    result.maxGhosting = panel.getMaxGhosting();
+    return result;
+}
+
+static void print(const char *name, const PolicyResult &result)
+{
+    printf("%-18s %8u %5u %8u %9u %8u %8.2f\n", name, result.partials, result.fulls, result.busyMs,
+           result.meanLatencyMs, result.maxLatencyMs, result.maxGhosting);
+}
+
+int main()
+{
+    // A session: quick spins through fonts, single detents, typing, a page view
+    std::vector<Change> changes;
+    uint32_t time = 1000;
+    for (int session = 0; session < 6; session++)
+    {
+        for (int i = 0; i < 12; i++) // Spin: a detent every 80 ms
+        {
+            changes.push_back({time, CHANGE_FONT});
+            time += 80;
+        }
+        time += 3000;
+        for (int i = 0; i < 4; i++) // Reading: a detent every 2 s
+        {
+            changes.push_back({time, CHANGE_FONT});
+            time += 2000;
+        }
+        for (int i = 0; i < 8; i++) // Typing: a character every 700 ms
+        {
+            changes.push_back({time, CHANGE_TEXT});
+            time += 700;
+        }
+        time += 2000;
+        changes.push_back({time, CHANGE_PAGE});
+        time += 4000;
+    }
+
+    PolicyResult fullEach = run(changes, 0, 0, 0, 0);
+    PolicyResult partialEach = run(changes, 0, 0, 1000000, 101);
+    PolicyResult batched = run(changes, 250, 1500, 10, 60);
+
+    printf("%zu changes on a %dx%d panel (full %u ms, partial %u ms + %u us/kpixel)\n", changes.size(),
+           PANEL_WIDTH, PANEL_HEIGHT, EPD_COST.fullMs, EPD_COST.partialMs, EPD_COST.partialPerKPixel);
+    printf("%-18s %8s %5s %8s %9s %8s %8s\n", "policy", "partials", "fulls", "busy ms", "mean lat", "max lat",
+           "ghosting");
+    print("full per change", fullEach);
+    print("partial per change", partialEach);
+    print("batched (default)", batched);
+
+    // Without batching, every change the panel is free for gets a full refresh
+    CHECK(fullEach.partials == 0 && fullEach.fulls <= changes.size());
+    CHECK(fullEach.maxGhosting == 0);
+    CHECK(partialEach.partials > 0);
+
+    // Batching refreshes less often and keeps the panel idle longer
+    CHECK(batched.partials + batched.fulls < fullEach.fulls);
+    CHECK(batched.busyMs < fullEach.busyMs);
+    CHECK(batched.busyMs < partialEach.busyMs);
+    CHECK(batched.partials > 0);
+
+    // A spin waits for the settle time, but never beyond the latency cap and one refresh
+    CHECK(batched.maxLatencyMs <= 1500 + EPD_COST.fullMs);
+    CHECK(batched.meanLatencyMs < fullEach.maxLatencyMs);
+
+    // Periodic full refreshes bound the ghosting partial updates leave behind
+    CHECK(batched.fulls > 0);
+    CHECK(batched.maxGhosting <= partialEach.maxGhosting);
+    CHECK(batched.maxGhosting <= 10 * 0.6f);
+
+    return finishHostTest("test_epdrefresh");
+}
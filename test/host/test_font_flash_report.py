@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Flash attribution of scripts/font_flash_report.py against the fixture map in
+test/host/data/firmware.map, then the full report as the build prints it.
+
+The fixture has the layouts the linker writes: a section name with its
+address and size on the next line or on the same line, a discarded section,
+an IRAM copy, names that contain a shorter font's name, and flash data that
+belongs to no font. The catalog report of scripts/gen_font_catalog.py must
+read the fixture as the build map of its default environment.
+
+Usage: test_font_flash_report.py <repo root>
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+failed = 0
+
+
+def check(condition, text):
+    global failed
+    if not condition:
+        print(f"check failed: {text}")
+        failed += 1
+
+
+def main():
+    root = os.path.abspath(sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), "..", ".."))
+    scripts = os.path.join(root, "scripts")
+    fixture = os.path.join(root, "test", "host", "data", "firmware.map")
+    sys.path.insert(0, scripts)
+    import font_flash_report
+
+    sections = list(font_flash_report.read_sections(fixture))
+    names = [section for _, section, _ in sections]
+    check(len(sections) == 12, f"12 linked input sections, got {len(sections)}")
+    check(not any("FreeSerif" in name for name in names), "discarded section skipped")
+
+    symbols = ["fonts::FreeSans9pt7b", "fonts::FreeSansBold9pt7b", "fonts::Font2",
+               "fonts::efontCN_12", "fonts::FreeSerif9pt7b"]
+    font_bytes = font_flash_report.attribute(fixture, symbols)
+    # Bitmaps, glyphs and the font object; the IRAM copy does not count
+    check(font_bytes["fonts::FreeSans9pt7b"] == 0x6a0 + 0x2f8 + 0x28,
+          f"FreeSans9pt7b {font_bytes['fonts::FreeSans9pt7b']}")
+    # Longest name wins, FreeSans9pt7b gets none of it
+    check(font_bytes["fonts::FreeSansBold9pt7b"] == 0x780 + 0x28,
+          f"FreeSansBold9pt7b {font_bytes['fonts::FreeSansBold9pt7b']}")
+    # chrtbl_f carries no font name and stays unattributed
+    check(font_bytes["fonts::Font2"] == 0x18, f"Font2 {font_bytes['fonts::Font2']}")
+    check(font_bytes["fonts::efontCN_12"] == 0x1000, f"efontCN_12 {font_bytes['fonts::efontCN_12']}")
+    check(font_bytes["fonts::FreeSerif9pt7b"] == 0, "discarded font not counted")
+
+    report = subprocess.run([sys.executable, os.path.join(scripts, "font_flash_report.py"), "--map", fixture,
+                             "--catalog", os.path.join(root, "font_manifest.json")],
+                            capture_output=True, text=True)
+    print(report.stdout, end="")
+    check(report.returncode == 0, f"report exit status {report.returncode}: {report.stderr}")
+    check("Attributed to fonts: 8576 bytes" in report.stdout, "attributed total")
+    check("of 10496 bytes" in report.stdout, "flash total")
+
+    missing = subprocess.run([sys.executable, os.path.join(scripts, "font_flash_report.py"), "--map",
+                              os.path.join(root, "missing.map"), "--catalog", os.path.join(root, "font_manifest.json")],
+                             capture_output=True, text=True)
+    check(missing.returncode != 0 and "pio run" in missing.stderr, "missing map explained")
+
+    # The catalog report reads the build map of --env by default, and says how to get one when it is missing
+    with tempfile.TemporaryDirectory() as tree:
+        shutil.copytree(scripts, os.path.join(tree, "scripts"))
+        shutil.copy(os.path.join(root, "font_manifest.json"), tree)
+        generator = os.path.join(tree, "scripts", "gen_font_catalog.py")
+        unbuilt = subprocess.run([sys.executable, generator, "--report"], capture_output=True, text=True)
+        check(unbuilt.returncode == 0, f"report without a build: {unbuilt.stderr}")
+        check("pio run -e m5stack-stamps3-font-map" in unbuilt.stdout, "missing build map explained")
+
+        build = os.path.join(tree, ".pio", "build", "m5stack-stamps3-font-map")
+        os.makedirs(build)
+        shutil.copy(fixture, os.path.join(build, "firmware.map"))
+        built = subprocess.run([sys.executable, generator, "--report"], capture_output=True, text=True)
+        print(built.stdout, end="")
+        check(built.returncode == 0, f"report with a build: {built.stderr}")
+        check("glyph data from" in built.stdout and "firmware.map" in built.stdout, "build map read by default")
+        rows = [line.split() for line in built.stdout.splitlines() if line.startswith("english ")]
+        check(len(rows) == 1 and rows[0][4] != "-", f"glyph KB of the english profile: {rows}")
+
+        other = subprocess.run([sys.executable, generator, "--report", "--env", "m5stack-stamps3-en"],
+                               capture_output=True, text=True)
+        check("pio run -e m5stack-stamps3-en" in other.stdout, "--env selects the build map")
+
+    status = "PASS" if failed == 0 else "FAIL"
+    print(f"test_font_flash_report: {status} ({failed} failed checks)")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
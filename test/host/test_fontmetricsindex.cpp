@@ -0,0 +1,212 @@
+/**
+ * @file test_fontmetricsindex.cpp
+ * @brief "Which fonts fit" queries against a brute-force scan of the catalog
+ * @date 2026-10-19
+ *
+ * The fonts are the catalog of the build profile with synthetic metrics:
+ * line height from the size, one advance for fonts with FONT_TRAIT_MONO,
+ * narrow and wide letters for the rest, and no glyphs outside ASCII unless
+ * the font has FONT_TRAIT_CJK. Font7 is a seven-segment font with digits
+ * only. Every query is compared with measuring every font, and both are
+ * timed. A font missing a glyph of the text must never fit it.
+ */
+
+#include "hosttest.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "fontcatalog.hpp"
+#include "fontmetricsindex.hpp"
+
+static int pixelSize(const CatalogFont &font)
+{
+    // lgfx built-in fonts are numbered 0..8, the rest sized in points
+    return font.size <= 8 ? 8 + font.size * 2 : font.size * 4 / 3;
+}
+
+static int measureSynthetic(const void *fontPtr, uint32_t codepoint)
+{
+    const CatalogFont &font = *static_cast<const CatalogFont *>(fontPtr);
+    int size = pixelSize(font);
+    if (codepoint < 0x20 || codepoint > 0x7E)
+    {
+        return (font.traits & FONT_TRAIT_CJK) ? size : 0;
+    }
+    if (strcmp(font.name, "Font7") == 0 && strchr("0123456789.:- ", (int)codepoint) == nullptr)
+    {
+        return 0;
+    }
+    if (font.traits & FONT_TRAIT_MONO)
+    {
+        return size * 3 / 5;
+    }
+    if (codepoint == 'i' || codepoint == 'l' || codepoint == '.' || codepoint == ' ')
+    {
+        return size / 4 + 1;
+    }
+    if (codepoint == 'M' || codepoint == 'W' || codepoint == 'm' || codepoint == 'w')
+    {
+        return size * 4 / 5;
+    }
+    return size / 2 + (codepoint & 1);
+}
+
+static bool verticalSynthetic(const void *fontPtr, FontVerticalMetrics &metrics)
+{
+    const CatalogFont &font = *static_cast<const CatalogFont *>(fontPtr);
+    int size = pixelSize(font);
+    metrics.height = size + size / 5;
+    metrics.ascent = size;
+    metrics.descent = metrics.height - metrics.ascent;
+    metrics.xHeight = (font.traits & FONT_TRAIT_CJK) ? 0 : size / 2;
+    return true;
+}
+
+// Every font measured: the answer the index must give, as a sorted id list
+static std::vector<uint16_t> scanAll(const FontQuery &query, size_t &measured)
+{
+    std::vector<uint16_t> matches;
+    SpanList spans;
+    decodeUtf8(query.text, spans);
+    for (int id = 0; id < FONT_CATALOG_FONT_COUNT; id++)
+    {
+        const CatalogFont &font = FONT_CATALOG_FONTS[id];
+        FontVerticalMetrics metrics;
+        verticalSynthetic(&font, metrics);
+        bool mono = (font.traits & FONT_TRAIT_MONO) != 0;
+        int width = 0;
+        bool covered = true;
+        for (const CodepointSpan &span : spans)
+        {
+            int advance = measureSynthetic(&font, span.codepoint);
+            covered = covered && advance > 0;
+            width += advance;
+        }
+        measured++;
+        if (covered && metrics.height <= query.maxHeight && metrics.xHeight >= query.minXHeight &&
+            width <= query.maxWidth &&
+            !(query.spacing == FontQuery::SPACING_MONOSPACE && !mono) &&
+            !(query.spacing == FontQuery::SPACING_PROPORTIONAL && mono))
+        {
+            matches.push_back(id);
+        }
+    }
+    return matches;
+}
+
+int main()
+{
+    const void *fonts[FONT_CATALOG_FONT_COUNT];
+    for (int i = 0; i < FONT_CATALOG_FONT_COUNT; i++)
+    {
+        fonts[i] = &FONT_CATALOG_FONTS[i];
+    }
+    FontMetricsIndex index;
+    CHECK(!index.isBuilt());
+    index.build(fonts, FONT_CATALOG_FONT_COUNT, verticalSynthetic, measureSynthetic);
+    CHECK(index.isBuilt());
+    CHECK(index.getCount() == (size_t)FONT_CATALOG_FONT_COUNT);
+    CHECK(index.getEntry(FONT_CATALOG_FONT_COUNT) == nullptr);
+
+    // The monospace flag comes from the advances and agrees with the catalog trait
+    int monospace = 0;
+    for (int i = 0; i < FONT_CATALOG_FONT_COUNT; i++)
+    {
+        const FontMetricsEntry *entry = index.getEntry(i);
+        CHECK(entry != nullptr && entry->fontId == i);
+        if (entry != nullptr)
+        {
+            CHECK(entry->monospace == ((FONT_CATALOG_FONTS[i].traits & FONT_TRAIT_MONO) != 0));
+            CHECK(entry->minAdvance <= entry->avgAdvance && entry->avgAdvance <= entry->maxAdvance);
+            monospace += entry->monospace;
+        }
+    }
+    CHECK(monospace == FONT_CATALOG_MONO_COUNT);
+
+    static const char *const texts[] = {"Hi", "illumination", "WWW MMM www", "The quick brown fox", "x",
+                                        "0123456789.", "いろはにほへと", "Tokyo 東京"};
+    static const FontQuery::Spacing spacings[] = {FontQuery::SPACING_ANY, FontQuery::SPACING_MONOSPACE,
+                                                  FontQuery::SPACING_PROPORTIONAL};
+    srand(35);
+    size_t queries = 0;
+    size_t mismatches = 0;
+    size_t candidates = 0;
+    size_t exactChecks = 0;
+    size_t scanned = 0;
+    uint32_t indexMicros = 0;
+    uint32_t scanMicros = 0;
+    uint16_t results[FONT_CATALOG_FONT_COUNT];
+    for (int round = 0; round < 4000; round++)
+    {
+        FontQuery query;
+        query.text = texts[rand() % (sizeof(texts) / sizeof(texts[0]))];
+        query.maxWidth = 10 + rand() % 400;
+        query.maxHeight = 6 + rand() % 120;
+        query.minXHeight = (rand() % 3 == 0) ? rand() % 30 : 0;
+        query.spacing = spacings[rand() % 3];
+
+        FontQueryStats stats;
+        uint32_t start = hostMicros();
+        size_t found = index.query(query, results, FONT_CATALOG_FONT_COUNT, &stats);
+        indexMicros += hostMicros() - start;
+
+        start = hostMicros();
+        std::vector<uint16_t> expected = scanAll(query, scanned);
+        scanMicros += hostMicros() - start;
+
+        // Tallest first
+        for (size_t i = 1; i < found; i++)
+        {
+            CHECK(index.getEntry(results[i - 1])->vertical.height >= index.getEntry(results[i])->vertical.height);
+        }
+        std::vector<uint16_t> actual(results, results + found);
+        std::sort(actual.begin(), actual.end());
+        mismatches += (actual != expected);
+        CHECK(stats.exactChecks <= stats.candidates);
+        candidates += stats.candidates;
+        exactChecks += stats.exactChecks;
+        queries++;
+    }
+    CHECK(mismatches == 0);
+
+    // Only candidates the advance bounds cannot decide are measured
+    CHECK(exactChecks < scanned / 2);
+
+    // CJK text in a box any font fits: only fonts with CJK glyphs, never a Latin one
+    int cjkFonts = 0;
+    for (int i = 0; i < FONT_CATALOG_FONT_COUNT; i++)
+    {
+        cjkFonts += (FONT_CATALOG_FONTS[i].traits & FONT_TRAIT_CJK) != 0;
+    }
+    FontQuery cjk = {"いろはにほへと", 100000, 1000, 0, FontQuery::SPACING_ANY};
+    CHECK(index.query(cjk, results, FONT_CATALOG_FONT_COUNT) == (size_t)cjkFonts);
+    static const CatalogFont mixed[] = {
+        {"Test", "Latin24", 24, 0, 0},
+        {"Test", "Gothic16", 16, 0, FONT_TRAIT_CJK},
+        {"Test", "Mono12", 12, 0, FONT_TRAIT_MONO},
+        {"Test", "Font7", 48, 0, 0},
+    };
+    const void *mixedFonts[] = {&mixed[0], &mixed[1], &mixed[2], &mixed[3]};
+    FontMetricsIndex mixedIndex;
+    mixedIndex.build(mixedFonts, 4, verticalSynthetic, measureSynthetic);
+    FontQuery tokyo = {"Tokyo 東京", 100000, 1000, 0, FontQuery::SPACING_ANY};
+    CHECK(mixedIndex.query(tokyo, results, 4) == 1 && results[0] == 1);
+    FontQuery digits = {"12:45", 100000, 1000, 0, FontQuery::SPACING_ANY};
+    CHECK(mixedIndex.query(digits, results, 4) == 4);
+    FontQuery word = {"Hello", 100000, 1000, 0, FontQuery::SPACING_ANY};
+    CHECK(mixedIndex.query(word, results, 4) == 3); // Not the digits-only font, though every advance fits
+
+    // A short result buffer still reports the full count
+    FontQuery wide = {"42", 1000, 1000, 0, FontQuery::SPACING_ANY};
+    CHECK(index.query(wide, results, 3) == (size_t)FONT_CATALOG_FONT_COUNT);
+    FontQuery none = {"Hi", 1000, 1, 0, FontQuery::SPACING_ANY};
+    FontQueryStats stats;
+    CHECK(index.query(none, results, FONT_CATALOG_FONT_COUNT, &stats) == 0 && stats.candidates == 0);
+
+    printf("%zu queries over %d fonts: %zu candidates after the height search, %zu measured (scan: %zu)\n",
+           queries, FONT_CATALOG_FONT_COUNT, candidates, exactChecks, scanned);
+    printf("index %.2f us/query, measuring every font %.2f us/query\n", (double)indexMicros / queries,
+           (double)scanMicros / queries);
+    return finishHostTest("test_fontmetricsindex");
+}
@@ -0,0 +1,109 @@
+/**
+ * @file test_framepacer.cpp
+ * @brief Frame pacing, dropped-frame counting and frame-time percentiles on a simulated clock
+ * @date 2026-10-19
+ *
+ * Slide transitions are run the way M5DialDevice::updateTransition() runs
+ * them: the loop polls every millisecond, draws a frame when one is due and
+ * the frame takes as long as the test says. Frames that run over their
+ * budget must be counted as dropped slots, not slow the grid down, and the
+ * percentiles must come from the histogram of the frames of one transition.
+ */
+
+#include "hosttest.hpp"
+#include "framepacer.hpp"
+
+static const uint32_t POLL_US = 1000;          // The loop's timer granularity
+static const uint32_t TRANSITION_US = 300000;  // A slow turn's slide
+
+// startTransition() and updateTransition() until the slide ends; returns the time it ended
+static uint32_t runTransition(FramePacer &pacer, uint32_t now, uint32_t (*frameCost)(int frame))
+{
+    pacer.restart();
+    pacer.resetStats();
+    uint32_t start = now;
+    int frame = 0;
+    while (now - start < TRANSITION_US)
+    {
+        if (pacer.isFrameDue(now))
+        {
+            pacer.beginFrame(now);
+            now += frameCost(frame++);
+            pacer.endFrame(now);
+        }
+        else
+        {
+            now += POLL_US;
+        }
+    }
+    return now;
+}
+
+static uint32_t steadyFrame(int)
+{
+    return 4000; // A hardware-scroll frame: only new rows are pushed
+}
+
+static uint32_t stalledFrame(int frame)
+{
+    return frame == 5 ? 65000 : 3000; // One frame waits on a flash read
+}
+
+static uint32_t spritePairFrame(int frame)
+{
+    return frame % 4 == 0 ? 25000 : 9000; // Every fourth frame misses its slot
+}
+
+int main()
+{
+    // 50 fps: a 20 ms budget; the rate is clamped to 1..120
+    FramePacer pacer(50);
+    CHECK(pacer.getFrameBudget() == 20000);
+    FramePacer clamped(0);
+    CHECK(clamped.getFrameBudget() == 1000000);
+    clamped.setTargetFps(500);
+    CHECK(clamped.getFrameBudget() == 1000000 / 120);
+    CHECK(pacer.getPercentile(50) == 0); // No frames yet
+
+    // Frames well inside the budget: one per slot, none dropped
+    uint32_t now = runTransition(pacer, 1000000, steadyFrame);
+    CHECK(pacer.getFrameCount() == TRANSITION_US / 20000);
+    CHECK(pacer.getDroppedFrames() == 0);
+    CHECK(pacer.getMaxFrameTime() == 4000);
+    CHECK(pacer.getPercentile(50) == 6000); // Upper bound of the 4..6 ms bucket
+    CHECK(pacer.getPercentile(100) == 6000);
+    printf("steady:      %lu frames, %lu dropped, p50 %lu us, p95 %lu us, max %lu us\n",
+           (unsigned long)pacer.getFrameCount(), (unsigned long)pacer.getDroppedFrames(),
+           (unsigned long)pacer.getPercentile(50), (unsigned long)pacer.getPercentile(95),
+           (unsigned long)pacer.getMaxFrameTime());
+
+    // A 65 ms frame misses two whole slots; the grid restarts after it instead of catching up
+    now = runTransition(pacer, now + 50000, stalledFrame);
+    CHECK(pacer.getDroppedFrames() == 2);
+    CHECK(pacer.getFrameCount() == TRANSITION_US / 20000 - 2); // Statistics are of this transition only
+    CHECK(pacer.getMaxFrameTime() == 65000);
+    CHECK(pacer.getPercentile(50) == 4000);
+    CHECK(pacer.getPercentile(100) == 65000); // Past the last bucket: the slowest frame
+    printf("stalled:     %lu frames, %lu dropped, p50 %lu us, p95 %lu us, max %lu us\n",
+           (unsigned long)pacer.getFrameCount(), (unsigned long)pacer.getDroppedFrames(),
+           (unsigned long)pacer.getPercentile(50), (unsigned long)pacer.getPercentile(95),
+           (unsigned long)pacer.getMaxFrameTime());
+
+    // Slow sprite-pair frames: a quarter run over, each late by less than a slot, so none are dropped
+    now = runTransition(pacer, now + 50000, spritePairFrame);
+    CHECK(pacer.getDroppedFrames() == 0);
+    CHECK(pacer.getPercentile(50) == 10000);
+    CHECK(pacer.getPercentile(95) == 26000);
+    printf("sprite pair: %lu frames, %lu dropped, p50 %lu us, p95 %lu us, max %lu us\n",
+           (unsigned long)pacer.getFrameCount(), (unsigned long)pacer.getDroppedFrames(),
+           (unsigned long)pacer.getPercentile(50), (unsigned long)pacer.getPercentile(95),
+           (unsigned long)pacer.getMaxFrameTime());
+
+    // micros() wrapping around during a slide drops nothing and keeps the frame times
+    runTransition(pacer, 0xFFFFFFFFu - 150000, steadyFrame);
+    CHECK(pacer.getFrameCount() == TRANSITION_US / 20000);
+    CHECK(pacer.getDroppedFrames() == 0);
+    CHECK(pacer.getMaxFrameTime() == 4000);
+
+    return finishHostTest("test_framepacer");
+}
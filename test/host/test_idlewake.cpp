@@ -0,0 +1,283 @@
+/**
+ * @file test_idlewake.cpp
+ * @brief Idle and wake behaviour of the main loop, simulated on a virtual clock
+ * @date 2026-10-19
+ *
+ * Runs runLoopStep(), as loop() in LovyanGFX_font_display.cpp does, with
+ * hooks that model the inputs and M5DialDevice on a virtual clock: waiting
+ * blocks for EventScheduler::getWaitTime() unless an encoder step
+ * interrupts it, and in POWER_SLEEP only a pin edge wakes the chip. Pin
+ * edges go through QuadratureDecoder as in encoder.cpp; light sleep swallows
+ * the interrupt of the waking edge, which samplePins() then decodes. A
+ * counter-clockwise detent's first edge is not a step, so the chip sleeps
+ * again until the second edge wakes it.
+ */
+
+#include "hosttest.hpp"
+#include <vector>
+#include "eventscheduler.hpp"
+#include "inputlog.hpp"
+#include "quadrature.hpp"
+
+static const uint32_t DIM_MS = 30000;    // IDLE_DIM_MS
+static const uint32_t SLEEP_MS = 120000; // IDLE_SLEEP_MS
+static const uint32_t WAKE_MS = 2;       // Light sleep exit, clocks and flash back up
+static const uint32_t EDGE_MS = 3;       // Between pin edges of a brisk turn
+
+struct PinEdge
+{
+    uint32_t time;
+    bool a;
+    bool b;
+};
+
+// Levels of pins A and B through one detent, starting and ending at rest (both high)
+static void addDetent(std::vector<PinEdge> &edges, uint32_t &time, int direction)
+{
+    static const bool clockwise[4][2] = {{false, true}, {false, false}, {true, false}, {true, true}};
+    static const bool counter[4][2] = {{true, false}, {false, false}, {false, true}, {true, true}};
+    const bool (*levels)[2] = direction > 0 ? clockwise : counter;
+    for (int i = 0; i < 4; i++)
+    {
+        edges.push_back({time, levels[i][0], levels[i][1]});
+        time += EDGE_MS;
+    }
+}
+
+struct SimulationResult
+{
+    long position;           // Encoder count at the end
+    long handledPosition;    // Last position the loop handled
+    uint32_t loopRuns;       // Times the loop body ran
+    uint32_t sleeps;         // Light sleeps entered
+    uint32_t dimmedAt;       // First time POWER_DIMMED applied, 0 if never
+    uint32_t sleptAt;        // First time POWER_SLEEP applied, 0 if never
+    LatencyStats latency;    // Step to handled event, in ms
+    uint32_t sleepLatencyMs; // Same, for the step that woke the chip
+};
+
+// State of the simulated device and inputs, reached by the loop hooks
+struct Simulation
+{
+    const std::vector<PinEdge> *edges;
+    uint32_t endTime;
+    bool sampleAfterWake;
+    EventScheduler scheduler;
+    QuadratureDecoder decoder;
+    long position;
+    long reported; // Encoder::hasPositionChanged() state
+    uint32_t stepTime;
+    bool stepPending;
+    bool wokeFromSleep;
+    bool notified; // M5DialDevice::notify() after a wake-up
+    EventScheduler::PowerState applied;
+    size_t next;
+    uint32_t now;
+    SimulationResult *result;
+};
+static Simulation sim;
+
+// The pin interrupt: returns true if it notified the loop
+static bool interrupt(const PinEdge &edge)
+{
+    int step = sim.decoder.update(edge.a, edge.b);
+    sim.position += step;
+    if (step != 0 && !sim.stepPending)
+    {
+        sim.stepPending = true;
+        sim.stepTime = edge.time;
+    }
+    return step != 0;
+}
+
+static uint32_t clockMillis()
+{
+    return sim.now;
+}
+
+// pollInputs(): the encoder's position as an event
+static void pollInputs(uint32_t now)
+{
+    sim.result->loopRuns++;
+    if (sim.position != sim.reported)
+    {
+        sim.reported = sim.position;
+        sim.scheduler.post(EVENT_ENCODER, sim.position, now);
+    }
+}
+
+static void handleEvent(const Event &event)
+{
+    if (event.type != EVENT_ENCODER)
+    {
+        return;
+    }
+    sim.result->handledPosition = event.value;
+    if (sim.stepPending)
+    {
+        sim.result->latency.add(sim.now - sim.stepTime);
+        if (sim.wokeFromSleep)
+        {
+            sim.result->sleepLatencyMs = sim.now - sim.stepTime;
+        }
+        sim.stepPending = false;
+    }
+}
+
+// setPowerState(): sleeping, again if already asleep, lasts until a pin edge
+static void setPowerState(EventScheduler::PowerState state)
+{
+    SimulationResult &result = *sim.result;
+    sim.wokeFromSleep = false;
+    if (state == EventScheduler::POWER_DIMMED && result.dimmedAt == 0)
+    {
+        result.dimmedAt = sim.now;
+    }
+    if (state == EventScheduler::POWER_SLEEP)
+    {
+        if (sim.applied != EventScheduler::POWER_SLEEP && result.sleptAt == 0)
+        {
+            result.sleptAt = sim.now;
+        }
+        result.sleeps++;
+        if (sim.next == sim.edges->size())
+        {
+            sim.now = sim.endTime; // Nothing wakes the chip again
+        }
+        else
+        {
+            // The waking edge raises no interrupt; samplePins() decodes it
+            const PinEdge &wake = (*sim.edges)[sim.next++];
+            sim.now = wake.time + WAKE_MS;
+            if (sim.sampleAfterWake)
+            {
+                interrupt(wake);
+            }
+            sim.wokeFromSleep = true;
+            sim.notified = true;
+        }
+    }
+    sim.applied = state;
+}
+
+// waitForEvent(): until a notification, a step interrupt or the scheduler's deadline
+static void waitForEvent(uint32_t timeoutMs)
+{
+    if (sim.notified || timeoutMs == 0 || sim.now >= sim.endTime)
+    {
+        sim.notified = false;
+        return;
+    }
+    const std::vector<PinEdge> &edges = *sim.edges;
+    uint64_t deadline = (timeoutMs == EventScheduler::WAIT_FOREVER) ? sim.endTime : (uint64_t)sim.now + timeoutMs;
+    bool woken = false;
+    while (!woken && sim.next < edges.size() && edges[sim.next].time <= deadline)
+    {
+        sim.now = edges[sim.next].time;
+        woken = interrupt(edges[sim.next++]);
+    }
+    if (!woken)
+    {
+        sim.now = deadline < sim.endTime ? (uint32_t)deadline : sim.endTime;
+    }
+}
+
+static void simulate(const std::vector<PinEdge> &edges, uint32_t endTime, bool sampleAfterWake,
+                     SimulationResult &result)
+{
+    sim.edges = &edges;
+    sim.endTime = endTime;
+    sim.sampleAfterWake = sampleAfterWake;
+    sim.scheduler = EventScheduler();
+    sim.scheduler.setIdleTimeouts(DIM_MS, SLEEP_MS);
+    sim.decoder.reset(true, true);
+    sim.position = 0;
+    sim.reported = 0;
+    sim.stepTime = 0;
+    sim.stepPending = false;
+    sim.wokeFromSleep = false;
+    sim.notified = false;
+    sim.applied = EventScheduler::POWER_ACTIVE;
+    sim.next = 0;
+    sim.now = 0;
+    sim.result = &result;
+
+    result.handledPosition = 0;
+    result.loopRuns = 0;
+    result.sleeps = 0;
+    result.dimmedAt = 0;
+    result.sleptAt = 0;
+    result.latency.clear();
+    result.sleepLatencyMs = 0;
+
+    // loop() after the boot
+    static const LoopHooks hooks = {clockMillis, pollInputs, handleEvent, setPowerState, nullptr, waitForEvent};
+    while (sim.now < endTime)
+    {
+        runLoopStep(sim.scheduler, hooks);
+    }
+    result.position = sim.position;
+}
+
+int main()
+{
+    // Turns, a long idle period, then single detents each starting in light sleep
+    std::vector<PinEdge> edges;
+    uint32_t time = 1000;
+    long expected = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        addDetent(edges, time, 1);
+        expected++;
+    }
+    time = 5000;
+    for (int i = 0; i < 2; i++)
+    {
+        addDetent(edges, time, -1);
+        expected--;
+    }
+    const uint32_t lastInput = edges[edges.size() - 3].time; // A falls on a detent's second edge
+    time = 300000;
+    addDetent(edges, time, 1);
+    expected++;
+    time = 600000;
+    addDetent(edges, time, -1);
+    expected--;
+    time = 700000;
+    addDetent(edges, time, -1);
+    expected--;
+    const uint32_t endTime = 900000;
+
+    SimulationResult result;
+    simulate(edges, endTime, true, result);
+
+    // Every detent counts, awake or asleep, and the loop handled the last position
+    CHECK(result.position == expected);
+    CHECK(result.handledPosition == expected);
+
+    // Dims and sleeps on time, and never spins: a handful of runs per input
+    CHECK(result.dimmedAt >= lastInput + DIM_MS && result.dimmedAt < lastInput + DIM_MS + 10);
+    CHECK(result.sleptAt >= lastInput + SLEEP_MS && result.sleptAt < lastInput + SLEEP_MS + 10);
+    CHECK(result.loopRuns < 100);
+    CHECK(result.sleeps >= 3);
+
+    // Awake, a step is handled at once; from sleep, after the wake-up
+    CHECK(result.latency.getPercentile(50) == 0);
+    CHECK(result.sleepLatencyMs == WAKE_MS);
+
+    char line[96];
+    result.latency.format(line, sizeof(line));
+    printf("%u ms simulated: %u loop runs (a polling loop at 1 kHz: %u), %u light sleeps\n", endTime,
+           result.loopRuns, endTime, result.sleeps);
+    printf("dimmed at %u ms, slept at %u ms; step-to-handled latency (ms) %s, from sleep %u ms\n",
+           result.dimmedAt, result.sleptAt, line, result.sleepLatencyMs);
+
+    // Without decoding the waking edge, the loop sees no step and sleeps again
+    // on every edge, so all three detents turned in sleep are lost
+    SimulationResult unsampled;
+    simulate(edges, endTime, false, unsampled);
+    CHECK(unsampled.position == expected + 1);
+    printf("without samplePins() after waking: position %ld, expected %ld\n", unsampled.position, expected);
+
+    return finishHostTest("test_idlewake");
+}
@@ -0,0 +1,249 @@
+/**
+ * @file test_inputreplay.cpp
+ * @brief Input log replay on the host, with latency percentiles
+ * @date 2026-10-19
+ *
+ * Records a dial session (spins, single detents, clicks, an overview toggle)
+ * into an InputLog, round-trips it through its serialized form and replays
+ * it with replayInputLog() into the real FontDisplayManager::update(), drawn
+ * by a HeadlessDevice on a virtual clock: a font frame costs FONT_US, and
+ * with transitions on it then slides in over TRANSITION_US of wall time at
+ * 50 fps, unless a newer font hurries it. The session is replayed with the
+ * transition setting it was recorded with and, for comparison, with
+ * transitions off.
+ *
+ * Usage: test_inputreplay [log.txt]
+ * where log.txt is the reply of the LOG command; that log is then replayed
+ * the same way instead of failing any checks.
+ */
+
+#include "hosttest.hpp"
+#include <ctype.h>
+#include <string.h>
+#include "fontmanager.hpp"
+#include "hostdevice.hpp"
+#include "inputlog.hpp"
+#include "sampletexts.hpp"
+
+static const uint32_t FONT_US = 9000;  // Font frame drawn into the sprite and pushed
+static const uint32_t PAGE_US = 12000; // Overview page
+static const uint32_t TRANSITION_FRAME_US = 6000;
+static const uint32_t TRANSITION_US = 180000;  // Slide at the usual turning speed
+static const uint32_t FRAME_INTERVAL_US = 20000; // InputSession's REPLAY_FRAME_US
+
+static HeadlessDevice device({FONT_US, PAGE_US, TRANSITION_FRAME_US, TRANSITION_US});
+static long replayPosition = 0;
+
+// InputSession::applyReplayInput()
+static void applyInput(const InputRecord &record, void *context)
+{
+    (void)context;
+    switch (record.kind)
+    {
+    case INPUT_ENCODER:
+        replayPosition += record.value;
+        break;
+    case INPUT_CLICK:
+        fontManager.setSampleText(sampleTextStore.selectNext());
+        break;
+    case INPUT_HOLD:
+        fontManager.setOverviewMode(!fontManager.isOverviewMode());
+        break;
+    }
+}
+
+static bool stepViewer(uint32_t nowMs, void *context)
+{
+    (void)context;
+    return fontManager.update(replayPosition, nowMs);
+}
+
+static void waitViewer(uint32_t intervalUs, void *context)
+{
+    (void)context;
+    advanceVirtualClock(intervalUs);
+}
+
+// InputSession::replay() with the headless device in place of the display
+static ReplayResult replay(const InputLog &log, bool transitions, LatencyStats &latency)
+{
+    InputLogStart start = log.getStart();
+    replayPosition = 0;
+    fontManager.update(replayPosition, virtualMicros() / 1000);
+    fontManager.setTransitionsEnabled(transitions);
+    fontManager.selectFont(start.fontId);
+    fontManager.setOverviewMode(start.overview);
+    fontManager.setSampleText(sampleTextStore.select(start.textIndex));
+    fontManager.render();
+    device.reset();
+
+    ReplayHooks hooks;
+    hooks.apply = applyInput;
+    hooks.step = stepViewer;
+    hooks.clockMicros = virtualMicros;
+    hooks.wait = transitions ? waitViewer : nullptr;
+    hooks.frameIntervalUs = FRAME_INTERVAL_US;
+    hooks.context = nullptr;
+    latency.clear();
+    return replayInputLog(log, hooks, latency);
+}
+
+static void report(const char *name, const ReplayResult &result, LatencyStats &latency)
+{
+    char line[96];
+    latency.format(line, sizeof(line));
+    printf("%-16s %s frames=%u replayed=%lu ms\n", name, line, (unsigned)result.frames,
+           (unsigned long)result.virtualTimeMs);
+}
+
+// The hex lines of a LOG reply, decoded; the "LOG" and "OK" lines are skipped
+static bool readLogFile(const char *path, InputLog &log)
+{
+    FILE *file = fopen(path, "r");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    static uint8_t bytes[InputLog::CAPACITY];
+    size_t length = 0;
+    char text[256];
+    bool valid = true;
+    while (valid && fgets(text, sizeof(text), file) != nullptr)
+    {
+        size_t digits = strspn(text, "0123456789abcdefABCDEF");
+        if (digits == 0 || (!isspace((unsigned char)text[digits]) && text[digits] != '\0'))
+        {
+            continue;
+        }
+        for (size_t i = 0; i + 1 < digits && valid; i += 2)
+        {
+            unsigned value;
+            valid = length < sizeof(bytes) && sscanf(text + i, "%2x", &value) == 1;
+            bytes[length++] = (uint8_t)value;
+        }
+    }
+    fclose(file);
+    return valid && log.load(bytes, length);
+}
+
+int main(int argc, char **argv)
+{
+    LatencyStats recordedLatency;
+    LatencyStats offLatency;
+    fontManager.setDevice(&device);
+    fontManager.setClock(virtualMicros);
+
+    if (argc > 1)
+    {
+        static InputLog saved;
+        if (!readLogFile(argv[1], saved))
+        {
+            printf("%s: not a LOG reply\n", argv[1]);
+            return 1;
+        }
+        InputLogStart start = saved.getStart();
+        printf("%u inputs from font %u, text %u, %s, transitions %s\n", (unsigned)saved.getCount(), start.fontId,
+               start.textIndex, start.overview ? "overview" : "single font", start.transitions ? "on" : "off");
+        ReplayResult recorded = replay(saved, start.transitions, recordedLatency);
+        ReplayResult off = replay(saved, false, offLatency);
+        report("as recorded", recorded, recordedLatency);
+        report("transitions off", off, offLatency);
+        return 0;
+    }
+
+    // A session: spins through fonts, a pause on each, text and mode changes
+    static InputLog log;
+    InputLogStart start = {12, 1, false, true};
+    log.start(1000, start);
+    uint32_t time = 1000;
+    size_t inputs = 0;
+    for (int session = 0; session < 8; session++)
+    {
+        for (int i = 0; i < 15; i++) // Brisk turn: a detent every 40 ms
+        {
+            time += 40;
+            inputs += log.record(INPUT_ENCODER, session % 2 ? -1 : 1, time);
+        }
+        time += 1500;
+        for (int i = 0; i < 3; i++) // Single detents while reading
+        {
+            time += 900;
+            inputs += log.record(INPUT_ENCODER, 1, time);
+        }
+        time += 700;
+        inputs += log.record(INPUT_CLICK, 0, time);
+        if (session == 5)
+        {
+            time += 1200;
+            inputs += log.record(INPUT_HOLD, 0, time);
+        }
+        time += 2000;
+    }
+    log.stop();
+    CHECK(inputs == log.getCount() && !log.wasOverflowed());
+
+    // The serialized log keeps the inputs and the starting state
+    static InputLog loaded;
+    CHECK(loaded.load(log.getData(), log.getSize()));
+    CHECK(loaded.getCount() == log.getCount());
+    InputLogStart restored = loaded.getStart();
+    CHECK(restored.fontId == 12 && restored.textIndex == 1);
+    CHECK(!restored.overview && restored.transitions);
+
+    // Logs saved before the transition flag replay with transitions off
+    uint8_t oldHeader[InputLog::HEADER_SIZE] = {12, 0, 1, 0, 1};
+    static InputLog old;
+    CHECK(old.load(oldHeader, sizeof(oldHeader)));
+    CHECK(old.getStart().overview && !old.getStart().transitions);
+
+    ReplayResult recorded = replay(loaded, restored.transitions, recordedLatency);
+    size_t transitions = device.getTransitions();
+    size_t transitionFrames = device.getTransitionFrames();
+    size_t fontFrames = device.getFontFrames();
+
+    // Five spins out and back and six detents forward, then overview from the font's page on
+    int font = 12 + 6 * 3;
+    int page = (font / 6 + 2 * 3) % fontManager.getPageCount();
+    CHECK(fontManager.isOverviewMode() && fontManager.getCurrentPage() == page);
+    CHECK(device.getPageFrames() == 2 * 19 + 1);
+    CHECK(fontManager.getLastFrameTime() == PAGE_US);
+
+    ReplayResult off = replay(loaded, false, offLatency);
+    CHECK(fontManager.isOverviewMode() && fontManager.getCurrentPage() == page);
+    CHECK(device.getTransitions() == 0 && device.getFontFrames() == fontFrames);
+
+    printf("%u inputs, %.1f bytes each\n", (unsigned)loaded.getCount(),
+           (double)(loaded.getSize() - InputLog::HEADER_SIZE) / loaded.getCount());
+    report("as recorded", recorded, recordedLatency);
+    report("transitions off", off, offLatency);
+    printf("%u slides in %u frames\n", (unsigned)transitions, (unsigned)transitionFrames);
+
+    CHECK(recorded.inputs == inputs && off.inputs == inputs);
+    CHECK(recordedLatency.getCount() == inputs && offLatency.getCount() == inputs);
+
+    // Without transitions an input waits at most for one frame before its own
+    CHECK(offLatency.getPercentile(0) >= FONT_US);
+    CHECK(offLatency.getPercentile(100) <= 2 * PAGE_US);
+
+    // With them, a settled detent is on screen once its slide ends; a spin keeps hurrying
+    // the slide of the font before, so its inputs wait for the last slide only
+    CHECK(recordedLatency.getPercentile(50) >= FONT_US + TRANSITION_US);
+    CHECK(recordedLatency.getPercentile(100) > offLatency.getPercentile(100));
+    CHECK(recordedLatency.getPercentile(100) <= 15 * 40000 + FONT_US + TRANSITION_US + FRAME_INTERVAL_US);
+    CHECK(transitions == 6 * 18); // Every detent of the single-font sessions slides
+
+    // Waiting between frames lets a slide take its wall time in 50 fps frames, as live;
+    // the 18 settled detents run their slides to the end
+    CHECK(transitionFrames <= transitions * (TRANSITION_US / FRAME_INTERVAL_US + 1));
+    CHECK(transitionFrames >= 18 * (TRANSITION_US / FRAME_INTERVAL_US - 1));
+
+    // The replay depends only on the log and the work, so it repeats exactly
+    LatencyStats again;
+    ReplayResult repeat = replay(loaded, restored.transitions, again);
+    CHECK(repeat.frames == recorded.frames && repeat.virtualTimeMs == recorded.virtualTimeMs);
+    CHECK(again.getPercentile(99) == recordedLatency.getPercentile(99));
+    CHECK(device.getTransitionFrames() == transitionFrames);
+
+    return finishHostTest("test_inputreplay");
+}
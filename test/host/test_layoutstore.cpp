@@ -0,0 +1,141 @@
+/**
+ * @file test_layoutstore.cpp
+ * @brief Sample text loading and the layout store's save/load round trip
+ * @date 2026-10-19
+ */
+
+#include "hosttest.hpp"
+#include <string.h>
+#include <string>
+#include <vector>
+#include "layoutstore.hpp"
+#include "sampletexts.hpp"
+
+static const char *const LAYOUT_PATH = "test_layoutstore.bin";
+static const char *const TEXT_PATH = "test_layoutstore.txt";
+
+// Fonts are identified by pointers to their advance
+static int measureFixed(const void *font, uint32_t codepoint)
+{
+    (void)codepoint;
+    return *static_cast<const int *>(font);
+}
+
+static void testSampleTexts()
+{
+    FILE *file = fopen(TEXT_PATH, "w");
+    fputs("# comment\n\nFirst\r\nいろはにほへと\n", file);
+    fputs((std::string(300, 'x') + "\nLast").c_str(), file);
+    fclose(file);
+
+    SampleTextStore store;
+    size_t count = store.load(TEXT_PATH);
+    CHECK(strcmp(store.getText(0), "First") == 0);
+#if FONT_CATALOG_HAS_CJK
+    CHECK(count == 4);
+#else
+    // The Japanese line is skipped without CJK fonts
+    CHECK(count == 3);
+#endif
+    CHECK(strlen(store.getText(count - 2)) == SampleTextStore::MAX_TEXT_BYTES);
+    CHECK(strcmp(store.getText(count - 1), "Last") == 0);
+    CHECK(strcmp(store.selectNext(), store.getText(1)) == 0);
+
+    uint32_t hash = store.getHash();
+    CHECK(store.load("missing.txt") > 0);
+    CHECK(strcmp(store.getText(0), SampleTextStore::getDefaultText()) == 0);
+    CHECK(store.getHash() != hash);
+    remove(TEXT_PATH);
+}
+
+static void testRoundTrip()
+{
+    // Every glyph is wider than half the line, so each one gets a line of its
+    // own: 40 fonts x 12 texts x 160 lines is more than 16-bit indexes hold
+    static const int FONT_COUNT = 40;
+    static const int TEXT_COUNT = 12;
+    static const int WRAP_WIDTH = 40;
+    int advances[FONT_COUNT];
+    const void *fonts[FONT_COUNT];
+    for (int i = 0; i < FONT_COUNT; i++)
+    {
+        advances[i] = 21 + i % 10;
+        fonts[i] = &advances[i];
+    }
+
+    std::vector<std::string> textBuffers;
+    const char *texts[TEXT_COUNT];
+    for (int i = 0; i < TEXT_COUNT; i++)
+    {
+        textBuffers.push_back(std::string(160, 'a' + i));
+    }
+    for (int i = 0; i < TEXT_COUNT; i++)
+    {
+        texts[i] = textBuffers[i].c_str();
+    }
+
+    LayoutStore built;
+    built.bind(fonts, FONT_COUNT, texts, TEXT_COUNT, WRAP_WIDTH);
+    size_t lineCount = 0;
+    CHECK(built.find(fonts[0], texts[0], WRAP_WIDTH, lineCount) == nullptr);
+    built.build(measureFixed);
+    CHECK(built.isReady());
+    CHECK(built.save(LAYOUT_PATH, 0x1234, 0x5678));
+
+    LayoutStore loaded;
+    loaded.bind(fonts, FONT_COUNT, texts, TEXT_COUNT, WRAP_WIDTH);
+    CHECK(loaded.load(LAYOUT_PATH, 0x1234, 0x5678));
+
+    // Entries past line 65535 must come back whole and in place
+    for (int font = 0; font < FONT_COUNT; font += 13)
+    {
+        for (int text = 0; text < TEXT_COUNT; text++)
+        {
+            size_t builtCount = 0;
+            size_t loadedCount = 0;
+            const LayoutLine *expected = built.find(fonts[font], texts[text], WRAP_WIDTH, builtCount);
+            const LayoutLine *actual = loaded.find(fonts[font], textBuffers[text].c_str(), WRAP_WIDTH, loadedCount);
+            CHECK(expected != nullptr && actual != nullptr);
+            CHECK(builtCount == 160 && loadedCount == 160);
+            if (expected != nullptr && actual != nullptr && builtCount == loadedCount)
+            {
+                CHECK(memcmp(expected, actual, builtCount * sizeof(LayoutLine)) == 0);
+                CHECK(actual[159].byteStart == 159 && actual[159].width == advances[font]);
+            }
+        }
+    }
+
+    // A different catalog, text set or width invalidates the file
+    LayoutStore stale;
+    stale.bind(fonts, FONT_COUNT, texts, TEXT_COUNT, WRAP_WIDTH);
+    CHECK(!stale.load(LAYOUT_PATH, 0x1235, 0x5678));
+    CHECK(!stale.load(LAYOUT_PATH, 0x1234, 0x5679));
+    CHECK(!stale.isReady());
+    stale.bind(fonts, FONT_COUNT, texts, TEXT_COUNT, WRAP_WIDTH + 1);
+    CHECK(!stale.load(LAYOUT_PATH, 0x1234, 0x5678));
+    stale.bind(fonts, FONT_COUNT - 1, texts, TEXT_COUNT, WRAP_WIDTH);
+    CHECK(!stale.load(LAYOUT_PATH, 0x1234, 0x5678));
+
+    // A truncated file is rejected rather than half loaded
+    FILE *file = fopen(LAYOUT_PATH, "r+b");
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    std::vector<char> data(size);
+    file = fopen(LAYOUT_PATH, "rb");
+    CHECK(fread(data.data(), 1, size, file) == (size_t)size);
+    fclose(file);
+    file = fopen(LAYOUT_PATH, "wb");
+    fwrite(data.data(), 1, size - 4, file);
+    fclose(file);
+    stale.bind(fonts, FONT_COUNT, texts, TEXT_COUNT, WRAP_WIDTH);
+    CHECK(!stale.load(LAYOUT_PATH, 0x1234, 0x5678));
+    remove(LAYOUT_PATH);
+}
+
+int main()
+{
+    testSampleTexts();
+    testRoundTrip();
+    return finishHostTest("test_layoutstore");
+}
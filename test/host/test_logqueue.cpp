@@ -0,0 +1,150 @@
+/**
+ * @file test_logqueue.cpp
+ * @brief Background log lines kept out of command replies
+ * @date 2026-10-19
+ *
+ * Three tasks log while the main loop writes multi-line replies to the same
+ * output, draining the queue only between replies, as loop() does. Every
+ * reply must come out in one piece, every log line whole and in its task's
+ * order. A full queue drops whole lines and says how many.
+ */
+
+#include "hosttest.hpp"
+#include <string.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "logqueue.hpp"
+
+static const int TASKS = 3;
+static const int LINES_PER_TASK = 400;
+static const int REPLIES = 300;
+
+// loop(): write what the tasks queued
+static void drain(LogQueue &queue, std::string &output)
+{
+    char text[128];
+    size_t length;
+    while ((length = queue.read(text, sizeof(text))) > 0)
+    {
+        output.append(text, length);
+    }
+}
+
+int main()
+{
+    LogQueue queue;
+    std::string output;
+
+    std::vector<std::thread> tasks;
+    for (int task = 0; task < TASKS; task++)
+    {
+        tasks.emplace_back(
+            [&queue, task]
+            {
+                for (int i = 0; i < LINES_PER_TASK; i++)
+                {
+                    queue.printf("Task %d line %d", task, i); // The newline is added
+                    if (i % 16 == 0)
+                    {
+                        std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    }
+                }
+            });
+    }
+    for (int reply = 0; reply < REPLIES; reply++)
+    {
+        // A HELP-like reply of three lines and OK, then the queue
+        for (int line = 0; line < 3; line++)
+        {
+            output += "reply " + std::to_string(reply) + " line " + std::to_string(line) + "\n";
+        }
+        output += "OK\n";
+        drain(queue, output);
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    for (std::thread &task : tasks)
+    {
+        task.join();
+    }
+    drain(queue, output);
+
+    // Replies are contiguous; log lines are whole, in order per task, or counted as dropped
+    std::istringstream lines(output);
+    std::string line;
+    int nextLine[TASKS] = {};
+    int reported = 0;
+    int replyLine = -1;
+    int replies = 0;
+    size_t torn = 0;
+    while (std::getline(lines, line))
+    {
+        int task;
+        int index;
+        int reply;
+        int part;
+        unsigned long dropped;
+        if (replyLine >= 0 && replyLine < 3)
+        {
+            torn += sscanf(line.c_str(), "reply %d line %d", &reply, &part) != 2 || part != replyLine;
+            replyLine++;
+        }
+        else if (replyLine == 3)
+        {
+            torn += line != "OK";
+            replyLine = -1;
+            replies++;
+        }
+        else if (sscanf(line.c_str(), "reply %d line %d", &reply, &part) == 2)
+        {
+            torn += part != 0;
+            replyLine = 1;
+        }
+        else if (sscanf(line.c_str(), "Task %d line %d", &task, &index) == 2 && task >= 0 && task < TASKS)
+        {
+            torn += index < nextLine[task];
+            nextLine[task] = index + 1;
+            reported++;
+        }
+        else if (sscanf(line.c_str(), "(%lu log lines dropped)", &dropped) == 1)
+        {
+            reported += dropped;
+        }
+        else
+        {
+            torn++;
+        }
+    }
+    printf("%d replies, %d log lines from %d tasks, queue of %zu bytes\n", replies, reported, TASKS,
+           LogQueue::CAPACITY);
+    CHECK(torn == 0);
+    CHECK(replies == REPLIES);
+    CHECK(reported + (int)queue.getDroppedLines() == TASKS * LINES_PER_TASK);
+
+    // Nobody reading: whole lines are dropped, then counted once there is room
+    LogQueue full;
+    for (int i = 0; i < 200; i++)
+    {
+        full.printf("Thumbnails: %d fonts\n", i);
+    }
+    CHECK(full.getDroppedLines() > 0);
+    uint32_t dropped = full.getDroppedLines();
+    std::string kept;
+    drain(full, kept);
+    full.printf("Thumbnails built in %d ms", 42);
+    drain(full, kept);
+    char note[80];
+    snprintf(note, sizeof(note), "(%lu log lines dropped)\nThumbnails built in 42 ms\n", (unsigned long)dropped);
+    CHECK(kept.size() > strlen(note) && kept.compare(kept.size() - strlen(note), strlen(note), note) == 0);
+    CHECK(full.getDroppedLines() == 0);
+
+    // A line longer than MAX_LINE is cut off, still ending in a newline
+    std::string longLine(LogQueue::MAX_LINE * 2, 'x');
+    full.printf("%s", longLine.c_str());
+    std::string cut;
+    drain(full, cut);
+    CHECK(cut.size() == LogQueue::MAX_LINE - 1 && cut.back() == '\n');
+
+    return finishHostTest("test_logqueue");
+}
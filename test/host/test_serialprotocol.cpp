@@ -0,0 +1,302 @@
+/**
+ * @file test_serialprotocol.cpp
+ * @brief Serial command protocol against a headless device on a pseudo-terminal
+ * @date 2026-10-19
+ *
+ * The firmware's SerialCommands reads the master side of the pty and drives
+ * fontManager on a HeadlessDevice, which draws its frames into a
+ * FrameBufferTarget for SHOT. Commands that need the hardware reply as
+ * hostcommands.cpp has them. The test talks to it through the terminal side
+ * of the pty, as scripts/contact_sheet.py does over USB.
+ *
+ * Run with --serve to keep the device up and print its terminal, e.g.:
+ *   python scripts/contact_sheet.py --port /dev/pts/5 --out sheet.png
+ * test_contact_sheet.py does that with the script's own client.
+ */
+
+#include "hosttest.hpp"
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "commandparser.hpp"
+#include "fontcatalog.hpp"
+#include "hostdevice.hpp"
+#include "rle565.hpp"
+#include "serialcommands.hpp"
+
+static const int FRAME_WIDTH = 240;
+static const int FRAME_HEIGHT = 240;
+
+// Frame costs on the virtual clock; RENDER replies with fontUs
+static const HeadlessDevice::Costs COSTS = {9000, 12000, 6000, 180000};
+
+/**
+ * @class PtyStream
+ * @brief The device side of the pseudo-terminal, as SerialCommands reads it
+ */
+class PtyStream : public CommandStream
+{
+private:
+    int fd;
+
+public:
+    PtyStream(int deviceFd) : fd(deviceFd) {}
+
+    int available() override
+    {
+        int count = 0;
+        return ioctl(fd, FIONREAD, &count) == 0 ? count : 0;
+    }
+
+    int read() override
+    {
+        uint8_t byte;
+        return ::read(fd, &byte, 1) == 1 ? byte : -1;
+    }
+
+    size_t write(const uint8_t *data, size_t size) override
+    {
+        size_t total = 0;
+        while (total < size)
+        {
+            ssize_t written = ::write(fd, data + total, size - total);
+            if (written <= 0)
+            {
+                break;
+            }
+            total += written;
+        }
+        return total;
+    }
+};
+
+/**
+ * @brief The loop's EVENT_SERIAL handling until the other side hangs up
+ *
+ * Like handleEvent(): commands, then the display for whatever they changed.
+ */
+static void serve(int deviceFd)
+{
+    while (true)
+    {
+        struct pollfd waitFor = {deviceFd, POLLIN, 0};
+        if (poll(&waitFor, 1, -1) <= 0 || (waitFor.revents & POLLIN) == 0)
+        {
+            return;
+        }
+        serialCommands.poll();
+        fontManager.update(0, virtualMicros() / 1000);
+    }
+}
+
+// Client side, reading the terminal as contact_sheet.py does
+class Terminal
+{
+private:
+    int fd;
+
+public:
+    Terminal(int terminalFd) : fd(terminalFd) {}
+
+    bool readBytes(void *data, size_t size)
+    {
+        uint8_t *bytes = static_cast<uint8_t *>(data);
+        while (size > 0)
+        {
+            struct pollfd waitFor = {fd, POLLIN, 0};
+            if (poll(&waitFor, 1, 2000) <= 0)
+            {
+                return false;
+            }
+            ssize_t received = read(fd, bytes, size);
+            if (received <= 0)
+            {
+                return false;
+            }
+            bytes += received;
+            size -= received;
+        }
+        return true;
+    }
+
+    std::string readLine()
+    {
+        std::string line;
+        char c;
+        while (readBytes(&c, 1) && c != '\n')
+        {
+            line += c;
+        }
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back(); // println() ends lines in CRLF, as the script's rstrip() expects
+        }
+        return line;
+    }
+
+    void send(const std::string &line)
+    {
+        std::string data = line + "\n";
+        CHECK(write(fd, data.data(), data.size()) == (ssize_t)data.size());
+    }
+
+    // Send a command and collect lines up to and including the OK/ERR status
+    std::vector<std::string> command(const std::string &line)
+    {
+        send(line);
+        std::vector<std::string> lines;
+        while (true)
+        {
+            lines.push_back(readLine());
+            const std::string &last = lines.back();
+            if (last.empty() || last.compare(0, 2, "OK") == 0 || last.compare(0, 3, "ERR") == 0)
+            {
+                return lines;
+            }
+        }
+    }
+};
+
+// Open a pseudo-terminal: the device gets the master, the client a raw terminal
+static bool openTerminal(int &masterFd, int &terminalFd)
+{
+    masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (masterFd < 0 || grantpt(masterFd) != 0 || unlockpt(masterFd) != 0)
+    {
+        return false;
+    }
+    terminalFd = open(ptsname(masterFd), O_RDWR | O_NOCTTY);
+    if (terminalFd < 0)
+    {
+        return false;
+    }
+
+    // No echo and no newline translation, like a USB CDC port
+    struct termios settings;
+    tcgetattr(terminalFd, &settings);
+    cfmakeraw(&settings);
+    tcsetattr(terminalFd, TCSANOW, &settings);
+    return true;
+}
+
+static void testProtocol(Terminal &terminal, const FrameBufferTarget &frame)
+{
+    // The firmware's command list: three lines, then OK
+    std::vector<std::string> reply = terminal.command("help");
+    CHECK(reply.size() == 4 && reply[0].compare(0, 13, "HELP | LIST |") == 0 && reply[3] == "OK");
+
+    reply = terminal.command("LIST");
+    CHECK(reply.size() == (size_t)FONT_CATALOG_FONT_COUNT + 1);
+    CHECK(reply.back() == "OK " + std::to_string(FONT_CATALOG_FONT_COUNT));
+    CHECK(reply[1] == std::string("FONT 1 ") + std::to_string(FONT_CATALOG_FONTS[1].size) + " " +
+                          FONT_CATALOG_FONTS[1].family + "|" + FONT_CATALOG_FONTS[1].name);
+
+    reply = terminal.command("FONT 3");
+    CHECK(reply.back() == std::string("OK 3 ") + FONT_CATALOG_FONTS[3].name);
+    CHECK(terminal.command("FONT 9999").back() == "ERR font id");
+    CHECK(terminal.command("FONT x").back() == "ERR font id");
+
+    // Text runs to the end of the line, CRLF included
+    CHECK(terminal.command("TEXT Sphinx of black quartz\r").back() == "OK");
+    reply = terminal.command("INFO");
+    CHECK(reply.size() == 3 && reply[0] == std::string("INFO 3 ") + FONT_CATALOG_FONTS[3].name);
+    CHECK(reply[1] == "TEXT Sphinx of black quartz");
+
+    CHECK(terminal.command(std::string(CommandParser::MAX_LINE + 10, 'x')).back() == "ERR line too long");
+    CHECK(terminal.command("BOGUS").back() == "ERR unknown command BOGUS");
+    CHECK(terminal.command("PUSH").back() == "ERR not on the host");
+    CHECK(terminal.command("FAN").back() == "OK 0");
+
+    // RENDER times the device's frame on the manager's clock
+    CHECK(terminal.command("RENDER").back() == "OK " + std::to_string(COSTS.fontUs) + " us");
+
+    reply = terminal.command("MEM");
+    CHECK(reply.size() > 1 && reply.back() == "OK");
+
+    reply = terminal.command("FIT 240 240 0 ANY Sphinx");
+    CHECK(reply.back().compare(0, 3, "OK ") == 0 && reply.size() > 1 && reply[0].compare(0, 4, "FIT ") == 0);
+
+    // SHOT: header line, length-prefixed rle565 rows, status with the byte total
+    terminal.send("SHOT");
+    CHECK(terminal.readLine() == "SHOT 240 240");
+    unsigned long total = 0;
+    uint8_t encoded[rle565MaxEncodedSize(FRAME_WIDTH)];
+    uint16_t row[FRAME_WIDTH];
+    int rowsMatching = 0;
+    int rowsPlain = 0;
+    for (int y = 0; y < FRAME_HEIGHT; y++)
+    {
+        uint8_t header[2];
+        if (!terminal.readBytes(header, 2))
+        {
+            break;
+        }
+        size_t length = header[0] | (header[1] << 8);
+        CHECK(length <= sizeof(encoded));
+        if (length > sizeof(encoded) || !terminal.readBytes(encoded, length))
+        {
+            break;
+        }
+        total += length;
+        if (rle565Decode(encoded, length, row, FRAME_WIDTH) == length &&
+            memcmp(row, frame.getRow(y), sizeof(row)) == 0)
+        {
+            rowsMatching++;
+        }
+        rowsPlain += (length == 3 * 2); // One colour: two run packets, 128 + 112 pixels
+    }
+    CHECK(rowsMatching == FRAME_HEIGHT);
+    CHECK(terminal.readLine() == "OK " + std::to_string(total));
+
+    // The specimen leaves plain rows that compress to a couple of packets; its text does not
+    CHECK(rowsPlain > 0 && rowsPlain < FRAME_HEIGHT);
+    CHECK(total < (unsigned long)FRAME_WIDTH * FRAME_HEIGHT);
+    printf("SHOT: %lu encoded bytes for %d raw\n", total, FRAME_WIDTH * FRAME_HEIGHT * 2);
+}
+
+int main(int argc, char **argv)
+{
+    int masterFd;
+    int terminalFd;
+    if (!openTerminal(masterFd, terminalFd))
+    {
+        printf("no pseudo-terminal available\n");
+        return 1;
+    }
+
+    // Set up as setup() does, with the headless device in place of the dial
+    static HeadlessDevice device(COSTS, FRAME_WIDTH, FRAME_HEIGHT);
+    static FrameBufferTarget frame(FRAME_WIDTH, FRAME_HEIGHT);
+    static PtyStream stream(masterFd);
+    device.setTarget(frame);
+    fontManager.setDevice(&device);
+    fontManager.setClock(virtualMicros);
+    fontManager.setSampleText("Hello World!");
+    fontManager.update(0, 0);
+    serialCommands.begin(stream, device);
+
+    if (argc > 1 && strcmp(argv[1], "--serve") == 0)
+    {
+        printf("Headless device on %s\n", ptsname(masterFd));
+        fflush(stdout);
+        serve(masterFd);
+        return 0;
+    }
+
+    std::thread deviceThread(serve, masterFd);
+    Terminal terminal(terminalFd);
+    testProtocol(terminal, frame);
+
+    // Hanging up ends the device's loop
+    close(terminalFd);
+    deviceThread.join();
+    close(masterFd);
+    return finishHostTest("test_serialprotocol");
+}
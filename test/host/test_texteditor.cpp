@@ -0,0 +1,302 @@
+/**
+ * @file test_texteditor.cpp
+ * @brief Incremental line breaking and redraw damage of TextEditor, with keystroke timing
+ * @date 2026-10-19
+ *
+ * Random keystrokes (letters, spaces, line breaks, deletions, caret moves)
+ * are applied to an editor, and after each one its lines must equal those of
+ * a new editor given the whole text. A model screen only redraws what
+ * getDamage() names, as EditSession does, and must then show the text.
+ *
+ * Keystrokes are timed at the end of a short text, and at the end, middle
+ * and start of a long one, against laying the whole text out again, as an
+ * editor without incremental breaking would on every key.
+ */
+
+#include "hosttest.hpp"
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "inputlog.hpp"
+#include "texteditor.hpp"
+
+static const int LINE_WIDTH = 220; // The dial's wrap width
+static const int RANDOM_EDITS = 5000;
+
+static int measureProportional(const void *font, uint32_t codepoint)
+{
+    (void)font;
+    if (codepoint >= 0x2E80)
+    {
+        return 16;
+    }
+    if (codepoint == 'i' || codepoint == 'l' || codepoint == ' ' || codepoint == '.')
+    {
+        return 4;
+    }
+    if (codepoint == 'm' || codepoint == 'w' || codepoint == 'M' || codepoint == 'W')
+    {
+        return 12;
+    }
+    return 7 + (codepoint & 1);
+}
+
+// What a display shows: per row, the glyphs drawn at their x
+struct Cell
+{
+    int x;
+    uint32_t codepoint;
+};
+typedef std::vector<std::vector<Cell>> Screen;
+
+static void drawRow(Screen &screen, const TextEditor &editor, size_t row, size_t first, size_t count)
+{
+    for (size_t i = first; i < first + count; i++)
+    {
+        const EditGlyph &glyph = editor.getGlyph(i);
+        if (glyph.codepoint != ' ' && glyph.codepoint != '\n')
+        {
+            screen[row].push_back({glyph.x, glyph.codepoint});
+        }
+    }
+}
+
+static void redrawAll(Screen &screen, const TextEditor &editor)
+{
+    screen.assign(editor.getLineCount(), {});
+    for (size_t row = 0; row < editor.getLineCount(); row++)
+    {
+        drawRow(screen, editor, row, editor.getLine(row).firstGlyph, editor.getLine(row).glyphCount);
+    }
+}
+
+// EditSession::commit(): clear each damaged span and draw its glyphs, or everything when rows moved
+static void applyDamage(Screen &screen, const TextEditor &editor)
+{
+    if (editor.getStats().rowsShifted)
+    {
+        redrawAll(screen, editor);
+        return;
+    }
+    size_t count;
+    const EditDamage *damage = editor.getDamage(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        std::vector<Cell> &row = screen[damage[i].line];
+        std::vector<Cell> kept;
+        for (const Cell &cell : row)
+        {
+            if (cell.x < damage[i].x || cell.x >= damage[i].x + damage[i].width)
+            {
+                kept.push_back(cell);
+            }
+        }
+        row = kept;
+        drawRow(screen, editor, damage[i].line, damage[i].firstGlyph, damage[i].glyphCount);
+    }
+}
+
+static bool sameScreen(Screen a, Screen b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (size_t row = 0; row < a.size(); row++)
+    {
+        if (a[row].size() != b[row].size())
+        {
+            return false;
+        }
+        auto byX = [](const Cell &l, const Cell &r) { return l.x < r.x; };
+        std::sort(a[row].begin(), a[row].end(), byX);
+        std::sort(b[row].begin(), b[row].end(), byX);
+        for (size_t i = 0; i < a[row].size(); i++)
+        {
+            if (a[row][i].x != b[row][i].x || a[row][i].codepoint != b[row][i].codepoint)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool sameLayout(const TextEditor &a, const TextEditor &b)
+{
+    if (a.getLineCount() != b.getLineCount() || a.getGlyphCount() != b.getGlyphCount())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.getLineCount(); i++)
+    {
+        const EditLine &l = a.getLine(i);
+        const EditLine &r = b.getLine(i);
+        if (l.firstGlyph != r.firstGlyph || l.glyphCount != r.glyphCount || l.width != r.width)
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < a.getGlyphCount(); i++)
+    {
+        if (a.getGlyph(i).x != b.getGlyph(i).x || a.getGlyph(i).codepoint != b.getGlyph(i).codepoint)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t randomKey()
+{
+    static const char keys[] = "abcdefghijklmnopqrstuvwxyz     iiillmmwwTHE.";
+    int pick = rand() % 100;
+    if (pick < 3)
+    {
+        return '\n';
+    }
+    if (pick < 6)
+    {
+        return 0x3042 + rand() % 40; // Hiragana, breakable anywhere
+    }
+    return keys[rand() % (sizeof(keys) - 1)];
+}
+
+struct KeystrokeTiming
+{
+    LatencyStats incremental;
+    LatencyStats full;
+    uint32_t linesBroken;
+    uint32_t keystrokes;
+};
+
+// Type a word and delete it again at one caret position, timing each key both ways
+static void timeKeystrokes(GlyphWidthTable &widths, const char *text, size_t caret, KeystrokeTiming &timing)
+{
+    static const char WORD[] = " typography";
+    TextEditor editor;
+    editor.setFont(widths, LINE_WIDTH);
+    editor.setText(text);
+    TextEditor rebuilt;
+    rebuilt.setFont(widths, LINE_WIDTH);
+    char copy[TextEditor::MAX_GLYPHS * 4];
+
+    for (int round = 0; round < 20; round++)
+    {
+        editor.setCursor(caret < editor.getGlyphCount() ? caret : editor.getGlyphCount());
+        for (int i = 0; i < (int)(2 * (sizeof(WORD) - 1)); i++)
+        {
+            uint32_t start = hostMicros();
+            bool typing = i < (int)(sizeof(WORD) - 1);
+            bool changed = typing ? editor.insert((uint8_t)WORD[i]) : editor.erase();
+            timing.incremental.add(hostMicros() - start);
+            CHECK(changed);
+            timing.linesBroken += editor.getStats().linesBroken;
+            timing.keystrokes++;
+
+            editor.copyText(copy, sizeof(copy));
+            start = hostMicros();
+            rebuilt.setText(copy);
+            timing.full.add(hostMicros() - start);
+        }
+    }
+    CHECK(sameLayout(editor, rebuilt));
+}
+
+static void report(const char *name, KeystrokeTiming &timing)
+{
+    char incremental[96];
+    char full[96];
+    timing.incremental.format(incremental, sizeof(incremental));
+    timing.full.format(full, sizeof(full));
+    printf("%-18s incremental %s\n%-18s full layout %s\n%-18s %.1f lines broken per key\n", name, incremental, "",
+           full, "", (double)timing.linesBroken / timing.keystrokes);
+}
+
+int main()
+{
+    GlyphWidthTable widths;
+    widths.reset(nullptr, measureProportional);
+
+    // Random edits keep the lines of a full layout, and the damage redraws them
+    srand(41);
+    TextEditor editor;
+    editor.setFont(widths, LINE_WIDTH);
+    editor.setText("The quick brown fox jumps over the lazy dog. いろはにほへと");
+    Screen screen;
+    redrawAll(screen, editor);
+    TextEditor reference;
+    reference.setFont(widths, LINE_WIDTH);
+    char text[TextEditor::MAX_GLYPHS * 4];
+    size_t layoutMismatches = 0;
+    size_t screenMismatches = 0;
+    size_t partialRedraws = 0;
+    for (int step = 0; step < RANDOM_EDITS; step++)
+    {
+        int action = rand() % 10;
+        if (action == 0)
+        {
+            editor.setCursor(rand() % (editor.getGlyphCount() + 1));
+            continue;
+        }
+        bool changed = (action < 3 || editor.getGlyphCount() >= TextEditor::MAX_GLYPHS - 1) ? editor.erase()
+                                                                                            : editor.insert(randomKey());
+        if (!changed)
+        {
+            continue;
+        }
+
+        editor.copyText(text, sizeof(text));
+        reference.setText(text);
+        layoutMismatches += !sameLayout(editor, reference);
+
+        applyDamage(screen, editor);
+        Screen expected;
+        redrawAll(expected, editor);
+        screenMismatches += !sameScreen(screen, expected);
+        partialRedraws += !editor.getStats().rowsShifted;
+    }
+    CHECK(layoutMismatches == 0);
+    CHECK(screenMismatches == 0);
+    CHECK(partialRedraws > RANDOM_EDITS / 2); // Most keys leave the other rows in place
+
+    // Keystroke timing in a short text and in one near the editor's limit
+    const char *shortText = "Sphinx of black quartz, judge my vow.";
+    std::string longText;
+    while (longText.size() + 60 < TextEditor::MAX_GLYPHS - 40)
+    {
+        longText += "Pack my box with five dozen liquor jugs. ";
+    }
+    KeystrokeTiming shortEnd = {};
+    KeystrokeTiming longEnd = {};
+    KeystrokeTiming longMiddle = {};
+    KeystrokeTiming longStart = {};
+    TextEditor longEditor;
+    longEditor.setFont(widths, LINE_WIDTH);
+    longEditor.setText(longText.c_str());
+    timeKeystrokes(widths, shortText, strlen(shortText), shortEnd);
+    timeKeystrokes(widths, longText.c_str(), longText.size(), longEnd);
+    timeKeystrokes(widths, longText.c_str(), longText.size() / 2, longMiddle);
+    timeKeystrokes(widths, longText.c_str(), 0, longStart);
+
+    printf("%d random edits checked; keystrokes in a %zu-character text and a %zu-character one of %u lines:\n",
+           RANDOM_EDITS, strlen(shortText), longText.size(), (unsigned)longEditor.getLineCount());
+    report("short, at the end", shortEnd);
+    report("long, at the end", longEnd);
+    report("long, in middle", longMiddle);
+    report("long, at start", longStart);
+
+    // The work per key does not grow with the text: only lines near the edit are broken again
+    double longLines = longEditor.getLineCount();
+    CHECK((double)longEnd.linesBroken / longEnd.keystrokes <= 4);
+    CHECK((double)longMiddle.linesBroken / longMiddle.keystrokes <= longLines / 3);
+    CHECK((double)longStart.linesBroken / longStart.keystrokes <= longLines / 3);
+
+    // So in a long text a key costs less than laying the whole text out
+    CHECK(longEnd.incremental.getPercentile(50) < longEnd.full.getPercentile(50));
+    CHECK(longStart.incremental.getPercentile(50) < longStart.full.getPercentile(50));
+
+    return finishHostTest("test_texteditor");
+}
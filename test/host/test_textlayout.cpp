@@ -0,0 +1,227 @@
+/**
+ * @file test_textlayout.cpp
+ * @brief UTF-8 decoding, CJK line breaking and the Japanese/Chinese layout benchmark
+ * @date 2026-10-19
+ *
+ * The efont and lgfxJapan tables are not available on the host, so each
+ * family is modelled by a sorted codepoint table of the same size searched
+ * the way the device searches it. The baseline repeats that search for
+ * every character of every layout, as the old per-character textWidth()
+ * loop did; TextLayout decodes once and measures each glyph once per font.
+ */
+
+#include "hosttest.hpp"
+#include <algorithm>
+#include <string.h>
+#include <vector>
+#include "textlayout.hpp"
+
+// A bitmap font family seen as a sorted glyph table
+struct SimulatedFamily
+{
+    const char *name;
+    std::vector<uint32_t> codepoints;
+};
+
+static uint32_t glyphSearches = 0;
+
+static void addRange(SimulatedFamily &family, uint32_t first, uint32_t last, uint32_t step)
+{
+    for (uint32_t cp = first; cp <= last; cp += step)
+    {
+        family.codepoints.push_back(cp);
+    }
+}
+
+static int measureGlyph(const void *font, uint32_t codepoint)
+{
+    const SimulatedFamily *family = static_cast<const SimulatedFamily *>(font);
+    glyphSearches++;
+    bool found = std::binary_search(family->codepoints.begin(), family->codepoints.end(), codepoint);
+    if (!found)
+    {
+        return 8; // Fallback glyph
+    }
+    return (codepoint < 0x2E80) ? 8 : 16;
+}
+
+// The old wrapping: measure each character again on every layout
+static int baselineLayout(const SimulatedFamily &family, const char *text, int maxWidth)
+{
+    SpanList spans;
+    decodeUtf8(text, spans);
+    int lines = 1;
+    int width = 0;
+    for (size_t i = 0; i < spans.size(); i++)
+    {
+        int advance = measureGlyph(&family, spans[i].codepoint);
+        if (width + advance > maxWidth)
+        {
+            lines++;
+            width = 0;
+        }
+        width += advance;
+    }
+    return lines;
+}
+
+static void testDecode()
+{
+    SpanList spans;
+    CHECK(decodeUtf8("A\xC3\xA9\xE3\x81\x82\xF0\x9F\x98\x80", spans) == 4);
+    CHECK(spans[0].codepoint == 'A' && spans[0].byteLength == 1);
+    CHECK(spans[1].codepoint == 0xE9 && spans[1].byteOffset == 1 && spans[1].byteLength == 2);
+    CHECK(spans[2].codepoint == 0x3042 && spans[2].byteOffset == 3 && spans[2].byteLength == 3);
+    CHECK(spans[3].codepoint == 0x1F600 && spans[3].byteOffset == 6 && spans[3].byteLength == 4);
+
+    // Truncated, overlong and surrogate sequences decode to U+FFFD one byte at a time
+    CHECK(decodeUtf8("\xE3\x81", spans) == 2);
+    CHECK(spans[0].codepoint == 0xFFFD && spans[0].byteLength == 1);
+    CHECK(decodeUtf8("\xC0\xAF", spans) == 2);
+    CHECK(spans[0].codepoint == 0xFFFD);
+    CHECK(decodeUtf8("\xED\xA0\x80", spans) == 3);
+    CHECK(decodeUtf8("", spans) == 0);
+    CHECK(decodeUtf8(nullptr, spans) == 0);
+}
+
+// Every line starts on a character, fits, and does not start with closing punctuation
+static void checkLines(TextLayout &layout, const char *text, int maxWidth)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < layout.getLineCount(); i++)
+    {
+        const LayoutLine &line = layout.getLine(i);
+        CHECK((static_cast<uint8_t>(text[line.byteStart]) & 0xC0) != 0x80);
+        CHECK(line.width <= maxWidth);
+
+        SpanList first;
+        decodeUtf8(text + line.byteStart, first);
+        if (i > 0 && !first.empty())
+        {
+            CHECK(!isNoLineStart(first[0].codepoint));
+        }
+        total += line.byteLength;
+    }
+    CHECK(total <= strlen(text));
+}
+
+static void testBreaking()
+{
+    SimulatedFamily family = {"test", {}};
+    addRange(family, 0x20, 0x7E, 1);
+    addRange(family, 0x3000, 0x30FF, 1);
+    addRange(family, 0x4E00, 0x9FFF, 1);
+    addRange(family, 0xFF00, 0xFFEF, 1);
+    GlyphWidthCache cache(measureGlyph);
+    TextLayout layout;
+
+    // Latin breaks after spaces only
+    const char *latin = "The quick brown fox jumps over the lazy dog";
+    layout.setText(latin);
+    layout.layout(cache.forFont(&family), 100);
+    CHECK(layout.getLineCount() == 4);
+    checkLines(layout, latin, 100);
+    char line[TextLayout::MAX_LINE_BYTES];
+    layout.copyLine(0, line, sizeof(line));
+    CHECK(strcmp(line, "The quick") == 0);
+
+    // Ideographs break anywhere, but 、。， stay with the character before them
+    const char *chinese = "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。";
+    layout.setText(chinese);
+    layout.layout(cache.forFont(&family), 80);
+    CHECK(layout.getLineCount() == 4);
+    checkLines(layout, chinese, 80);
+    layout.copyLine(0, line, sizeof(line));
+    CHECK(strcmp(line, "天地玄黄，") == 0);
+
+    const char *japanese = "いろはにほへと ちりぬるを わかよたれそ つねならむ";
+    layout.setText(japanese);
+    layout.layout(cache.forFont(&family), 96);
+    checkLines(layout, japanese, 96);
+    CHECK(layout.getLineCount() > 1);
+
+    // Truncating a line never splits a character
+    layout.setText(chinese);
+    layout.layout(cache.forFont(&family), 400);
+    CHECK(layout.copyLine(0, line, 8) == 6);
+
+    // A new layout with the same font and width is a no-op
+    uint32_t before = glyphSearches;
+    layout.layout(cache.forFont(&family), 400);
+    CHECK(glyphSearches == before);
+}
+
+static void benchmarkFamily(SimulatedFamily &family, const char *text)
+{
+    static const int ROUNDS = 2000;
+    static const int WIDTHS[] = {120, 160, 200, 240};
+    GlyphWidthCache cache(measureGlyph);
+    TextLayout layout;
+    layout.setText(text);
+
+    SpanList spans;
+    size_t distinct = 0;
+    {
+        decodeUtf8(text, spans);
+        std::vector<uint32_t> seen;
+        for (size_t i = 0; i < spans.size(); i++)
+        {
+            seen.push_back(spans[i].codepoint);
+        }
+        std::sort(seen.begin(), seen.end());
+        distinct = std::unique(seen.begin(), seen.end()) - seen.begin();
+    }
+
+    glyphSearches = 0;
+    uint32_t start = hostMicros();
+    int lines = 0;
+    for (int i = 0; i < ROUNDS; i++)
+    {
+        lines += baselineLayout(family, text, WIDTHS[i % 4]);
+    }
+    uint32_t baselineMicros = hostMicros() - start;
+    uint32_t baselineSearches = glyphSearches;
+
+    // Every round changes the width, so each one breaks the lines again
+    glyphSearches = 0;
+    start = hostMicros();
+    for (int i = 0; i < ROUNDS; i++)
+    {
+        layout.layout(cache.forFont(&family), WIDTHS[i % 4]);
+        lines += layout.getLineCount();
+    }
+    uint32_t cachedMicros = hostMicros() - start;
+
+    // Each distinct glyph is looked up in the font once, however often it is laid out
+    CHECK(glyphSearches == distinct);
+    CHECK(lines > 0);
+
+    printf("%-22s %5zu glyphs, %2zu chars: per-char search %6.2f us/layout (%u searches), "
+           "cached %5.2f us/layout (%u searches)\n",
+           family.name, family.codepoints.size(), spans.size(), (double)baselineMicros / ROUNDS,
+           (unsigned)baselineSearches, (double)cachedMicros / ROUNDS, (unsigned)glyphSearches);
+}
+
+int main()
+{
+    testDecode();
+    testBreaking();
+
+    // Glyph counts of the efont CN and lgfxJapanGothic tables
+    SimulatedFamily chinese = {"efont CN (simulated)", {}};
+    addRange(chinese, 0x20, 0x7E, 1);
+    addRange(chinese, 0x3000, 0x303F, 1);
+    addRange(chinese, 0x4E00, 0x9FA5, 1);
+    addRange(chinese, 0xFF01, 0xFF5E, 1);
+
+    SimulatedFamily japanese = {"lgfxJapan (simulated)", {}};
+    addRange(japanese, 0x20, 0x7E, 1);
+    addRange(japanese, 0x3000, 0x30FF, 1);
+    addRange(japanese, 0x4E00, 0x9FA0, 3);
+    addRange(japanese, 0xFF01, 0xFF9F, 1);
+
+    benchmarkFamily(chinese, "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。寒来暑往，秋收冬藏。");
+    benchmarkFamily(japanese, "いろはにほへと ちりぬるを わかよたれそ つねならむ うゐのおくやま けふこえて");
+
+    return finishHostTest("test_textlayout");
+}
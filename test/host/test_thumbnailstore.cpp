@@ -0,0 +1,215 @@
+/**
+ * @file test_thumbnailstore.cpp
+ * @brief rle4 rows and thumbnail files written and read back
+ * @date 2026-10-19
+ *
+ * Rows are random runs and noise, packed like a 4-bit sprite of an odd
+ * width. Thumbnails of different heights go through ThumbnailWriter and
+ * come back identical from ThumbnailStore; files for another catalog, text,
+ * width or font count, and damaged files, are rejected. Reads reuse the
+ * buffer sized by load() and allocate nothing.
+ */
+
+#include "hosttest.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "rle4.hpp"
+#include "thumbnailstore.hpp"
+
+static const int WIDTH = 241; // Odd, so the last byte of a row holds one pixel
+static const size_t STRIDE = (WIDTH + 1) / 2;
+static const int FONTS = 12;
+static const uint32_t CATALOG_HASH = 0x1234ABCD;
+static const uint32_t TEXT_HASH = 0x0BADF00D;
+static const char *PATH = "test_thumbnails.bin";
+
+static void setPixel(uint8_t *row, int x, uint8_t index)
+{
+    uint8_t &byte = row[x / 2];
+    byte = (x & 1) ? (byte & 0xF0) | index : (byte & 0x0F) | (index << 4);
+}
+
+// Blank margins, runs of text color and anti-aliased noise, as a rendered specimen has
+static void fillRow(uint8_t *row, int y)
+{
+    memset(row, 0, STRIDE);
+    if (y % 7 == 6)
+    {
+        return; // Blank line between text lines
+    }
+    int x = 10 + rand() % 20;
+    while (x < WIDTH - 10)
+    {
+        int run = 1 + rand() % 12;
+        uint8_t index = (rand() % 3 == 0) ? rand() % 16 : 1;
+        for (int i = 0; i < run && x < WIDTH; i++, x++)
+        {
+            setPixel(row, x, (rand() % 4 == 0) ? rand() % 16 : index);
+        }
+        x += rand() % 8;
+    }
+}
+
+// Rows compared pixel by pixel; the unused low nibble at the end of a row is not decoded
+static bool samePixels(const uint8_t *a, const uint8_t *b, int rows)
+{
+    for (int y = 0; y < rows; y++)
+    {
+        for (int x = 0; x < WIDTH; x++)
+        {
+            int shift = (x & 1) ? 0 : 4;
+            if (((a[y * STRIDE + x / 2] >> shift) & 0x0F) != ((b[y * STRIDE + x / 2] >> shift) & 0x0F))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool writeFile(const std::vector<std::vector<uint8_t>> &images, uint32_t catalogHash, uint32_t textHash)
+{
+    ThumbnailWriter writer;
+    if (!writer.begin(PATH, catalogHash, textHash, WIDTH, images.size()))
+    {
+        return false;
+    }
+    for (const std::vector<uint8_t> &image : images)
+    {
+        if (!writer.add(image.data(), STRIDE, image.size() / STRIDE))
+        {
+            return false;
+        }
+    }
+    return writer.finish();
+}
+
+int main()
+{
+    srand(39);
+
+    // Rows encode within the worst case and decode to the same pixels, consuming exactly what was written
+    uint8_t row[STRIDE];
+    uint8_t decoded[STRIDE];
+    uint8_t encoded[rle4MaxEncodedSize(WIDTH)];
+    for (int y = 0; y < 500; y++)
+    {
+        fillRow(row, y);
+        if (y % 50 == 49)
+        {
+            for (int x = 0; x < WIDTH; x++)
+            {
+                setPixel(row, x, x % 2 ? 3 : 5 + (x % 5)); // No runs at all
+            }
+        }
+        size_t length = rle4Encode(row, WIDTH, encoded, sizeof(encoded));
+        CHECK(length > 0 && length <= rle4MaxEncodedSize(WIDTH));
+        memset(decoded, 0xEE, sizeof(decoded));
+        CHECK(rle4Decode(encoded, length, decoded, WIDTH) == length);
+        CHECK(samePixels(row, decoded, 1));
+        CHECK(rle4Decode(encoded, length - 1, decoded, WIDTH) == 0); // Truncated
+    }
+    memset(row, 0, sizeof(row));
+    size_t blank = rle4Encode(row, WIDTH, encoded, sizeof(encoded));
+    CHECK(blank == 4); // Two runs of 128 and 113
+    CHECK(rle4Encode(row, WIDTH, encoded, blank - 1) == 0);
+
+    // Thumbnails of different heights, one of them empty
+    std::vector<std::vector<uint8_t>> images(FONTS);
+    size_t rawBytes = 0;
+    for (int font = 0; font < FONTS; font++)
+    {
+        int height = (font == 3) ? 0 : 20 + rand() % 100;
+        images[font].resize(height * STRIDE);
+        for (int y = 0; y < height; y++)
+        {
+            fillRow(images[font].data() + y * STRIDE, y);
+        }
+        rawBytes += images[font].size();
+    }
+    CHECK(writeFile(images, CATALOG_HASH, TEXT_HASH));
+
+    ThumbnailStore store;
+    CHECK(!store.isReady());
+    CHECK(store.load(PATH, CATALOG_HASH, TEXT_HASH, WIDTH, FONTS));
+    CHECK(store.isReady() && store.getTextHash() == TEXT_HASH);
+    CHECK(store.getFileSize() > 0 && store.getFileSize() < rawBytes);
+
+    // Every thumbnail comes back as written, without allocating
+    std::vector<uint8_t> pixels(120 * STRIDE);
+    uint32_t allocations = memoryTracker.getAllocationCount(MEM_THUMBNAILS);
+    for (int pass = 0; pass < 3; pass++)
+    {
+        for (int font = 0; font < FONTS; font++)
+        {
+            int height = -1;
+            bool read = store.read(font, pixels.data(), STRIDE, 120, height);
+            if (font == 3)
+            {
+                CHECK(!read); // Nothing to show
+                continue;
+            }
+            CHECK(read && (size_t)height * STRIDE == images[font].size());
+            CHECK(samePixels(pixels.data(), images[font].data(), height));
+        }
+    }
+    CHECK(memoryTracker.getAllocationCount(MEM_THUMBNAILS) == allocations);
+
+    // Out of range ids, and thumbnails taller than the output
+    int height = 0;
+    CHECK(!store.read(-1, pixels.data(), STRIDE, 120, height));
+    CHECK(!store.read(FONTS, pixels.data(), STRIDE, 120, height));
+    CHECK(!store.read(0, pixels.data(), STRIDE, images[0].size() / STRIDE - 1, height) && height == 0);
+    size_t fileSize = store.getFileSize();
+    store.close();
+    CHECK(!store.isReady() && store.getFileSize() == 0);
+    CHECK(memoryTracker.getCurrent(MEM_THUMBNAILS, MEM_INTERNAL) == 0);
+
+    // Files for another catalog, text, width or font count are rejected
+    CHECK(!store.load(PATH, CATALOG_HASH + 1, TEXT_HASH, WIDTH, FONTS));
+    CHECK(!store.load(PATH, CATALOG_HASH, TEXT_HASH + 1, WIDTH, FONTS));
+    CHECK(!store.load(PATH, CATALOG_HASH, TEXT_HASH, WIDTH + 1, FONTS));
+    CHECK(!store.load(PATH, CATALOG_HASH, TEXT_HASH, WIDTH, FONTS - 1));
+    CHECK(!store.load("missing_thumbnails.bin", CATALOG_HASH, TEXT_HASH, WIDTH, FONTS));
+
+    // A damaged row is reported, not drawn
+    std::vector<uint8_t> file(fileSize);
+    FILE *in = fopen(PATH, "rb");
+    CHECK(in != nullptr && fread(file.data(), 1, file.size(), in) == file.size());
+    if (in != nullptr)
+    {
+        fclose(in);
+    }
+    std::vector<uint8_t> damaged = file;
+    damaged[24]++; // Row count of font 0, after the 24-byte header: one row more than its data holds
+    FILE *out = fopen(PATH, "wb");
+    fwrite(damaged.data(), 1, damaged.size(), out);
+    fclose(out);
+    CHECK(store.load(PATH, CATALOG_HASH, TEXT_HASH, WIDTH, FONTS));
+    CHECK(!store.read(0, pixels.data(), STRIDE, 120, height) && height == 0);
+    CHECK(store.read(1, pixels.data(), STRIDE, 120, height));
+    store.close();
+
+    // A truncated file is rejected at load
+    out = fopen(PATH, "wb");
+    fwrite(file.data(), 1, file.size() - 4, out);
+    fclose(out);
+    CHECK(!store.load(PATH, CATALOG_HASH, TEXT_HASH, WIDTH, FONTS));
+
+    // An unfinished file is never accepted, and the one it would replace survives
+    CHECK(writeFile(images, CATALOG_HASH, TEXT_HASH));
+    {
+        ThumbnailWriter writer;
+        CHECK(writer.begin(PATH, CATALOG_HASH, TEXT_HASH + 1, WIDTH, FONTS));
+        CHECK(writer.add(images[0].data(), STRIDE, images[0].size() / STRIDE));
+        CHECK(!writer.finish()); // Fewer thumbnails than announced
+    }
+    CHECK(store.load(PATH, CATALOG_HASH, TEXT_HASH, WIDTH, FONTS));
+    store.close();
+    remove(PATH);
+
+    printf("%d thumbnails %dx20..120: %zu bytes raw, %zu bytes stored (%.0f%%)\n", FONTS, WIDTH, rawBytes,
+           fileSize, 100.0 * fileSize / rawBytes);
+    return finishHostTest("test_thumbnailstore");
+}
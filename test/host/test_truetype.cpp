@@ -0,0 +1,339 @@
+/**
+ * @file test_truetype.cpp
+ * @brief TrueType parsing, truncated composite glyphs, and flash against render time
+ * @date 2026-10-19
+ *
+ * Loads a TrueType face (DejaVu Sans, as drawn by the catalog's DejaVu
+ * bitmap fonts). Composite glyphs whose scale fields run past the end of the
+ * glyph are rejected. Then, for each size of the DejaVu family, the printable
+ * ASCII glyphs are rasterized and packed as Adafruit fontconvert packs a GFX
+ * font (1 bit per pixel of each glyph box, byte-aligned per glyph, and a
+ * 7-byte glyph record), which gives the flash one bitmap size costs. A line
+ * of text is drawn into an RGB565 buffer from those bitmaps, from an empty
+ * glyph cache (rasterizing every glyph) and from a warm one. Timings are
+ * host timings; their ratios, not their values, carry over to the device.
+ *
+ * Usage: test_truetype <font.ttf>
+ */
+
+#include "hosttest.hpp"
+#include <string.h>
+#include <vector>
+#include "glyphcache.hpp"
+#include "truetype.hpp"
+
+static const int SIZES[] = {9, 12, 18, 24, 40, 56, 72}; // The DejaVu family in font_manifest.json
+static const char *TEXT = "The quick brown fox jumps over the lazy dog 0123456789";
+static const int REPEATS = 50;
+static const int BUFFER_WIDTH = 1600;
+
+// Composite glyph flags, see truetype.cpp
+static const uint16_t ARG_1_AND_2_ARE_WORDS = 0x0001;
+static const uint16_t WE_HAVE_A_SCALE = 0x0008;
+static const uint16_t MORE_COMPONENTS = 0x0020;
+static const uint16_t WE_HAVE_AN_X_AND_Y_SCALE = 0x0040;
+static const uint16_t WE_HAVE_A_TWO_BY_TWO = 0x0080;
+
+static uint16_t getU16(const std::vector<uint8_t> &data, size_t offset)
+{
+    return (data[offset] << 8) | data[offset + 1];
+}
+
+static uint32_t getU32(const std::vector<uint8_t> &data, size_t offset)
+{
+    return ((uint32_t)getU16(data, offset) << 16) | getU16(data, offset + 2);
+}
+
+static void putU16(std::vector<uint8_t> &data, size_t offset, uint16_t value)
+{
+    data[offset] = value >> 8;
+    data[offset + 1] = value & 0xFF;
+}
+
+static void putU32(std::vector<uint8_t> &data, size_t offset, uint32_t value)
+{
+    putU16(data, offset, value >> 16);
+    putU16(data, offset + 2, value & 0xFFFF);
+}
+
+static uint32_t findTable(const std::vector<uint8_t> &data, const char *tag)
+{
+    for (int i = 0; i < getU16(data, 4); i++)
+    {
+        size_t record = 12 + i * 16;
+        if (memcmp(&data[record], tag, 4) == 0)
+        {
+            return getU32(data, record + 8);
+        }
+    }
+    return 0;
+}
+
+// Glyph locations from the loca table, in either format
+struct GlyphLocations
+{
+    uint32_t glyf;
+    uint32_t loca;
+    bool longLoca;
+
+    explicit GlyphLocations(const std::vector<uint8_t> &data) : glyf(findTable(data, "glyf")),
+                                                                  loca(findTable(data, "loca")),
+                                                                  longLoca(getU16(data, findTable(data, "head") + 50) != 0)
+    {
+    }
+
+    uint32_t get(const std::vector<uint8_t> &data, uint16_t glyph) const
+    {
+        return longLoca ? getU32(data, loca + glyph * 4) : getU16(data, loca + glyph * 2) * 2;
+    }
+
+    void set(std::vector<uint8_t> &data, uint16_t glyph, uint32_t offset) const
+    {
+        if (longLoca)
+        {
+            putU32(data, loca + glyph * 4, offset);
+        }
+        else
+        {
+            putU16(data, loca + glyph * 2, offset / 2);
+        }
+    }
+};
+
+/**
+ * Keep only the first component of a composite glyph, give it a scale of the
+ * given kind and end the glyph before the scale's values
+ */
+static bool truncatedCompositeLoads(const std::vector<uint8_t> &font, uint16_t glyph, uint16_t scaleFlag)
+{
+    std::vector<uint8_t> data = font;
+    GlyphLocations locations(data);
+    uint32_t start = locations.glyf + locations.get(data, glyph);
+    uint16_t flags = getU16(data, start + 10);
+    flags &= ~(MORE_COMPONENTS | WE_HAVE_A_SCALE | WE_HAVE_AN_X_AND_Y_SCALE | WE_HAVE_A_TWO_BY_TWO);
+    putU16(data, start + 10, flags | scaleFlag);
+    uint32_t length = 10 + 4 + ((flags & ARG_1_AND_2_ARE_WORDS) ? 4 : 2);
+    locations.set(data, glyph + 1, locations.get(data, glyph) + length);
+
+    TrueTypeFace face;
+    TrueTypeFace::Outline outline;
+    return face.load(data.data(), data.size()) && face.getOutline(glyph, outline);
+}
+
+// A glyph as a GFX font stores it: 1-bit rows of the glyph box, bits running on across rows
+struct GfxGlyph
+{
+    int width;
+    int height;
+    int left;
+    int top;
+    int advance;
+    std::vector<uint8_t> bits;
+};
+
+static int coverageAt(const GlyphBitmap &bitmap, int x, int y)
+{
+    uint8_t byte = bitmap.pixels[y * bitmap.getStride() + x / 2];
+    return (x & 1) ? (byte & 0x0F) : (byte >> 4);
+}
+
+static GfxGlyph toGfx(const GlyphBitmap &bitmap)
+{
+    GfxGlyph glyph = {bitmap.width, bitmap.height, bitmap.left, bitmap.top, bitmap.advance, {}};
+    glyph.bits.assign((bitmap.width * bitmap.height + 7) / 8, 0);
+    int bit = 0;
+    for (int y = 0; y < bitmap.height; y++)
+    {
+        for (int x = 0; x < bitmap.width; x++, bit++)
+        {
+            if (coverageAt(bitmap, x, y) >= 8)
+            {
+                glyph.bits[bit / 8] |= 0x80 >> (bit % 8);
+            }
+        }
+    }
+    return glyph;
+}
+
+static uint16_t frame[BUFFER_WIDTH * 200];
+
+static void drawGfx(const GfxGlyph &glyph, int penX, int baseline)
+{
+    int bit = 0;
+    for (int y = 0; y < glyph.height; y++)
+    {
+        uint16_t *row = frame + (baseline - glyph.top + y) * BUFFER_WIDTH + penX + glyph.left;
+        for (int x = 0; x < glyph.width; x++, bit++)
+        {
+            if (glyph.bits[bit / 8] & (0x80 >> (bit % 8)))
+            {
+                row[x] = 0xFFFF;
+            }
+        }
+    }
+}
+
+// Coverage blended from black towards white, as ScalableFont does on RGB565 targets
+static void drawCoverage(const GlyphBitmap &bitmap, int penX, int baseline)
+{
+    for (int y = 0; y < bitmap.height; y++)
+    {
+        uint16_t *row = frame + (baseline - bitmap.top + y) * BUFFER_WIDTH + penX + bitmap.left;
+        for (int x = 0; x < bitmap.width; x++)
+        {
+            int coverage = coverageAt(bitmap, x, y);
+            if (coverage != 0)
+            {
+                int level = coverage * 2 + (coverage >> 3); // 0..31
+                row[x] = (level << 11) | ((level * 2) << 5) | level;
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        printf("usage: test_truetype <font.ttf>\n");
+        return 1;
+    }
+    FILE *file = fopen(argv[1], "rb");
+    if (file == nullptr)
+    {
+        printf("%s: cannot open\n", argv[1]);
+        return 1;
+    }
+    std::vector<uint8_t> font;
+    uint8_t chunk[4096];
+    for (size_t n; (n = fread(chunk, 1, sizeof(chunk), file)) > 0;)
+    {
+        font.insert(font.end(), chunk, chunk + n);
+    }
+    fclose(file);
+
+    TrueTypeFace face;
+    CHECK(face.load(font.data(), font.size()));
+    CHECK(face.getMetrics().unitsPerEm > 0 && face.getMetrics().ascender > 0);
+    CHECK(face.findGlyph('A') != 0 && face.findGlyph(0x10FFFF) == 0);
+
+    // The first accented capital drawn as a composite of its letter and accent
+    uint16_t composite = 0;
+    GlyphLocations locations(font);
+    for (uint32_t codepoint = 0xC0; codepoint < 0x180 && composite == 0; codepoint++)
+    {
+        uint16_t glyph = face.findGlyph(codepoint);
+        uint32_t start = locations.glyf + locations.get(font, glyph);
+        if (glyph != 0 && locations.get(font, glyph + 1) > locations.get(font, glyph) &&
+            (int16_t)getU16(font, start) < 0)
+        {
+            composite = glyph;
+        }
+    }
+    CHECK(composite != 0);
+    if (composite != 0)
+    {
+        TrueTypeFace::Outline outline;
+        CHECK(face.getOutline(composite, outline) && !outline.points.empty());
+
+        // Only the component header fits: fine without a scale, rejected with any scale
+        CHECK(truncatedCompositeLoads(font, composite, 0));
+        CHECK(!truncatedCompositeLoads(font, composite, WE_HAVE_A_SCALE));
+        CHECK(!truncatedCompositeLoads(font, composite, WE_HAVE_AN_X_AND_Y_SCALE));
+        CHECK(!truncatedCompositeLoads(font, composite, WE_HAVE_A_TWO_BY_TWO));
+    }
+
+    printf("%s: %zu bytes, %u glyphs; \"%s\" drawn %d times per column\n", argv[1], font.size(),
+           face.getGlyphCount(), TEXT, REPEATS);
+    printf("%5s %10s %10s %10s %10s %11s\n", "px", "GFX bytes", "GFX us", "TTF cold", "TTF warm", "cache bytes");
+
+    GlyphRasterizer rasterizer;
+    GlyphBitmap bitmap;
+    size_t gfxTotal = 0;
+    size_t previousBytes = 0;
+    const size_t length = strlen(TEXT);
+    for (int px : SIZES)
+    {
+        // The size as a GFX font: bitmaps and glyph records of printable ASCII
+        std::vector<GfxGlyph> gfx;
+        size_t gfxBytes = 0;
+        int blank = 0;
+        for (uint32_t codepoint = 0x20; codepoint <= 0x7E; codepoint++)
+        {
+            CHECK(rasterizer.rasterize(face, codepoint, px, bitmap));
+            blank += bitmap.width == 0;
+            gfx.push_back(toGfx(bitmap));
+            gfxBytes += gfx.back().bits.size() + 7;
+        }
+        CHECK(blank == 1); // Only the space
+        CHECK(gfxBytes > previousBytes);
+        previousBytes = gfxBytes;
+        gfxTotal += gfxBytes;
+
+        const int baseline = px + 4;
+        uint32_t start = hostMicros();
+        for (int r = 0; r < REPEATS; r++)
+        {
+            int pen = 0;
+            for (size_t i = 0; i < length; i++)
+            {
+                const GfxGlyph &glyph = gfx[TEXT[i] - 0x20];
+                drawGfx(glyph, pen, baseline);
+                pen += glyph.advance;
+            }
+        }
+        uint32_t gfxMicros = hostMicros() - start;
+
+        // TrueType: every draw from an empty cache, then every draw from a full one
+        GlyphCache cache;
+        auto drawTrueType = [&]()
+        {
+            int pen = 0;
+            for (size_t i = 0; i < length; i++)
+            {
+                const GlyphBitmap *glyph = cache.find(0, px, (uint8_t)TEXT[i]);
+                if (glyph == nullptr && rasterizer.rasterize(face, (uint8_t)TEXT[i], px, bitmap))
+                {
+                    glyph = cache.insert(0, px, (uint8_t)TEXT[i], bitmap);
+                }
+                if (glyph != nullptr)
+                {
+                    drawCoverage(*glyph, pen, baseline);
+                    pen += glyph->advance;
+                }
+            }
+        };
+        uint32_t coldMicros = 0;
+        for (int r = 0; r < REPEATS; r++)
+        {
+            cache.clear();
+            start = hostMicros();
+            drawTrueType();
+            coldMicros += hostMicros() - start;
+        }
+        cache.resetStats();
+        start = hostMicros();
+        for (int r = 0; r < REPEATS; r++)
+        {
+            drawTrueType();
+        }
+        uint32_t warmMicros = hostMicros() - start;
+        GlyphCache::Stats stats = cache.getStats();
+        CHECK(stats.misses == 0 && stats.hits == length * REPEATS);
+        CHECK(warmMicros < coldMicros);
+
+        printf("%5d %10zu %10.1f %10.1f %10.1f %11zu\n", px, gfxBytes, (double)gfxMicros / REPEATS,
+               (double)coldMicros / REPEATS, (double)warmMicros / REPEATS, stats.bytes);
+    }
+    // Outlines an ASCII subset of the face would keep; tables and hinting come on top
+    size_t asciiOutlines = 0;
+    for (uint32_t codepoint = 0x20; codepoint <= 0x7E; codepoint++)
+    {
+        uint16_t glyph = face.findGlyph(codepoint);
+        asciiOutlines += locations.get(font, glyph + 1) - locations.get(font, glyph);
+    }
+    printf("GFX bitmaps for all %zu sizes: %zu bytes; the TrueType face: %zu bytes, %zu of them ASCII outlines\n",
+           sizeof(SIZES) / sizeof(SIZES[0]), gfxTotal, font.size(), asciiOutlines);
+
+    return finishHostTest("test_truetype");
+}